@@ -1,50 +1,50 @@
-// hello.cpp
-//
-// PDFlib client: hello example in C++
-//
-//
-
-#include <stdio.h>
-#include <stdlib.h>
-
-#include "pdflib.hpp"
-
-int
-main(void)
-{
-    PDF *p;			// pointer to the PDF class
-    int font;
-
-    p = new PDF();
-
-    // Open new PDF file
-    if (p->open("hello_cpp.pdf") == -1) {
-	fprintf(stderr, "Error: cannot open PDF file hello_cpp.pdf.\n");
-	exit(2);
-    }
-
-    p->set_info("Creator", "hello.cpp");
-    p->set_info("Author", "Thomas Merz");
-    p->set_info("Title", "Hello, world (C++)!");
-
-    // start a new page
-    p->begin_page((float) a4_width, (float) a4_height);
-
-    font = p->findfont("Helvetica-Bold", "default", 0);
-    if (font == -1) {
-	fprintf(stderr, "Couldn't set font!\n");
-	exit(3);
-    }
-
-    p->setfont(font, 24);
-
-    p->set_text_pos(50, 700);
-    p->show("Hello, world!");
-    p->continue_text("(says C++)");
-    p->end_page();				// finish page
-
-    p->close();					// close PDF document
-    delete p;
-
-    exit(0);
-}
+// hello.cpp
+//
+// PDFlib client: hello example in C++
+//
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pdflib.hpp"
+
+int
+main(void)
+{
+    PDF *p;			// pointer to the PDF class
+    int font;
+
+    p = new PDF();
+
+    // Open new PDF file
+    if (p->open("hello_cpp.pdf") == -1) {
+	fprintf(stderr, "Error: cannot open PDF file hello_cpp.pdf.\n");
+	exit(2);
+    }
+
+    p->set_info("Creator", "hello.cpp");
+    p->set_info("Author", "Thomas Merz");
+    p->set_info("Title", "Hello, world (C++)!");
+
+    // start a new page
+    p->begin_page((float) a4_width, (float) a4_height);
+
+    font = p->findfont("Helvetica-Bold", "default", 0);
+    if (font == -1) {
+	fprintf(stderr, "Couldn't set font!\n");
+	exit(3);
+    }
+
+    p->setfont(font, 24);
+
+    p->set_text_pos(50, 700);
+    p->show("Hello, world!");
+    p->continue_text("(says C++)");
+    p->end_page();				// finish page
+
+    p->close();					// close PDF document
+    delete p;
+
+    exit(0);
+}
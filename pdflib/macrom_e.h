@@ -1,284 +1,284 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* macrom_e.h
- *
- * MacRoman encoding vector
- *
- */
-
-static pdf_encodingvector pdf_macroman = {
-NULL,		/* 0x00		0 */
-NULL,		/* 0x01		1 */
-NULL,		/* 0x02		2 */
-NULL,		/* 0x03		3 */
-NULL,		/* 0x04		4 */
-NULL,		/* 0x05		5 */
-NULL,		/* 0x06		6 */
-NULL,		/* 0x07		7 */
-NULL,		/* 0x08		8 */
-NULL,		/* 0x09		9 */
-NULL,		/* 0x0A		10 */
-NULL,		/* 0x0B		11 */
-NULL,		/* 0x0C		12 */
-NULL,		/* 0x0D		13 */
-NULL,		/* 0x0E		14 */
-NULL,		/* 0x0F		15 */
-NULL,		/* 0x10		16 */
-NULL,		/* 0x11		17 */
-NULL,		/* 0x12		18 */
-NULL,		/* 0x13		19 */
-NULL,		/* 0x14		20 */
-NULL,		/* 0x15		21 */
-NULL,		/* 0x16		22 */
-NULL,		/* 0x17		23 */
-NULL,		/* 0x18		24 */
-NULL,		/* 0x19		25 */
-NULL,		/* 0x1A		26 */
-NULL,		/* 0x1B		27 */
-NULL,		/* 0x1C		28 */
-NULL,		/* 0x1D		29 */
-NULL,		/* 0x1E		30 */
-NULL,		/* 0x1F		31 */
-"space",	/* 0x20		32 */
-"exclam",	/* 0x21		33 */
-"quotedbl",	/* 0x22		34 */
-"numbersign",	/* 0x23		35 */
-"dollar",	/* 0x24		36 */
-"percent",	/* 0x25		37 */
-"ampersand",	/* 0x26		38 */
-"quotesingle",	/* 0x27		39 */
-"parenleft",	/* 0x28		40 */
-"parenright",	/* 0x29		41 */
-"asterisk",	/* 0x2A		42 */
-"plus",		/* 0x2B		43 */
-"comma",	/* 0x2C		44 */
-"hyphen",	/* 0x2D		45 */
-"period",	/* 0x2E		46 */
-"slash",	/* 0x2F		47 */
-"zero",		/* 0x30		48 */
-"one",		/* 0x31		49 */
-"two",		/* 0x32		50 */
-"three",	/* 0x33		51 */
-"four",		/* 0x34		52 */
-"five",		/* 0x35		53 */
-"six",		/* 0x36		54 */
-"seven",	/* 0x37		55 */
-"eight",	/* 0x38		56 */
-"nine",		/* 0x39		57 */
-"colon",	/* 0x3A		58 */
-"semicolon",	/* 0x3B		59 */
-"less",		/* 0x3C		60 */
-"equal",	/* 0x3D		61 */
-"greater",	/* 0x3E		62 */
-"question",	/* 0x3F		63 */
-"at",		/* 0x40		64 */
-"A",		/* 0x41		65 */
-"B",		/* 0x42		66 */
-"C",		/* 0x43		67 */
-"D",		/* 0x44		68 */
-"E",		/* 0x45		69 */
-"F",		/* 0x46		70 */
-"G",		/* 0x47		71 */
-"H",		/* 0x48		72 */
-"I",		/* 0x49		73 */
-"J",		/* 0x4A		74 */
-"K",		/* 0x4B		75 */
-"L",		/* 0x4C		76 */
-"M",		/* 0x4D		77 */
-"N",		/* 0x4E		78 */
-"O",		/* 0x4F		79 */
-"P",		/* 0x50		80 */
-"Q",		/* 0x51		81 */
-"R",		/* 0x52		82 */
-"S",		/* 0x53		83 */
-"T",		/* 0x54		84 */
-"U",		/* 0x55		85 */
-"V",		/* 0x56		86 */
-"W",		/* 0x57		87 */
-"X",		/* 0x58		88 */
-"Y",		/* 0x59		89 */
-"Z",		/* 0x5A		90 */
-"bracketleft",	/* 0x5B		91 */
-"backslash",	/* 0x5C		92 */
-"bracketright",	/* 0x5D		93 */
-"asciicircum",	/* 0x5E		94 */
-"underscore",	/* 0x5F		95 */
-"grave",	/* 0x60		96 */
-"a",		/* 0x61		97 */
-"b",		/* 0x62		98 */
-"c",		/* 0x63		99 */
-"d",		/* 0x64		100 */
-"e",		/* 0x65		101 */
-"f",		/* 0x66		102 */
-"g",		/* 0x67		103 */
-"h",		/* 0x68		104 */
-"i",		/* 0x69		105 */
-"j",		/* 0x6A		106 */
-"k",		/* 0x6B		107 */
-"l",		/* 0x6C		108 */
-"m",		/* 0x6D		109 */
-"n",		/* 0x6E		110 */
-"o",		/* 0x6F		111 */
-"p",		/* 0x70		112 */
-"q",		/* 0x71		113 */
-"r",		/* 0x72		114 */
-"s",		/* 0x73		115 */
-"t",		/* 0x74		116 */
-"u",		/* 0x75		117 */
-"v",		/* 0x76		118 */
-"w",		/* 0x77		119 */
-"x",		/* 0x78		120 */
-"y",		/* 0x79		121 */
-"z",		/* 0x7A		122 */
-"braceleft",	/* 0x7B		123 */
-"bar",		/* 0x7C		124 */
-"braceright",	/* 0x7D		125 */
-"asciitilde",	/* 0x7E		126 */
-NULL,		/* 0x7F		127 */
-"Adieresis",	/* 0x80		128 */
-"Aring",	/* 0x81		129 */
-"Ccedilla",	/* 0x82		130 */
-"Eacute",	/* 0x83		131 */
-"Ntilde",	/* 0x84		132 */
-"Odieresis",	/* 0x85		133 */
-"Udieresis",	/* 0x86		134 */
-"aacute",	/* 0x87		135 */
-"agrave",	/* 0x88		136 */
-"acircumflex",	/* 0x89		137 */
-"adieresis",	/* 0x8A		138 */
-"atilde",	/* 0x8B		139 */
-"aring",	/* 0x8C		140 */
-"ccedilla",	/* 0x8D		141 */
-"eacute",	/* 0x8E		142 */
-"egrave",	/* 0x8F		143 */
-"ecircumflex",	/* 0x90		144 */
-"edieresis",	/* 0x91		145 */
-"iacute",	/* 0x92		146 */
-"igrave",	/* 0x93		147 */
-"icircumflex",	/* 0x94		148 */
-"idieresis",	/* 0x95		149 */
-"ntilde",	/* 0x96		150 */
-"oacute",	/* 0x97		151 */
-"ograve",	/* 0x98		152 */
-"ocircumflex",	/* 0x99		153 */
-"odieresis",	/* 0x9A		154 */
-"otilde",	/* 0x9B		155 */
-"uacute",	/* 0x9C		156 */
-"ugrave",	/* 0x9D		157 */
-"ucircumflex",	/* 0x9E		158 */
-"udieresis",	/* 0x9F		159 */
-"dagger",	/* 0xA0		160 */
-"degree",	/* 0xA1		161 */
-"cent",		/* 0xA2		162 */
-"sterling",	/* 0xA3		163 */
-"section",	/* 0xA4		164 */
-"bullet",	/* 0xA5		165 */
-"paragraph",	/* 0xA6		166 */
-"germandbls",	/* 0xA7		167 */
-"registered",	/* 0xA8		168 */
-"copyright",	/* 0xA9		169 */
-"trademark",	/* 0xAA		170 */
-"acute",	/* 0xAB		171 */
-"dieresis",	/* 0xAC		172 */
-NULL,		/* 0xAD		173 */
-"AE",		/* 0xAE		174 */
-"Oslash",	/* 0xAF		175 */
-NULL,		/* 0xB0		176 */
-"plusminus",	/* 0xB1		177 */
-NULL,		/* 0xB2		178 */
-NULL,		/* 0xB3		179 */
-"yen",		/* 0xB4		180 */
-"mu",		/* 0xB5		181 */
-NULL,		/* 0xB6		182 */
-NULL,		/* 0xB7		183 */
-NULL,		/* 0xB8		184 */
-NULL,		/* 0xB9		185 */
-NULL,		/* 0xBA		186 */
-"ordfeminine",	/* 0xBB		187 */
-"ordmasculine",	/* 0xBC		188 */
-NULL,		/* 0xBD		189 */
-"ae",		/* 0xBE		190 */
-"oslash",	/* 0xBF		191 */
-"questiondown",	/* 0xC0		192 */
-"exclamdown",	/* 0xC1		193 */
-"logicalnot",	/* 0xC2		194 */
-NULL,		/* 0xC3		195 */
-"florin",	/* 0xC4		196 */
-NULL,		/* 0xC5		197 */
-NULL,		/* 0xC6		198 */
-"guillemotleft",/* 0xC7		199 */
-"guillemotright",/* 0xC8	200 */
-"ellipsis",	/* 0xC9		201 */
-"space",	/* 0xCA		202 */
-"Agrave",	/* 0xCB		203 */
-"Atilde",	/* 0xCC		204 */
-"Otilde",	/* 0xCD		205 */
-"OE",		/* 0xCE		206 */
-"oe",		/* 0xCF		207 */
-"endash",	/* 0xD0		208 */
-"emdash",	/* 0xD1		209 */
-"quotedblleft",	/* 0xD2		210 */
-"quotedblright",/* 0xD3		211 */
-"quoteleft",	/* 0xD4		212 */
-"quoteright",	/* 0xD5		213 */
-"divide",	/* 0xD6		214 */
-NULL,		/* 0xD7		215 */
-"ydieresis",	/* 0xD8		216 */
-"Ydieresis",	/* 0xD9		217 */
-"fraction",	/* 0xDA		218 */
-"currency",	/* 0xDB		219 */	/* Euro in MacOS */
-"guilsingleft",	/* 0xDC		220 */
-"guilsingright",/* 0xDD		221 */
-"fi",		/* 0xDE		222 */
-"fl",		/* 0xDF		223 */
-"daggerdbl",	/* 0xE0		224 */
-"periodcentered",/* 0xE1	225 */
-"quotesinglbase",/* 0xE2	226 */
-"quotedblbase",	/* 0xE3		227 */
-"perthousand",	/* 0xE4		228 */
-"Acircumflex",	/* 0xE5		229 */
-"Ecircumflex",	/* 0xE6		230 */
-"Aacute",	/* 0xE7		231 */
-"Edieresis",	/* 0xE8		232 */
-"Egrave",	/* 0xE9		233 */
-"Iacute",	/* 0xEA		234 */
-"Icircumflex",	/* 0xEB		235 */
-"Idieresis",	/* 0xEC		236 */
-"Igrave",	/* 0xED		237 */
-"Oacute",	/* 0xEE		238 */
-"Ocircumflex",	/* 0xEF		239 */
-NULL,		/* 0xF0		240 */
-"Ograve",	/* 0xF1		241 */
-"Uacute",	/* 0xF2		242 */
-"Ucircumflex",	/* 0xF3		243 */
-"Ugrave",	/* 0xF4		244 */
-"dotlessi",	/* 0xF5		245 */
-"circumflex",	/* 0xF6		246 */
-"tilde",	/* 0xF7		247 */
-"macron",	/* 0xF8		248 */
-"breve",	/* 0xF9		249 */
-"dotaccent",	/* 0xFA		250 */
-"ring",		/* 0xFB		251 */
-"cedilla",	/* 0xFC		252 */
-"hungarumlaut",	/* 0xFD		253 */
-"ogonek",	/* 0xFE		254 */
-"caron"		/* 0xFF		255 */
-};
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* macrom_e.h
+ *
+ * MacRoman encoding vector
+ *
+ */
+
+static pdf_encodingvector pdf_macroman = {
+NULL,		/* 0x00		0 */
+NULL,		/* 0x01		1 */
+NULL,		/* 0x02		2 */
+NULL,		/* 0x03		3 */
+NULL,		/* 0x04		4 */
+NULL,		/* 0x05		5 */
+NULL,		/* 0x06		6 */
+NULL,		/* 0x07		7 */
+NULL,		/* 0x08		8 */
+NULL,		/* 0x09		9 */
+NULL,		/* 0x0A		10 */
+NULL,		/* 0x0B		11 */
+NULL,		/* 0x0C		12 */
+NULL,		/* 0x0D		13 */
+NULL,		/* 0x0E		14 */
+NULL,		/* 0x0F		15 */
+NULL,		/* 0x10		16 */
+NULL,		/* 0x11		17 */
+NULL,		/* 0x12		18 */
+NULL,		/* 0x13		19 */
+NULL,		/* 0x14		20 */
+NULL,		/* 0x15		21 */
+NULL,		/* 0x16		22 */
+NULL,		/* 0x17		23 */
+NULL,		/* 0x18		24 */
+NULL,		/* 0x19		25 */
+NULL,		/* 0x1A		26 */
+NULL,		/* 0x1B		27 */
+NULL,		/* 0x1C		28 */
+NULL,		/* 0x1D		29 */
+NULL,		/* 0x1E		30 */
+NULL,		/* 0x1F		31 */
+"space",	/* 0x20		32 */
+"exclam",	/* 0x21		33 */
+"quotedbl",	/* 0x22		34 */
+"numbersign",	/* 0x23		35 */
+"dollar",	/* 0x24		36 */
+"percent",	/* 0x25		37 */
+"ampersand",	/* 0x26		38 */
+"quotesingle",	/* 0x27		39 */
+"parenleft",	/* 0x28		40 */
+"parenright",	/* 0x29		41 */
+"asterisk",	/* 0x2A		42 */
+"plus",		/* 0x2B		43 */
+"comma",	/* 0x2C		44 */
+"hyphen",	/* 0x2D		45 */
+"period",	/* 0x2E		46 */
+"slash",	/* 0x2F		47 */
+"zero",		/* 0x30		48 */
+"one",		/* 0x31		49 */
+"two",		/* 0x32		50 */
+"three",	/* 0x33		51 */
+"four",		/* 0x34		52 */
+"five",		/* 0x35		53 */
+"six",		/* 0x36		54 */
+"seven",	/* 0x37		55 */
+"eight",	/* 0x38		56 */
+"nine",		/* 0x39		57 */
+"colon",	/* 0x3A		58 */
+"semicolon",	/* 0x3B		59 */
+"less",		/* 0x3C		60 */
+"equal",	/* 0x3D		61 */
+"greater",	/* 0x3E		62 */
+"question",	/* 0x3F		63 */
+"at",		/* 0x40		64 */
+"A",		/* 0x41		65 */
+"B",		/* 0x42		66 */
+"C",		/* 0x43		67 */
+"D",		/* 0x44		68 */
+"E",		/* 0x45		69 */
+"F",		/* 0x46		70 */
+"G",		/* 0x47		71 */
+"H",		/* 0x48		72 */
+"I",		/* 0x49		73 */
+"J",		/* 0x4A		74 */
+"K",		/* 0x4B		75 */
+"L",		/* 0x4C		76 */
+"M",		/* 0x4D		77 */
+"N",		/* 0x4E		78 */
+"O",		/* 0x4F		79 */
+"P",		/* 0x50		80 */
+"Q",		/* 0x51		81 */
+"R",		/* 0x52		82 */
+"S",		/* 0x53		83 */
+"T",		/* 0x54		84 */
+"U",		/* 0x55		85 */
+"V",		/* 0x56		86 */
+"W",		/* 0x57		87 */
+"X",		/* 0x58		88 */
+"Y",		/* 0x59		89 */
+"Z",		/* 0x5A		90 */
+"bracketleft",	/* 0x5B		91 */
+"backslash",	/* 0x5C		92 */
+"bracketright",	/* 0x5D		93 */
+"asciicircum",	/* 0x5E		94 */
+"underscore",	/* 0x5F		95 */
+"grave",	/* 0x60		96 */
+"a",		/* 0x61		97 */
+"b",		/* 0x62		98 */
+"c",		/* 0x63		99 */
+"d",		/* 0x64		100 */
+"e",		/* 0x65		101 */
+"f",		/* 0x66		102 */
+"g",		/* 0x67		103 */
+"h",		/* 0x68		104 */
+"i",		/* 0x69		105 */
+"j",		/* 0x6A		106 */
+"k",		/* 0x6B		107 */
+"l",		/* 0x6C		108 */
+"m",		/* 0x6D		109 */
+"n",		/* 0x6E		110 */
+"o",		/* 0x6F		111 */
+"p",		/* 0x70		112 */
+"q",		/* 0x71		113 */
+"r",		/* 0x72		114 */
+"s",		/* 0x73		115 */
+"t",		/* 0x74		116 */
+"u",		/* 0x75		117 */
+"v",		/* 0x76		118 */
+"w",		/* 0x77		119 */
+"x",		/* 0x78		120 */
+"y",		/* 0x79		121 */
+"z",		/* 0x7A		122 */
+"braceleft",	/* 0x7B		123 */
+"bar",		/* 0x7C		124 */
+"braceright",	/* 0x7D		125 */
+"asciitilde",	/* 0x7E		126 */
+NULL,		/* 0x7F		127 */
+"Adieresis",	/* 0x80		128 */
+"Aring",	/* 0x81		129 */
+"Ccedilla",	/* 0x82		130 */
+"Eacute",	/* 0x83		131 */
+"Ntilde",	/* 0x84		132 */
+"Odieresis",	/* 0x85		133 */
+"Udieresis",	/* 0x86		134 */
+"aacute",	/* 0x87		135 */
+"agrave",	/* 0x88		136 */
+"acircumflex",	/* 0x89		137 */
+"adieresis",	/* 0x8A		138 */
+"atilde",	/* 0x8B		139 */
+"aring",	/* 0x8C		140 */
+"ccedilla",	/* 0x8D		141 */
+"eacute",	/* 0x8E		142 */
+"egrave",	/* 0x8F		143 */
+"ecircumflex",	/* 0x90		144 */
+"edieresis",	/* 0x91		145 */
+"iacute",	/* 0x92		146 */
+"igrave",	/* 0x93		147 */
+"icircumflex",	/* 0x94		148 */
+"idieresis",	/* 0x95		149 */
+"ntilde",	/* 0x96		150 */
+"oacute",	/* 0x97		151 */
+"ograve",	/* 0x98		152 */
+"ocircumflex",	/* 0x99		153 */
+"odieresis",	/* 0x9A		154 */
+"otilde",	/* 0x9B		155 */
+"uacute",	/* 0x9C		156 */
+"ugrave",	/* 0x9D		157 */
+"ucircumflex",	/* 0x9E		158 */
+"udieresis",	/* 0x9F		159 */
+"dagger",	/* 0xA0		160 */
+"degree",	/* 0xA1		161 */
+"cent",		/* 0xA2		162 */
+"sterling",	/* 0xA3		163 */
+"section",	/* 0xA4		164 */
+"bullet",	/* 0xA5		165 */
+"paragraph",	/* 0xA6		166 */
+"germandbls",	/* 0xA7		167 */
+"registered",	/* 0xA8		168 */
+"copyright",	/* 0xA9		169 */
+"trademark",	/* 0xAA		170 */
+"acute",	/* 0xAB		171 */
+"dieresis",	/* 0xAC		172 */
+NULL,		/* 0xAD		173 */
+"AE",		/* 0xAE		174 */
+"Oslash",	/* 0xAF		175 */
+NULL,		/* 0xB0		176 */
+"plusminus",	/* 0xB1		177 */
+NULL,		/* 0xB2		178 */
+NULL,		/* 0xB3		179 */
+"yen",		/* 0xB4		180 */
+"mu",		/* 0xB5		181 */
+NULL,		/* 0xB6		182 */
+NULL,		/* 0xB7		183 */
+NULL,		/* 0xB8		184 */
+NULL,		/* 0xB9		185 */
+NULL,		/* 0xBA		186 */
+"ordfeminine",	/* 0xBB		187 */
+"ordmasculine",	/* 0xBC		188 */
+NULL,		/* 0xBD		189 */
+"ae",		/* 0xBE		190 */
+"oslash",	/* 0xBF		191 */
+"questiondown",	/* 0xC0		192 */
+"exclamdown",	/* 0xC1		193 */
+"logicalnot",	/* 0xC2		194 */
+NULL,		/* 0xC3		195 */
+"florin",	/* 0xC4		196 */
+NULL,		/* 0xC5		197 */
+NULL,		/* 0xC6		198 */
+"guillemotleft",/* 0xC7		199 */
+"guillemotright",/* 0xC8	200 */
+"ellipsis",	/* 0xC9		201 */
+"space",	/* 0xCA		202 */
+"Agrave",	/* 0xCB		203 */
+"Atilde",	/* 0xCC		204 */
+"Otilde",	/* 0xCD		205 */
+"OE",		/* 0xCE		206 */
+"oe",		/* 0xCF		207 */
+"endash",	/* 0xD0		208 */
+"emdash",	/* 0xD1		209 */
+"quotedblleft",	/* 0xD2		210 */
+"quotedblright",/* 0xD3		211 */
+"quoteleft",	/* 0xD4		212 */
+"quoteright",	/* 0xD5		213 */
+"divide",	/* 0xD6		214 */
+NULL,		/* 0xD7		215 */
+"ydieresis",	/* 0xD8		216 */
+"Ydieresis",	/* 0xD9		217 */
+"fraction",	/* 0xDA		218 */
+"currency",	/* 0xDB		219 */	/* Euro in MacOS */
+"guilsingleft",	/* 0xDC		220 */
+"guilsingright",/* 0xDD		221 */
+"fi",		/* 0xDE		222 */
+"fl",		/* 0xDF		223 */
+"daggerdbl",	/* 0xE0		224 */
+"periodcentered",/* 0xE1	225 */
+"quotesinglbase",/* 0xE2	226 */
+"quotedblbase",	/* 0xE3		227 */
+"perthousand",	/* 0xE4		228 */
+"Acircumflex",	/* 0xE5		229 */
+"Ecircumflex",	/* 0xE6		230 */
+"Aacute",	/* 0xE7		231 */
+"Edieresis",	/* 0xE8		232 */
+"Egrave",	/* 0xE9		233 */
+"Iacute",	/* 0xEA		234 */
+"Icircumflex",	/* 0xEB		235 */
+"Idieresis",	/* 0xEC		236 */
+"Igrave",	/* 0xED		237 */
+"Oacute",	/* 0xEE		238 */
+"Ocircumflex",	/* 0xEF		239 */
+NULL,		/* 0xF0		240 */
+"Ograve",	/* 0xF1		241 */
+"Uacute",	/* 0xF2		242 */
+"Ucircumflex",	/* 0xF3		243 */
+"Ugrave",	/* 0xF4		244 */
+"dotlessi",	/* 0xF5		245 */
+"circumflex",	/* 0xF6		246 */
+"tilde",	/* 0xF7		247 */
+"macron",	/* 0xF8		248 */
+"breve",	/* 0xF9		249 */
+"dotaccent",	/* 0xFA		250 */
+"ring",		/* 0xFB		251 */
+"cedilla",	/* 0xFC		252 */
+"hungarumlaut",	/* 0xFD		253 */
+"ogonek",	/* 0xFE		254 */
+"caron"		/* 0xFF		255 */
+};
@@ -1,289 +1,580 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* p_draw.c
- *
- * PDFlib drawing routines
- *
- */
-
-#include <stdio.h>
-#include <math.h>
-
-#include "p_intern.h"
-
-/* Path segment operators */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_moveto(PDF *p, float x, float y)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-    (void) fprintf(p->fp,"%s %s m\n", pdf_float(buf1, x), pdf_float(buf2, y));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_lineto(PDF *p, float x, float y)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-    (void) fprintf(p->fp,"%s %s l\n", pdf_float(buf1, x), pdf_float(buf2, y));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_curveto(PDF *p, float x1, float y1, float x2, float y2, float x3, float y3)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-    char buf3[FLOATBUFSIZE], buf4[FLOATBUFSIZE];
-    char buf5[FLOATBUFSIZE], buf6[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-
-    if (x2 == x3 && y2 == y3)	/* second c.p. coincides with final point */
-	(void) fprintf(p->fp,"%s %s %s %s y\n",
-		    pdf_float(buf1, x1), pdf_float(buf2, y1),
-		    pdf_float(buf3, x3), pdf_float(buf4, y3));
-    else			/* general case with four distinct points */
-	(void) fprintf(p->fp,"%s %s %s %s %s %s c\n",
-		    pdf_float(buf1, x1), pdf_float(buf2, y1),
-		    pdf_float(buf3, x2), pdf_float(buf4, y2),
-		    pdf_float(buf5, x3), pdf_float(buf6, y3));
-}
-
-/* Convenience routines */
-
-/* 
- * "Best fit" BCP approximation for an arc segment as suggested
- * by Berthold K.P.Horn. Thanks BKPH!
- */
-
-#define ARC_MAGIC	((float) 0.5523)
-#define MIN(x, y)	((x) < (y) ? (x) : (y))
-
-/* PDF_arc() assumes that the current point is already at the arc's start */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_arc(PDF *p, float x, float y, float r, float alpha, float beta)
-{
-    float bcp;
-    float cos_alpha, cos_beta, sin_alpha, sin_beta;
-
-    if (r < 0)
-	pdf_error(p, PDF_ValueError, "Negative circle radius %f", r);
-    
-    if (beta - alpha > 90.0)
-    {
-	/* cut down in 90 degree segments until done */
-	PDF_arc(p, x, y, r, alpha, MIN(alpha + 90, beta));
-	if (alpha + 90 < beta)
-	    PDF_arc(p, x, y, r, alpha + 90, beta);
-	return;
-    }
-
-    /* speed up special case for quadrants and circles */
-    if ((int) alpha == alpha && (int) beta == beta &&
-    	beta - alpha == 90 && (int) alpha % 90 == 0)
-    {
-	/* prune angle values */
-	alpha = (float) ((int) alpha % 360);
-	beta = (float) ((int) beta % 360);
-
-	switch ((int) alpha) {
-	    case 0:
-		PDF_curveto(p, x + r, y + r*ARC_MAGIC, 
-			x + r*ARC_MAGIC, y + r, x, y + r);
-		break;
-	    case 90:
-		PDF_curveto(p, x - r*ARC_MAGIC, y + r, 
-			x - r, y + r*ARC_MAGIC, x - r, y);
-		break;
-	    case 180:
-		PDF_curveto(p, x - r, y - r*ARC_MAGIC, 
-			x - r*ARC_MAGIC, y - r, x, y - r);
-		break;
-	    case 270:
-		PDF_curveto(p, x + r*ARC_MAGIC, y - r, 
-			x + r, y - r*ARC_MAGIC, x + r, y);
-		break;
-	    default:
-		break;
-	}
-	return;
-    }
-
-    alpha = (float) (alpha * M_PI / 180);		/* convert to radians */
-    beta = (float) (beta * M_PI / 180);		/* convert to radians */
-
-    /* This formula yields ARC_MAGIC for alpha == 0, beta == 90 degrees */
-    bcp = (float) (4/3 * (1 - cos((beta - alpha)/2)) / sin((beta - alpha)/2));
-    
-    sin_alpha = (float) sin(alpha);
-    sin_beta = (float) sin(beta);
-    cos_alpha = (float) cos(alpha);
-    cos_beta = (float) cos(beta);
-
-    PDF_curveto(p, 
-		x + r * (cos_alpha - bcp * sin_alpha),		/* p1 */
-		y + r * (sin_alpha + bcp * cos_alpha),
-		x + r * (cos_beta + bcp * sin_beta),		/* p2 */
-		y + r * (sin_beta - bcp * cos_beta),
-		x + r * cos_beta, y + r * sin_beta);		/* p3 */
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_circle(PDF *p, float x, float y, float r)
-{
-    if (r < 0)
-	pdf_error(p, PDF_ValueError, "Negative circle radius %f", r);
-
-    /* draw four Bezier curves to approximate a circle */
-    PDF_moveto(p, x + r, y);
-    PDF_curveto(p, x + r, y + r*ARC_MAGIC, x + r*ARC_MAGIC, y + r, x, y + r);
-    PDF_curveto(p, x - r*ARC_MAGIC, y + r, x - r, y + r*ARC_MAGIC, x - r, y);
-    PDF_curveto(p, x - r, y - r*ARC_MAGIC, x - r*ARC_MAGIC, y - r, x, y - r);
-    PDF_curveto(p, x + r*ARC_MAGIC, y - r, x + r, y - r*ARC_MAGIC, x + r, y);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_rect(PDF *p, float x, float y, float width, float height)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-    char buf3[FLOATBUFSIZE], buf4[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-
-    (void) fprintf(p->fp,"%s %s %s %s re\n",
-    			pdf_float(buf1, x), pdf_float(buf2, y),
-			pdf_float(buf3, width), pdf_float(buf4, height));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_closepath(PDF *p)
-{
-    pdf_end_text(p);
-
-    (void) fputs("h\n", p->fp);
-}
-
-/* Path painting operators */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_endpath(PDF *p)
-{
-    pdf_end_text(p);
-
-    (void) fputs("n\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_stroke(PDF *p)
-{
-    pdf_end_text(p);
-
-    (void) fputs("S\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_closepath_stroke(PDF *p)
-{
-    pdf_end_text(p);
-
-    (void) fputs("s\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_fill(PDF *p)
-{
-    pdf_end_text(p);
-
-    switch (p->fill_rule) {
-	case pdf_fill_winding:
-	    (void) fputs("f\n", p->fp);
-	    break;
-	case pdf_fill_evenodd:
-	    (void) fputs("f*\n", p->fp);
-	    break;
-	default:
-	    pdf_error(p, PDF_RuntimeError,
-		"Inconsistent fill rule value in PDF_fill");
-	    return;
-    }
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_fill_stroke(PDF *p)
-{
-    pdf_end_text(p);
-
-    switch (p->fill_rule) {
-	case pdf_fill_winding:
-	    (void) fputs("B\n", p->fp);
-	    break;
-	case pdf_fill_evenodd:
-	    (void) fputs("B*\n", p->fp);
-	    break;
-	default:
-	    pdf_error(p, PDF_RuntimeError,
-		"Inconsistent fill rule value in PDF_fill_stroke");
-	    return;
-    }
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_closepath_fill_stroke(PDF *p)
-{
-    pdf_end_text(p);
-
-    switch (p->fill_rule) {
-	case pdf_fill_winding:
-	(void) fputs("b\n", p->fp);
-	break;
-    case pdf_fill_evenodd:
-	(void) fputs("b*\n", p->fp);
-	break;
-    default:
-	pdf_error(p, PDF_RuntimeError,
-	    "Inconsistent fill rule value in PDF_closepath_fill_stroke");
-	return;
-    }
-}
-
-/* Path clipping operators */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_clip(PDF *p)
-{
-    pdf_end_text(p);
-
-    switch (p->fill_rule) {
-	case pdf_fill_winding:
-	(void) fputs("W\n", p->fp);
-    break;
-	case pdf_fill_evenodd:
-	(void) fputs("W*\n", p->fp);
-	break;
-    default:
-	pdf_error(p, PDF_RuntimeError,
-	    "Inconsistent fill rule value in PDF_clip");
-	return;
-    }
-}
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_draw.c
+ *
+ * PDFlib drawing routines
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+
+#include "p_intern.h"
+
+/* Path segment operators */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_moveto(PDF *p, float x, float y)
+{
+    pdf_end_text(p);
+    pdf_printf(p, "%f %f m\n", x, y);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_lineto(PDF *p, float x, float y)
+{
+    pdf_end_text(p);
+    pdf_printf(p, "%f %f l\n", x, y);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_curveto(PDF *p, float x1, float y1, float x2, float y2, float x3, float y3)
+{
+    pdf_end_text(p);
+
+    if (x2 == x3 && y2 == y3)	/* second c.p. coincides with final point */
+	pdf_printf(p, "%f %f %f %f y\n", x1, y1, x3, y3);
+    else			/* general case with four distinct points */
+	pdf_printf(p, "%f %f %f %f %f %f c\n", x1, y1, x2, y2, x3, y3);
+}
+
+/* Convenience routines */
+
+/* 
+ * "Best fit" BCP approximation for an arc segment as suggested
+ * by Berthold K.P.Horn. Thanks BKPH!
+ */
+
+#define ARC_MAGIC	((float) 0.5523)
+#define MIN(x, y)	((x) < (y) ? (x) : (y))
+
+/* PDF_arc() assumes that the current point is already at the arc's start */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_arc(PDF *p, float x, float y, float r, float alpha, float beta)
+{
+    float bcp;
+    float cos_alpha, cos_beta, sin_alpha, sin_beta;
+
+    if (r < 0)
+	pdf_error(p, PDF_ValueError, "Negative circle radius %f", r);
+    
+    if (beta - alpha > 90.0)
+    {
+	/* cut down in 90 degree segments until done */
+	PDF_arc(p, x, y, r, alpha, MIN(alpha + 90, beta));
+	if (alpha + 90 < beta)
+	    PDF_arc(p, x, y, r, alpha + 90, beta);
+	return;
+    }
+
+    /* speed up special case for quadrants and circles */
+    if ((int) alpha == alpha && (int) beta == beta &&
+    	beta - alpha == 90 && (int) alpha % 90 == 0)
+    {
+	/* prune angle values */
+	alpha = (float) ((int) alpha % 360);
+	beta = (float) ((int) beta % 360);
+
+	switch ((int) alpha) {
+	    case 0:
+		PDF_curveto(p, x + r, y + r*ARC_MAGIC, 
+			x + r*ARC_MAGIC, y + r, x, y + r);
+		break;
+	    case 90:
+		PDF_curveto(p, x - r*ARC_MAGIC, y + r, 
+			x - r, y + r*ARC_MAGIC, x - r, y);
+		break;
+	    case 180:
+		PDF_curveto(p, x - r, y - r*ARC_MAGIC, 
+			x - r*ARC_MAGIC, y - r, x, y - r);
+		break;
+	    case 270:
+		PDF_curveto(p, x + r*ARC_MAGIC, y - r, 
+			x + r, y - r*ARC_MAGIC, x + r, y);
+		break;
+	    default:
+		break;
+	}
+	return;
+    }
+
+    alpha = (float) (alpha * M_PI / 180);		/* convert to radians */
+    beta = (float) (beta * M_PI / 180);		/* convert to radians */
+
+    /* This formula yields ARC_MAGIC for alpha == 0, beta == 90 degrees */
+    bcp = (float) (4/3 * (1 - cos((beta - alpha)/2)) / sin((beta - alpha)/2));
+    
+    sin_alpha = (float) sin(alpha);
+    sin_beta = (float) sin(beta);
+    cos_alpha = (float) cos(alpha);
+    cos_beta = (float) cos(beta);
+
+    PDF_curveto(p, 
+		x + r * (cos_alpha - bcp * sin_alpha),		/* p1 */
+		y + r * (sin_alpha + bcp * cos_alpha),
+		x + r * (cos_beta + bcp * sin_beta),		/* p2 */
+		y + r * (sin_beta - bcp * cos_beta),
+		x + r * cos_beta, y + r * sin_beta);		/* p3 */
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_circle(PDF *p, float x, float y, float r)
+{
+    if (r < 0)
+	pdf_error(p, PDF_ValueError, "Negative circle radius %f", r);
+
+    /* draw four Bezier curves to approximate a circle */
+    PDF_moveto(p, x + r, y);
+    PDF_curveto(p, x + r, y + r*ARC_MAGIC, x + r*ARC_MAGIC, y + r, x, y + r);
+    PDF_curveto(p, x - r*ARC_MAGIC, y + r, x - r, y + r*ARC_MAGIC, x - r, y);
+    PDF_curveto(p, x - r, y - r*ARC_MAGIC, x - r*ARC_MAGIC, y - r, x, y - r);
+    PDF_curveto(p, x + r*ARC_MAGIC, y - r, x + r, y - r*ARC_MAGIC, x + r, y);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_rect(PDF *p, float x, float y, float width, float height)
+{
+    pdf_end_text(p);
+
+    pdf_printf(p, "%f %f %f %f re\n", x, y, width, height);
+}
+
+/* Batched path construction */
+
+#define PATH_BUFSIZE	2048
+
+/* Local output buffer for path segments, handed over in large blocks */
+typedef struct {
+    char	buf[PATH_BUFSIZE];
+    char	*cp;
+} pdf_path_buf;
+
+/* Write the dim numbers at v followed by the operator op. pdf_ftoa()
+ * writes less than FLOATBUFSIZE characters for any number, and there
+ * are at most four numbers and three operator characters per segment.
+ */
+static void
+pdf_path_put(PDF *p, pdf_path_buf *b, const float *v, int dim, const char *op)
+{
+    char *cp = b->cp;
+    int k;
+
+    if (cp > b->buf + PATH_BUFSIZE - 4 * (FLOATBUFSIZE + 1) - 4) {
+	pdf_write(p, b->buf, (size_t) (cp - b->buf));
+	cp = b->buf;
+    }
+
+    for (k = 0; k < dim; k++) {
+	cp += pdf_ftoa(cp, (double) v[k]);
+	*cp++ = ' ';
+    }
+
+    while (*op)
+	*cp++ = *op++;
+    *cp++ = '\n';
+
+    b->cp = cp;
+}
+
+static void
+pdf_path_flush(PDF *p, pdf_path_buf *b)
+{
+    if (b->cp > b->buf)
+	pdf_write(p, b->buf, (size_t) (b->cp - b->buf));
+    b->cp = b->buf;
+}
+
+/* Write n groups of dim numbers from v, each followed by an operator:
+ * op1 for the first group and op for all others.
+ */
+static void
+pdf_put_path(PDF *p, const float *v, int n, int dim, const char *op1,
+	const char *op)
+{
+    pdf_path_buf b;
+    int i;
+
+    b.cp = b.buf;
+    for (i = 0; i < n; i++, v += dim)
+	pdf_path_put(p, &b, v, dim, i == 0 ? op1 : op);
+
+    pdf_path_flush(p, &b);
+}
+
+/* Path decimation
+ *
+ * With the "pathresolution" parameter set to the resolution of the output
+ * device, PDF_polyline() and PDF_polygon() drop the points which don't
+ * make a visible difference at this resolution, and PDF_rects() drops the
+ * rectangles outside of the page:
+ *
+ * - Consecutive points which fall into the same pixel column of the page
+ *   are reduced to the first, the lowest, the highest, and the last one.
+ *   Dense data plots (thousands of points per pixel) shrink to a few
+ *   points per pixel column.
+ * - Consecutive points which all lie beyond the same edge of the page
+ *   (widened by the line width) are reduced to the first and the last
+ *   one. The straight line between them lies beyond the same edge, so
+ *   neither stroking nor filling changes on the page.
+ *
+ * Dashed paths are written unchanged since the dash pattern depends on
+ * the exact path length.
+ */
+
+/* Positions of a point relative to the page */
+#define OUT_LEFT	1
+#define OUT_RIGHT	2
+#define OUT_BELOW	4
+#define OUT_ABOVE	8
+
+typedef struct {
+    pdf_path_buf	b;
+    pdf_matrix		ctm;		/* user space to page */
+    double		ppp;		/* pixels per point */
+    double		llx, lly, urx, ury;	/* page widened by margin */
+    const float		*first;		/* current pixel column: */
+    const float		*lo, *hi, *last;	/* points in this column */
+    double		lo_y, hi_y;
+    long		column;
+} pdf_decimator;
+
+static void
+pdf_init_decimator(PDF *p, pdf_decimator *d)
+{
+    pdf_gstate *gs = pdf_gs(p);
+    double norm, margin;
+
+    d->b.cp = d->b.buf;
+    d->ctm = gs->ctm;
+    d->ppp = p->path_resolution / 72.0;
+    d->first = NULL;
+
+    /* half the line width, extended by miter joins, plus one pixel */
+    norm = sqrt(d->ctm.a * d->ctm.a + d->ctm.b * d->ctm.b);
+    if (norm < sqrt(d->ctm.c * d->ctm.c + d->ctm.d * d->ctm.d))
+	norm = sqrt(d->ctm.c * d->ctm.c + d->ctm.d * d->ctm.d);
+    margin = gs->linewidth * norm / 2;
+    if (gs->miterlimit > 1)
+	margin *= gs->miterlimit;
+    margin += 1 / d->ppp;
+
+    d->llx = -margin;
+    d->lly = -margin;
+    d->urx = p->width + margin;
+    d->ury = p->height + margin;
+}
+
+static int
+pdf_outcode(const pdf_decimator *d, double x, double y)
+{
+    return (x < d->llx ? OUT_LEFT : x > d->urx ? OUT_RIGHT : 0) |
+	   (y < d->lly ? OUT_BELOW : y > d->ury ? OUT_ABOVE : 0);
+}
+
+/* Write the points of the current pixel column after its first one */
+static void
+pdf_flush_column(PDF *p, pdf_decimator *d)
+{
+    const float *prev = d->first;
+    const float *v1 = d->lo < d->hi ? d->lo : d->hi;
+    const float *v2 = d->lo < d->hi ? d->hi : d->lo;
+
+    /* later points have higher addresses */
+    if (v1 > prev)
+	pdf_path_put(p, &d->b, prev = v1, 2, "l");
+    if (v2 > prev)
+	pdf_path_put(p, &d->b, prev = v2, 2, "l");
+    if (d->last > prev)
+	pdf_path_put(p, &d->b, d->last, 2, "l");
+}
+
+/* Add the point v with page coordinates (x, y) */
+static void
+pdf_decimate_point(PDF *p, pdf_decimator *d, const float *v, double x,
+	double y)
+{
+    long column = (long) floor(x * d->ppp);
+
+    if (d->first != NULL) {
+	if (column == d->column) {
+	    if (y < d->lo_y) {
+		d->lo = v;
+		d->lo_y = y;
+	    } else if (y > d->hi_y) {
+		d->hi = v;
+		d->hi_y = y;
+	    }
+	    d->last = v;
+	    return;
+	}
+	pdf_flush_column(p, d);
+    }
+
+    pdf_path_put(p, &d->b, v, 2, d->first == NULL ? "m" : "l");
+
+    d->first = d->lo = d->hi = d->last = v;
+    d->lo_y = d->hi_y = y;
+    d->column = column;
+}
+
+static void
+pdf_put_decimated(PDF *p, const float *xy, int n)
+{
+    pdf_decimator d;
+    const float *v, *held = NULL;
+    double x, y, held_x = 0, held_y = 0;
+    int i, code, run = 0;
+
+    pdf_init_decimator(p, &d);
+
+    for (i = 0, v = xy; i < n; i++, v += 2) {
+	x = d.ctm.a * v[0] + d.ctm.c * v[1] + d.ctm.e;
+	y = d.ctm.b * v[0] + d.ctm.d * v[1] + d.ctm.f;
+	code = pdf_outcode(&d, x, y);
+
+	/* inside a run of points beyond the same edge of the page */
+	if (code & run) {
+	    run &= code;
+	    held = v;
+	    held_x = x;
+	    held_y = y;
+	    continue;
+	}
+
+	if (held != NULL) {
+	    pdf_decimate_point(p, &d, held, held_x, held_y);
+	    held = NULL;
+	}
+	pdf_decimate_point(p, &d, v, x, y);
+	run = code;
+    }
+
+    if (held != NULL)
+	pdf_decimate_point(p, &d, held, held_x, held_y);
+    if (d.first != NULL)
+	pdf_flush_column(p, &d);
+
+    pdf_path_flush(p, &d.b);
+}
+
+/* Write the rectangles which may be visible on the page */
+static void
+pdf_put_culled_rects(PDF *p, const float *xywh, int n)
+{
+    pdf_decimator d;
+    const float *v;
+    double x, y;
+    int i, k, code, written = 0;
+
+    pdf_init_decimator(p, &d);
+
+    for (i = 0, v = xywh; i < n; i++, v += 4) {
+	code = OUT_LEFT | OUT_RIGHT | OUT_BELOW | OUT_ABOVE;
+
+	for (k = 0; k < 4 && code != 0; k++) {
+	    x = v[0] + (k & 1 ? v[2] : 0);
+	    y = v[1] + (k & 2 ? v[3] : 0);
+	    code &= pdf_outcode(&d, d.ctm.a * x + d.ctm.c * y + d.ctm.e,
+				    d.ctm.b * x + d.ctm.d * y + d.ctm.f);
+	}
+
+	if (code == 0) {
+	    pdf_path_put(p, &d.b, v, 4, "re");
+	    written++;
+	}
+    }
+
+    /* keep one (invisible) rectangle for the path painting operator */
+    if (written == 0 && n > 0)
+	pdf_path_put(p, &d.b, xywh, 4, "re");
+
+    pdf_path_flush(p, &d.b);
+}
+
+static pdf_bool
+pdf_decimate(PDF *p)
+{
+    return p->path_resolution > 0 &&
+	pdf_gs(p)->dash1 == 0 && pdf_gs(p)->dash2 == 0;
+}
+
+static void
+pdf_check_path_array(PDF *p, const float *v, int n, const char *fn)
+{
+    if (n < 0 || (n > 0 && v == NULL))
+	pdf_error(p, PDF_ValueError, "Bad coordinate array for %s", fn);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_polyline(PDF *p, const float *xy, int n)
+{
+    pdf_check_path_array(p, xy, n, "PDF_polyline");
+
+    pdf_end_text(p);
+
+    if (pdf_decimate(p))
+	pdf_put_decimated(p, xy, n);
+    else
+	pdf_put_path(p, xy, n, 2, "m", "l");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_polygon(PDF *p, const float *xy, int n)
+{
+    pdf_check_path_array(p, xy, n, "PDF_polygon");
+
+    if (n == 0)
+	return;
+
+    pdf_end_text(p);
+
+    if (pdf_decimate(p))
+	pdf_put_decimated(p, xy, n);
+    else
+	pdf_put_path(p, xy, n, 2, "m", "l");
+    pdf_puts(p, "h\n");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_rects(PDF *p, const float *xywh, int n)
+{
+    pdf_check_path_array(p, xywh, n, "PDF_rects");
+
+    pdf_end_text(p);
+
+    if (p->path_resolution > 0)
+	pdf_put_culled_rects(p, xywh, n);
+    else
+	pdf_put_path(p, xywh, n, 4, "re", "re");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_closepath(PDF *p)
+{
+    pdf_end_text(p);
+
+    pdf_puts(p, "h\n");
+}
+
+/* Path painting operators */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_endpath(PDF *p)
+{
+    pdf_end_text(p);
+
+    pdf_puts(p, "n\n");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_stroke(PDF *p)
+{
+    pdf_end_text(p);
+
+    pdf_puts(p, "S\n");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_closepath_stroke(PDF *p)
+{
+    pdf_end_text(p);
+
+    pdf_puts(p, "s\n");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_fill(PDF *p)
+{
+    pdf_end_text(p);
+
+    switch (p->fill_rule) {
+	case pdf_fill_winding:
+	    pdf_puts(p, "f\n");
+	    break;
+	case pdf_fill_evenodd:
+	    pdf_puts(p, "f*\n");
+	    break;
+	default:
+	    pdf_error(p, PDF_RuntimeError,
+		"Inconsistent fill rule value in PDF_fill");
+	    return;
+    }
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_fill_stroke(PDF *p)
+{
+    pdf_end_text(p);
+
+    switch (p->fill_rule) {
+	case pdf_fill_winding:
+	    pdf_puts(p, "B\n");
+	    break;
+	case pdf_fill_evenodd:
+	    pdf_puts(p, "B*\n");
+	    break;
+	default:
+	    pdf_error(p, PDF_RuntimeError,
+		"Inconsistent fill rule value in PDF_fill_stroke");
+	    return;
+    }
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_closepath_fill_stroke(PDF *p)
+{
+    pdf_end_text(p);
+
+    switch (p->fill_rule) {
+	case pdf_fill_winding:
+	pdf_puts(p, "b\n");
+	break;
+    case pdf_fill_evenodd:
+	pdf_puts(p, "b*\n");
+	break;
+    default:
+	pdf_error(p, PDF_RuntimeError,
+	    "Inconsistent fill rule value in PDF_closepath_fill_stroke");
+	return;
+    }
+}
+
+/* Path clipping operators */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_clip(PDF *p)
+{
+    pdf_end_text(p);
+
+    switch (p->fill_rule) {
+	case pdf_fill_winding:
+	pdf_puts(p, "W\n");
+    break;
+	case pdf_fill_evenodd:
+	pdf_puts(p, "W*\n");
+	break;
+    default:
+	pdf_error(p, PDF_RuntimeError,
+	    "Inconsistent fill rule value in PDF_clip");
+	return;
+    }
+}
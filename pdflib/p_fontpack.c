@@ -0,0 +1,735 @@
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_fontpack.c
+ *
+ * PDFlib precompiled font metrics packs
+ *
+ * A metrics pack is a binary file written by compile_metrics which holds
+ * the metrics of any number of fonts, with a ready-made width table for
+ * each encoding. Packs are registered via the "FontPack" resource
+ * category, and loaded without any parsing: the file is read in one go,
+ * and font names and widths are taken directly from the file contents.
+ *
+ * All numbers are 32-bit big-endian integers; offsets are relative to the
+ * start of the file. A string offset of 0 denotes a NULL string.
+ *
+ * header:	magic "%PMP", version, number of fonts, directory offset
+ * directory:	font name offset and record offset for each font,
+ *		sorted by font name
+ * font record:	PACK_RECORDSIZE numbers, see PACK_xxx below
+ * widths:	256 widths for a single encoding
+ * kerning:	name1 offset, name2 offset, x amount, y amount per pair
+ * strings:	NUL-terminated; the file ends with a NUL byte
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "p_intern.h"
+#include "p_afmparse.h"
+
+#define PACK_MAGIC		"%PMP"
+#define PACK_VERSION		1L
+
+/* header */
+#define PACK_HDR_VERSION	4
+#define PACK_HDR_FONTS		8
+#define PACK_HDR_DIRECTORY	12
+#define PACK_HDR_SIZE		16
+
+/* font record: index of each number */
+#define PACK_NAME		0
+#define PACK_FULLNAME		1
+#define PACK_ENCSCHEME		2
+#define PACK_FAMILYNAME		3
+#define PACK_WEIGHT		4
+#define PACK_FLAGS		5
+#define PACK_ITALICANGLE	6	/* in 1/1000 degrees */
+#define PACK_FIXEDPITCH		7
+#define PACK_LLX		8
+#define PACK_LLY		9
+#define PACK_URX		10
+#define PACK_URY		11
+#define PACK_ULPOS		12
+#define PACK_ULTHICKNESS	13
+#define PACK_CAPHEIGHT		14
+#define PACK_XHEIGHT		15
+#define PACK_ASCENDER		16
+#define PACK_DESCENDER		17
+#define PACK_STDVW		18
+#define PACK_STDHW		19
+#define PACK_WIDTHS		20	/* width table offset per encoding */
+#define PACK_PAIRS		(PACK_WIDTHS + PACK_ENCODINGS)
+#define PACK_PAIRS_OFFSET	(PACK_PAIRS + 1)
+#define PACK_RECORDSIZE		(PACK_PAIRS + 2)
+
+#define PACK_ENCODINGS		5	/* builtin ... winansi */
+#define PACK_PAIRSIZE		4
+
+#define PACK_INT(pack, off)	pdf_pack_get((pack)->data + (off))
+
+struct pdf_fontpack_s {
+    pdf_fontpack	*next;		/* next pack in the cache */
+    char		*filename;	/* name of the pack file */
+    unsigned char	*data;		/* file contents */
+    size_t		size;		/* file size */
+    long		fonts_number;	/* number of fonts in the pack */
+    PairKernData	*pairs;		/* kerning pairs of all fonts */
+    long		*font_pairs;	/* index of each font's first pair */
+    int			refcount;	/* number of PDF objects using it */
+    pdf_bool		cached;		/* pack is in the shared cache */
+    pdf_bool		shared;		/* pack has been in the cache */
+};
+
+/* Between PDF_boot() and PDF_shutdown() packs are kept in a process-wide
+ * cache, and shared by all PDF objects with PDFlib's default allocation
+ * routines. Fonts refer to the strings in a pack, so each PDF object
+ * keeps a reference to the packs it used until it is deleted.
+ */
+static pdf_fontpack	*pdf_fontpack_list = NULL;
+static pdf_bool		pdf_fontpack_active = pdf_false;
+
+static long
+pdf_pack_get(const unsigned char *cp)
+{
+    unsigned long val;
+
+    val = ((unsigned long) cp[0] << 24) | ((unsigned long) cp[1] << 16) |
+	  ((unsigned long) cp[2] << 8) | (unsigned long) cp[3];
+
+    /* sign extension for negative metrics */
+    if (val & 0x80000000UL)
+	return -(long) (0xFFFFFFFFUL - val) - 1;
+
+    return (long) val;
+}
+
+static void
+pdf_pack_put(unsigned char *cp, long val)
+{
+    cp[0] = (unsigned char) ((val >> 24) & 0xFF);
+    cp[1] = (unsigned char) ((val >> 16) & 0xFF);
+    cp[2] = (unsigned char) ((val >> 8) & 0xFF);
+    cp[3] = (unsigned char) (val & 0xFF);
+}
+
+/* Check that len bytes at offset off are contained in the pack */
+static pdf_bool
+pdf_pack_valid(pdf_fontpack *pack, long off, long len)
+{
+    return off > 0 && len >= 0 && (size_t) off <= pack->size &&
+	    (size_t) len <= pack->size - (size_t) off;
+}
+
+/* Return a string from the pack. The file ends with a NUL byte, so all
+ * strings are terminated.
+ */
+static char *
+pdf_pack_string(pdf_fontpack *pack, long off)
+{
+    if (off == 0 || !pdf_pack_valid(pack, off, 1))
+	return NULL;
+
+    return (char *) pack->data + off;
+}
+
+static void
+pdf_free_fontpack(PDF *p, pdf_fontpack *pack)
+{
+    void (*freeproc)(PDF *p, void *mem);
+
+    freeproc = p ? p->free : pdf_free;
+
+    if (pack->pairs)
+	freeproc(p, pack->pairs);
+    if (pack->font_pairs)
+	freeproc(p, pack->font_pairs);
+    freeproc(p, pack->data);
+    freeproc(p, pack->filename);
+    freeproc(p, pack);
+}
+
+/* The kerning pairs refer to glyph names in the pack. They are converted
+ * to PairKernData once when the pack is read, so that fonts can point to
+ * them just like to the pairs parsed from an AFM file.
+ */
+static pdf_bool
+pdf_read_pack_pairs(PDF *p, pdf_fontpack *pack, long directory)
+{
+    long	i, j, rec, number, off, total = 0;
+    PairKernData *pkd;
+
+    pack->font_pairs = (long *) p->malloc(p,
+		sizeof(long) * (pack->fonts_number + 1), "pdf_read_pack_pairs");
+
+    for (i = 0; i < pack->fonts_number; i++) {
+	pack->font_pairs[i] = total;
+	rec = PACK_INT(pack, directory + 8 * i + 4);
+	if (!pdf_pack_valid(pack, rec, 4 * PACK_RECORDSIZE))
+	    return pdf_false;
+
+	number = PACK_INT(pack, rec + 4 * PACK_PAIRS);
+	off = PACK_INT(pack, rec + 4 * PACK_PAIRS_OFFSET);
+	if (number < 0 || number > (long) pack->size ||
+	    (number > 0 &&
+	     !pdf_pack_valid(pack, off, 4 * PACK_PAIRSIZE * number)))
+	    return pdf_false;
+	total += number;
+    }
+    pack->font_pairs[i] = total;
+
+    if (total == 0)
+	return pdf_true;
+
+    pack->pairs = (PairKernData *) p->malloc(p,
+		sizeof(PairKernData) * total, "pdf_read_pack_pairs");
+
+    for (i = 0, pkd = pack->pairs; i < pack->fonts_number; i++) {
+	rec = PACK_INT(pack, directory + 8 * i + 4);
+	number = PACK_INT(pack, rec + 4 * PACK_PAIRS);
+	off = PACK_INT(pack, rec + 4 * PACK_PAIRS_OFFSET);
+
+	for (j = 0; j < number; j++, pkd++, off += 4 * PACK_PAIRSIZE) {
+	    pkd->name1 = pdf_pack_string(pack, PACK_INT(pack, off));
+	    pkd->name2 = pdf_pack_string(pack, PACK_INT(pack, off + 4));
+	    pkd->xamt = (int) PACK_INT(pack, off + 8);
+	    pkd->yamt = (int) PACK_INT(pack, off + 12);
+	}
+    }
+
+    return pdf_true;
+}
+
+/* Read a pack file. Returns NULL if the file can't be read or is not a
+ * metrics pack of a version we understand.
+ */
+static pdf_fontpack *
+pdf_read_fontpack(PDF *p, const char *filename)
+{
+    FILE		*fp;
+    pdf_fontpack	*pack;
+    size_t		capacity = FONTPACK_CHUNKSIZE, n;
+    long		directory;
+
+    if ((fp = fopen(filename, READMODE)) == NULL)
+	return NULL;
+
+    pack = (pdf_fontpack *) p->malloc(p, sizeof(pdf_fontpack),
+		"pdf_read_fontpack");
+    pack->data = (unsigned char *) p->malloc(p, capacity,
+		"pdf_read_fontpack");
+    pack->size = 0;
+
+    while ((n = fread(pack->data + pack->size, 1, capacity - pack->size, fp))
+	    > 0) {
+	pack->size += n;
+	if (pack->size == capacity) {
+	    capacity *= 2;
+	    pack->data = (unsigned char *) p->realloc(p, pack->data, capacity,
+			"pdf_read_fontpack");
+	}
+    }
+    fclose(fp);
+
+    pack->filename	= pdf_strdup(p, filename);
+    pack->pairs		= NULL;
+    pack->font_pairs	= NULL;
+    pack->next		= NULL;
+    pack->refcount	= 0;
+    pack->cached	= pdf_false;
+    pack->shared	= pdf_false;
+
+    if (pack->size < PACK_HDR_SIZE + 1 ||
+	strncmp((char *) pack->data, PACK_MAGIC, 4) ||
+	PACK_INT(pack, PACK_HDR_VERSION) != PACK_VERSION ||
+	pack->data[pack->size - 1] != '\0') {
+	pdf_free_fontpack(p, pack);
+	return NULL;
+    }
+
+    pack->fonts_number = PACK_INT(pack, PACK_HDR_FONTS);
+    directory = PACK_INT(pack, PACK_HDR_DIRECTORY);
+
+    if (pack->fonts_number < 0 || pack->fonts_number > (long) pack->size ||
+	!pdf_pack_valid(pack, directory, 8 * pack->fonts_number)) {
+	pdf_free_fontpack(p, pack);
+	return NULL;
+    }
+
+    if (!pdf_read_pack_pairs(p, pack, directory)) {
+	pdf_free_fontpack(p, pack);
+	return NULL;
+    }
+
+    return pack;
+}
+
+/* Remember that p uses pack */
+static void
+pdf_add_fontpack_ref(PDF *p, pdf_fontpack *pack)
+{
+    if (p->fontpacks == NULL) {
+	p->fontpacks_capacity = FONTPACK_REFS_CHUNKSIZE;
+	p->fontpacks = (pdf_fontpack **) p->malloc(p,
+		sizeof(pdf_fontpack *) * p->fontpacks_capacity,
+		"pdf_add_fontpack_ref");
+    } else if (p->fontpacks_number == p->fontpacks_capacity) {
+	p->fontpacks_capacity *= 2;
+	p->fontpacks = (pdf_fontpack **) p->realloc(p, p->fontpacks,
+		sizeof(pdf_fontpack *) * p->fontpacks_capacity,
+		"pdf_add_fontpack_ref");
+    }
+    p->fontpacks[p->fontpacks_number++] = pack;
+}
+
+/* Find or load the pack in filename for p */
+static pdf_fontpack *
+pdf_get_fontpack(PDF *p, const char *filename)
+{
+    pdf_fontpack	*pack, *newpack;
+    pdf_bool		share;
+    int			i;
+
+    for (i = 0; i < p->fontpacks_number; i++)
+	if (!strcmp(p->fontpacks[i]->filename, filename))
+	    return p->fontpacks[i];
+
+    share = pdf_fontpack_active && pdf_default_allocator(p);
+
+    if (share) {
+	pdf_lock();
+	for (pack = pdf_fontpack_list; pack != NULL; pack = pack->next)
+	    if (!strcmp(pack->filename, filename)) {
+		pack->refcount++;
+		break;
+	    }
+	pdf_unlock();
+
+	if (pack != NULL) {
+	    pdf_add_fontpack_ref(p, pack);
+	    return pack;
+	}
+    }
+
+    if ((newpack = pdf_read_fontpack(p, filename)) == NULL)
+	return NULL;
+
+    /* If another thread was faster we use its copy */
+    pack = newpack;
+    if (share) {
+	pdf_lock();
+	for (pack = pdf_fontpack_list; pack != NULL; pack = pack->next)
+	    if (!strcmp(pack->filename, filename))
+		break;
+
+	if (pack == NULL) {
+	    pack = newpack;
+	    pack->cached = pdf_true;
+	    pack->shared = pdf_true;
+	    pack->next = pdf_fontpack_list;
+	    pdf_fontpack_list = pack;
+	    newpack = NULL;
+	}
+	pack->refcount++;
+	pdf_unlock();
+
+	if (newpack)
+	    pdf_free_fontpack(p, newpack);
+    } else
+	pack->refcount++;
+
+    pdf_add_fontpack_ref(p, pack);
+    return pack;
+}
+
+/* Locate fontname in the pack's sorted directory, and return the number
+ * of its directory entry or -1
+ */
+static long
+pdf_find_pack_font(pdf_fontpack *pack, const char *fontname)
+{
+    long	lower = 0, upper = pack->fonts_number - 1, mid, entry;
+    long	directory = PACK_INT(pack, PACK_HDR_DIRECTORY);
+    const char	*name;
+    int		cmp;
+
+    while (lower <= upper) {
+	mid = (lower + upper) / 2;
+	entry = directory + 8 * mid;
+
+	if ((name = pdf_pack_string(pack, PACK_INT(pack, entry))) == NULL)
+	    return -1;
+
+	if ((cmp = strcmp(fontname, name)) == 0)
+	    return mid;
+	else if (cmp < 0)
+	    upper = mid - 1;
+	else
+	    lower = mid + 1;
+    }
+
+    return -1;
+}
+
+pdf_bool
+pdf_get_metrics_pack(PDF *p, pdf_font *font, const char *fontname, pdf_encoding enc, const char *filename)
+{
+    pdf_fontpack	*pack;
+    long		index, rec, widths;
+    int			i;
+
+#define REC(field)	PACK_INT(pack, rec + 4 * (field))
+
+    if ((pack = pdf_get_fontpack(p, filename)) == NULL) {
+	pdf_error(p, PDF_NonfatalError,
+		"Couldn't read font metrics pack %s", filename);
+	return pdf_false;
+    }
+
+    if ((index = pdf_find_pack_font(pack, fontname)) == -1)
+	return pdf_false;
+
+    /* the records have been checked when the pack was read */
+    rec = PACK_INT(pack, PACK_INT(pack, PACK_HDR_DIRECTORY) + 8 * index + 4);
+
+    if ((font->name = pdf_pack_string(pack, REC(PACK_NAME))) == NULL ||
+	(font->encodingScheme = pdf_pack_string(pack, REC(PACK_ENCSCHEME)))
+	    == NULL) {
+	pdf_error(p, PDF_NonfatalError,
+		"Corrupt font metrics pack %s", filename);
+	return pdf_false;
+    }
+
+    if (enc != builtin &&
+    	strcmp(font->encodingScheme, "AdobeStandardEncoding")) {
+	pdf_error(p, PDF_NonfatalError,
+		"Can't reencode Symbol font '%s' (using builtin)", font->name);
+	enc = builtin;
+    }
+
+    /* missing width tables fall back to the builtin encoding */
+    if ((widths = REC(PACK_WIDTHS + (int) enc)) == 0)
+	widths = REC(PACK_WIDTHS + (int) builtin);
+
+    if (!pdf_pack_valid(pack, widths, 4 * 256)) {
+	pdf_error(p, PDF_NonfatalError,
+		"Corrupt font metrics pack %s", filename);
+	return pdf_false;
+    }
+
+    font->encoding		= enc;
+    font->flags			= (unsigned long) REC(PACK_FLAGS);
+    font->afm			= pdf_false;	/* nothing to free */
+    font->fullName		= pdf_pack_string(pack, REC(PACK_FULLNAME));
+    font->familyName		= pdf_pack_string(pack, REC(PACK_FAMILYNAME));
+    font->weight		= pdf_pack_string(pack, REC(PACK_WEIGHT));
+    font->italicAngle		= (float) REC(PACK_ITALICANGLE) / 1000;
+    font->isFixedPitch		= (int) REC(PACK_FIXEDPITCH);
+    font->llx			= (int) REC(PACK_LLX);
+    font->lly			= (int) REC(PACK_LLY);
+    font->urx			= (int) REC(PACK_URX);
+    font->ury			= (int) REC(PACK_URY);
+    font->underlinePosition	= (int) REC(PACK_ULPOS);
+    font->underlineThickness	= (int) REC(PACK_ULTHICKNESS);
+    font->capHeight		= (int) REC(PACK_CAPHEIGHT);
+    font->xHeight		= (int) REC(PACK_XHEIGHT);
+    font->ascender		= (int) REC(PACK_ASCENDER);
+    font->descender		= (int) REC(PACK_DESCENDER);
+    font->StdVW			= (int) REC(PACK_STDVW);
+    font->StdHW			= (int) REC(PACK_STDHW);
+
+    font->numOfChars		= 0;
+    font->cmi			= NULL;
+    font->numOfTracks		= 0;
+    font->tkd			= NULL;
+    font->numOfPairs		= (int) (pack->font_pairs[index + 1] -
+					pack->font_pairs[index]);
+    font->pkd			= font->numOfPairs ?
+					pack->pairs + pack->font_pairs[index] :
+					(PairKernData *) NULL;
+    font->numOfComps		= 0;
+    font->ccd			= NULL;
+    font->shared		= NULL;
+    font->glyph_hash		= NULL;
+    font->glyph_hashsize	= 0;
+    font->kerning		= NULL;
+    font->kerning_size		= 0;
+
+    for (i = 0; i < 256; i++)
+	font->widths[i] = (int) PACK_INT(pack, widths + 4 * i);
+
+#undef REC
+
+    return pdf_true;
+}
+
+/* Release the packs used by p. Only packs which have been in the cache
+ * can be used by other PDF objects, so private packs are released without
+ * taking the lock.
+ */
+void
+pdf_cleanup_fontpacks(PDF *p)
+{
+    pdf_fontpack	*pack;
+    pdf_bool		unused;
+    int			i;
+
+    for (i = 0; i < p->fontpacks_number; i++) {
+	pack = p->fontpacks[i];
+
+	if (!pack->shared) {
+	    pdf_free_fontpack(p, pack);
+	    continue;
+	}
+
+	pdf_lock();
+	unused = (--pack->refcount == 0 && !pack->cached);
+	pdf_unlock();
+
+	/* shared packs are only used with the default allocator */
+	if (unused)
+	    pdf_free_fontpack(p, pack);
+    }
+
+    if (p->fontpacks)
+	p->free(p, p->fontpacks);
+}
+
+void
+pdf_init_fontpack_cache(void)
+{
+    pdf_lock();
+    pdf_fontpack_active = pdf_true;
+    pdf_unlock();
+}
+
+/* Packs which are still in use are freed when they are released */
+void
+pdf_cleanup_fontpack_cache(void)
+{
+    pdf_fontpack *pack, *next;
+
+    pdf_lock();
+    if (!pdf_fontpack_active) {
+	pdf_unlock();
+	return;
+    }
+    pdf_fontpack_active = pdf_false;
+
+    for (pack = pdf_fontpack_list; pack != NULL; pack = next) {
+	next = pack->next;
+	pack->cached = pdf_false;
+	if (pack->refcount == 0)
+	    pdf_free_fontpack(NULL, pack);
+    }
+    pdf_fontpack_list = NULL;
+    pdf_unlock();
+}
+
+/* ----------------------- metrics pack writer ----------------------- */
+
+static int
+pdf_compare_fontnames(const void *a, const void *b)
+{
+    return strcmp((*(const pdf_font * const *) a)->name,
+		  (*(const pdf_font * const *) b)->name);
+}
+
+/* Append a string to the string pool, returning its offset */
+static long
+pdf_pack_add_string(unsigned char *data, long *pos, const char *s)
+{
+    long off = *pos;
+
+    if (s == NULL)
+	return 0;
+
+    if (data)
+	strcpy((char *) data + off, s);
+    *pos += (long) strlen(s) + 1;
+
+    return off;
+}
+
+/* Lay out (data == NULL) or fill in (data != NULL) the pack contents.
+ * Returns the size of the pack.
+ */
+static long
+pdf_pack_layout(unsigned char *data, pdf_font **fonts, int n,
+	int (*widths)[PACK_ENCODINGS][256])
+{
+    long	pos, rec, off[PACK_ENCODINGS], pairs, strings;
+    long	name, fullname, encscheme, familyname, weight;
+    int		i, j, k, e;
+    unsigned char *cp;
+    pdf_font	*font;
+
+    /* fixed-size part: header, directory, and records */
+    pos = PACK_HDR_SIZE + 8L * n + 4L * PACK_RECORDSIZE * n;
+
+    /* width tables, sharing identical tables of a font */
+    for (i = 0; i < n; i++) {
+	rec = PACK_HDR_SIZE + 8L * n + 4L * PACK_RECORDSIZE * i;
+
+	for (e = 0; e < PACK_ENCODINGS; e++) {
+	    for (k = 0; k < e; k++)
+		if (!memcmp(widths[i][k], widths[i][e], sizeof(widths[i][e])))
+		    break;
+
+	    if (k < e) {
+		off[e] = off[k];
+		continue;
+	    }
+	    off[e] = pos;
+	    if (data)
+		for (j = 0; j < 256; j++)
+		    pdf_pack_put(data + pos + 4 * j, (long) widths[i][e][j]);
+	    pos += 4 * 256;
+	}
+
+	if (data)
+	    for (e = 0; e < PACK_ENCODINGS; e++)
+		pdf_pack_put(data + rec + 4 * (PACK_WIDTHS + e), off[e]);
+    }
+
+    /* kerning pairs */
+    pairs = pos;
+    for (i = 0; i < n; i++)
+	pos += 4L * PACK_PAIRSIZE * fonts[i]->numOfPairs;
+
+    /* strings, followed by the final NUL */
+    strings = pos;
+    for (i = 0; i < n; i++) {
+	font = fonts[i];
+	rec = PACK_HDR_SIZE + 8L * n + 4L * PACK_RECORDSIZE * i;
+
+	name = pdf_pack_add_string(data, &strings, font->name);
+	fullname = pdf_pack_add_string(data, &strings, font->fullName);
+	encscheme = pdf_pack_add_string(data, &strings, font->encodingScheme);
+	familyname = pdf_pack_add_string(data, &strings, font->familyName);
+	weight = pdf_pack_add_string(data, &strings, font->weight);
+
+	for (j = 0; j < font->numOfPairs; j++) {
+	    PairKernData *pkd = &font->pkd[j];
+	    long name1 = pdf_pack_add_string(data, &strings, pkd->name1);
+	    long name2 = pdf_pack_add_string(data, &strings, pkd->name2);
+
+	    if (data) {
+		cp = data + pairs + 4 * PACK_PAIRSIZE * j;
+		pdf_pack_put(cp, name1);
+		pdf_pack_put(cp + 4, name2);
+		pdf_pack_put(cp + 8, (long) pkd->xamt);
+		pdf_pack_put(cp + 12, (long) pkd->yamt);
+	    }
+	}
+
+	if (data) {
+#define PUT(field, val)	pdf_pack_put(data + rec + 4 * (field), (long) (val))
+	    PUT(PACK_NAME,		name);
+	    PUT(PACK_FULLNAME,		fullname);
+	    PUT(PACK_ENCSCHEME,		encscheme);
+	    PUT(PACK_FAMILYNAME,	familyname);
+	    PUT(PACK_WEIGHT,		weight);
+	    PUT(PACK_FLAGS,		font->flags & 0xFFFFFFFFUL);
+	    PUT(PACK_ITALICANGLE,	font->italicAngle * 1000 +
+				(font->italicAngle < 0 ? -0.5 : 0.5));
+	    PUT(PACK_FIXEDPITCH,	font->isFixedPitch);
+	    PUT(PACK_LLX,		font->llx);
+	    PUT(PACK_LLY,		font->lly);
+	    PUT(PACK_URX,		font->urx);
+	    PUT(PACK_URY,		font->ury);
+	    PUT(PACK_ULPOS,		font->underlinePosition);
+	    PUT(PACK_ULTHICKNESS,	font->underlineThickness);
+	    PUT(PACK_CAPHEIGHT,		font->capHeight);
+	    PUT(PACK_XHEIGHT,		font->xHeight);
+	    PUT(PACK_ASCENDER,		font->ascender);
+	    PUT(PACK_DESCENDER,		font->descender);
+	    PUT(PACK_STDVW,		font->StdVW);
+	    PUT(PACK_STDHW,		font->StdHW);
+	    PUT(PACK_PAIRS,		font->numOfPairs);
+	    PUT(PACK_PAIRS_OFFSET,	font->numOfPairs ? pairs : 0);
+#undef PUT
+
+	    /* directory entry */
+	    pdf_pack_put(data + PACK_HDR_SIZE + 8 * i, name);
+	    pdf_pack_put(data + PACK_HDR_SIZE + 8 * i + 4, rec);
+	}
+
+	pairs += 4L * PACK_PAIRSIZE * font->numOfPairs;
+    }
+
+    if (data) {
+	memcpy(data, PACK_MAGIC, 4);
+	pdf_pack_put(data + PACK_HDR_VERSION, PACK_VERSION);
+	pdf_pack_put(data + PACK_HDR_FONTS, (long) n);
+	pdf_pack_put(data + PACK_HDR_DIRECTORY, (long) PACK_HDR_SIZE);
+	data[strings] = '\0';
+    }
+
+    return strings + 1;
+}
+
+/* Write the metrics of n fonts parsed from AFM files to a metrics pack.
+ * This is used by the compile_metrics utility.
+ */
+void
+pdf_write_fontpack(PDF *p, FILE *fp, pdf_font *fonts, int n)
+{
+    pdf_font	**sorted;
+    int		(*widths)[PACK_ENCODINGS][256];
+    unsigned char *data;
+    long	size;
+    int		i, e;
+
+    sorted = (pdf_font **) p->malloc(p, sizeof(pdf_font *) * (n + 1),
+		"pdf_write_fontpack");
+    widths = (int (*)[PACK_ENCODINGS][256]) p->malloc(p,
+		sizeof(*widths) * (n + 1), "pdf_write_fontpack");
+
+    for (i = 0; i < n; i++)
+	sorted[i] = &fonts[i];
+
+    qsort(sorted, (size_t) n, sizeof(pdf_font *), pdf_compare_fontnames);
+
+    for (i = 0; i < n; i++) {
+	if (i > 0 && !strcmp(sorted[i - 1]->name, sorted[i]->name))
+	    pdf_error(p, PDF_ValueError,
+		"Font '%s' occurs twice in metrics pack", sorted[i]->name);
+
+	/* symbol fonts can't be reencoded */
+	for (e = 0; e < PACK_ENCODINGS; e++)
+	    pdf_make_widths(sorted[i],
+		strcmp(sorted[i]->encodingScheme, "AdobeStandardEncoding") ?
+		builtin : (pdf_encoding) e, widths[i][e]);
+    }
+
+    size = pdf_pack_layout(NULL, sorted, n, widths);
+    data = (unsigned char *) p->calloc(p, (size_t) size, "pdf_write_fontpack");
+    (void) pdf_pack_layout(data, sorted, n, widths);
+
+    if (fwrite(data, 1, (size_t) size, fp) != (size_t) size)
+	pdf_error(p, PDF_IOError, "Couldn't write font metrics pack");
+
+    p->free(p, data);
+    p->free(p, widths);
+    p->free(p, sorted);
+}
@@ -1,241 +1,338 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* p_gstate.c
- *
- * PDFlib routines dealing with the graphics states
- *
- */
-
-#include <stdio.h>
-#include <math.h>
-#include <string.h>
-
-#include "p_intern.h"
-
-/* Special Graphics State */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_save(PDF *p)
-{
-    pdf_end_text(p);
-    (void) fputs("q\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_restore(PDF *p)
-{
-    pdf_end_text(p);
-    (void) fputs("Q\n", p->fp);
-}
-
-void
-pdf_concat(PDF *p, pdf_matrix m)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE], buf3[FLOATBUFSIZE];
-    char buf4[FLOATBUFSIZE], buf5[FLOATBUFSIZE], buf6[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-    (void) fprintf(p->fp,"%s %s %s %s %s %s cm\n",
-	      pdf_float(buf1, m.a), pdf_float(buf2, m.b), pdf_float(buf3, m.c),
-	      pdf_float(buf4, m.d), pdf_float(buf5, m.e), pdf_float(buf6, m.f));
-}
-
-/* Convenience routines */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_translate(PDF *p, float tx, float ty)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-    (void) fprintf(p->fp,"1 0 0 1 %s %s cm\n",
-	    pdf_float(buf1, tx), pdf_float(buf2, ty));
-
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_scale(PDF *p, float sx, float sy)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    pdf_end_text(p);
-    (void) fprintf(p->fp,"%s 0 0 %s 0 0 cm\n",
-	    pdf_float(buf1, sx), pdf_float(buf2, sy));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_rotate(PDF *p, float phi)
-{
-    float c, s;
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-    char buf3[FLOATBUFSIZE], buf4[FLOATBUFSIZE];
-
-    if (phi == 0)
-	return;
-
-    phi = (float) (phi * M_PI / 180);	/* convert to radians */
-
-    c = (float) cos(phi);
-    s = (float) sin(phi);
-
-    pdf_end_text(p);
-    (void) fprintf(p->fp,"%s %s %s %s 0 0 cm\n",
-	    pdf_float(buf1, c), pdf_float(buf2, s),
-	    pdf_float(buf3, -s), pdf_float(buf4, c));
-}
-
-/* General Graphics State */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setdash(PDF *p, float d1, float d2)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    if (d1 < 0.0 || d2 < 0.0) {
-	pdf_error(p, PDF_NonfatalError, "Negative dash value %f, %f",
-		d1, d2);
-	return;
-    }
-
-    if (d1 == 0.0 && d2 == 0.0)		/* both zero means solid line */
-	(void) fputs("[] 0 d\n", p->fp);
-    else
-	(void) fprintf(p->fp,"[%s %s] 0 d\n",
-		pdf_float(buf1, d1), pdf_float(buf2, d2));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setpolydash(PDF *p, float *darray, int length)
-{
-    char buf[FLOATBUFSIZE];
-
-    int i;
-
-    if (length == 0 || length == 1) {	/* length == 0 or 1 means solid line */
-	(void) fputs("[] 0 d\n", p->fp);
-	return;
-    }
-
-    /* sanity checks */
-    if (length < 0) {
-	pdf_error(p, PDF_NonfatalError, "Negative dash array length %d",
-		length);
-	return;
-    }
-
-    for (i = 0; i < length; i++) {
-	if (darray[i] < 0.0) {
-	    pdf_error(p, PDF_NonfatalError, "Negative dash value %d",
-	    	darray[i]);
-	    return;
-	}
-    }
-
-    (void) fputs("[", p->fp);
-
-    for (i = 0; i < length; i++) {
-	(void) fprintf(p->fp,"%s ", pdf_float(buf, darray[i]));
-    }
-    (void) fputs("] 0 d\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setflat(PDF *p, float flat)
-{
-    char buf[FLOATBUFSIZE];
-
-    if (flat < 0.0 || flat > 100.0) {
-	pdf_error(p, PDF_NonfatalError, "Illegal flat value %f", flat);
-	return;
-    }
-
-    (void) fprintf(p->fp,"%s i\n", pdf_float(buf, flat));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setlinejoin(PDF *p, int join)
-{
-#define LAST_JOIN	2
-	if (join > LAST_JOIN) {
-		pdf_error(p, PDF_NonfatalError, "Bogus line join value %d",
-			join);
-		return;
-	}
-
-    (void) fprintf(p->fp,"%d j\n", join);
-#undef LAST_JOIN
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setlinecap(PDF *p, int cap)
-{
-#define LAST_CAP	2
-	if (cap > LAST_CAP) {
-		pdf_error(p, PDF_NonfatalError, "Bogus line cap value %d",
-			cap);
-		return;
-	}
-
-    (void) fprintf(p->fp,"%d J\n", cap);
-#undef LAST_CAP
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setmiterlimit(PDF *p, float miter)
-{
-    char buf[FLOATBUFSIZE];
-
-    if (miter < 1.0) {
-	pdf_error(p, PDF_NonfatalError, "Bogus miter limit %f", miter);
-	return;
-    }
-
-    (void) fprintf(p->fp,"%s M\n", pdf_float(buf, miter));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_setlinewidth(PDF *p, float width)
-{
-    char buf[FLOATBUFSIZE];
-
-    if (width <= 0.0) {
-	pdf_error(p, PDF_NonfatalError, "Bogus line width %f", width);
-	return;
-    }
-
-    (void) fprintf(p->fp,"%s w\n", pdf_float(buf, width));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_fillrule(PDF *p, const char* fillrule)
-{
-    if (fillrule == NULL) {
-	pdf_error(p, PDF_ValueError, "Null name for fill rule");
-	return;
-    }
-
-    if (!strcmp(fillrule, "winding"))
-	p->fill_rule = pdf_fill_winding;
-    else if (!strcmp(fillrule, "evenodd"))
-	p->fill_rule = pdf_fill_evenodd;
-    else
-	pdf_error(p, PDF_ValueError, "Bogus fill rule '%s'", fillrule);
-}
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_gstate.c
+ *
+ * PDFlib routines dealing with the graphics states
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+#include "p_intern.h"
+
+/* Graphics state tracking
+ *
+ * We always keep track of the current graphics state parameters, and
+ * use this knowledge to suppress operators which wouldn't change anything
+ * if the client enabled the "statetracking" parameter. PDF_save() and
+ * PDF_restore() push and pop the state, just like q and Q do.
+ */
+
+void
+pdf_init_gstate(PDF *p)
+{
+    p->gstate_capacity = GSTATE_CHUNKSIZE;
+    p->gstate = (pdf_gstate *) p->malloc(p,
+	    sizeof(pdf_gstate) * p->gstate_capacity, "pdf_init_gstate");
+    pdf_init_page_gstate(p);
+}
+
+/* Set the initial graphics state of a page as defined in the PDF spec */
+void
+pdf_init_page_gstate(PDF *p)
+{
+    pdf_gstate *gs;
+
+    p->sl = 0;
+    gs = pdf_gs(p);
+
+    gs->fill[0] = gs->fill[1] = gs->fill[2] = (float) 0.0;
+    gs->stroke[0] = gs->stroke[1] = gs->stroke[2] = (float) 0.0;
+    gs->linewidth	= (float) 1.0;
+    gs->dash1		= (float) 0.0;
+    gs->dash2		= (float) 0.0;
+    gs->linejoin	= 0;
+    gs->linecap		= 0;
+    gs->miterlimit	= (float) 10.0;
+    gs->flatness	= (float) -1.0;		/* device-dependent */
+    gs->font		= -1;
+    gs->fontsize	= (float) -1.0;
+    gs->leading		= (float) 0.0;
+    gs->charspacing	= (float) 0.0;
+    gs->wordspacing	= (float) 0.0;
+    gs->horizscaling	= (float) 100.0;
+    gs->textrise	= (float) 0.0;
+    gs->textrendering	= 0;
+
+    gs->ctm.a = gs->ctm.d = (float) 1.0;
+    gs->ctm.b = gs->ctm.c = gs->ctm.e = gs->ctm.f = (float) 0.0;
+
+    p->tm_known = pdf_false;
+}
+
+void
+pdf_cleanup_gstate(PDF *p)
+{
+    if (p->gstate)
+	p->free(p, p->gstate);
+    p->gstate = NULL;
+}
+
+/* Special Graphics State */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_save(PDF *p)
+{
+    if (p->sl + 1 >= p->gstate_capacity) {
+	p->gstate_capacity += GSTATE_CHUNKSIZE;
+	p->gstate = (pdf_gstate *) p->realloc(p, p->gstate,
+		sizeof(pdf_gstate) * p->gstate_capacity, "PDF_save");
+    }
+
+    p->gstate[p->sl + 1] = p->gstate[p->sl];
+    p->sl++;
+
+    pdf_end_text(p);
+    pdf_puts(p, "q\n");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_restore(PDF *p)
+{
+    if (p->sl == 0)
+	pdf_error(p, PDF_NonfatalError, "Unmatched PDF_restore()");
+    else
+	p->sl--;
+
+    pdf_end_text(p);
+    pdf_puts(p, "Q\n");
+}
+
+/* Keep track of the CTM: CTM' = m x CTM */
+static void
+pdf_track_ctm(PDF *p, float a, float b, float c, float d, float e, float f)
+{
+    pdf_matrix *ctm = &pdf_gs(p)->ctm;
+    pdf_matrix old = *ctm;
+
+    ctm->a = a * old.a + b * old.c;
+    ctm->b = a * old.b + b * old.d;
+    ctm->c = c * old.a + d * old.c;
+    ctm->d = c * old.b + d * old.d;
+    ctm->e = e * old.a + f * old.c + old.e;
+    ctm->f = e * old.b + f * old.d + old.f;
+}
+
+void
+pdf_concat(PDF *p, pdf_matrix m)
+{
+    pdf_track_ctm(p, m.a, m.b, m.c, m.d, m.e, m.f);
+
+    pdf_end_text(p);
+    pdf_printf(p, "%f %f %f %f %f %f cm\n", m.a, m.b, m.c, m.d, m.e, m.f);
+}
+
+/* Convenience routines */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_translate(PDF *p, float tx, float ty)
+{
+    pdf_track_ctm(p, 1, 0, 0, 1, tx, ty);
+
+    pdf_end_text(p);
+    pdf_printf(p, "1 0 0 1 %f %f cm\n", tx, ty);
+
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_scale(PDF *p, float sx, float sy)
+{
+    pdf_track_ctm(p, sx, 0, 0, sy, 0, 0);
+
+    pdf_end_text(p);
+    pdf_printf(p, "%f 0 0 %f 0 0 cm\n", sx, sy);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_rotate(PDF *p, float phi)
+{
+    float c, s;
+
+    if (phi == 0)
+	return;
+
+    phi = (float) (phi * M_PI / 180);	/* convert to radians */
+
+    c = (float) cos(phi);
+    s = (float) sin(phi);
+
+    pdf_track_ctm(p, c, s, -s, c, 0, 0);
+
+    pdf_end_text(p);
+    pdf_printf(p, "%f %f %f %f 0 0 cm\n", c, s, -s, c);
+}
+
+/* General Graphics State */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setdash(PDF *p, float d1, float d2)
+{
+    if (d1 < 0.0 || d2 < 0.0) {
+	pdf_error(p, PDF_NonfatalError, "Negative dash value %f, %f",
+		d1, d2);
+	return;
+    }
+
+    if (p->track_state && pdf_gs(p)->dash1 == d1 && pdf_gs(p)->dash2 == d2)
+	return;
+    pdf_gs(p)->dash1 = d1;
+    pdf_gs(p)->dash2 = d2;
+
+    if (d1 == 0.0 && d2 == 0.0)		/* both zero means solid line */
+	pdf_puts(p, "[] 0 d\n");
+    else
+	pdf_printf(p, "[%f %f] 0 d\n", d1, d2);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setpolydash(PDF *p, float *darray, int length)
+{
+    int i;
+
+    if (length == 0 || length == 1) {	/* length == 0 or 1 means solid line */
+	PDF_setdash(p, (float) 0.0, (float) 0.0);
+	return;
+    }
+
+    /* sanity checks */
+    if (length < 0) {
+	pdf_error(p, PDF_NonfatalError, "Negative dash array length %d",
+		length);
+	return;
+    }
+
+    for (i = 0; i < length; i++) {
+	if (darray[i] < 0.0) {
+	    pdf_error(p, PDF_NonfatalError, "Negative dash value %d",
+	    	darray[i]);
+	    return;
+	}
+    }
+
+    /* we don't keep track of dash arrays */
+    pdf_gs(p)->dash1 = pdf_gs(p)->dash2 = (float) -1.0;
+
+    pdf_puts(p, "[");
+
+    for (i = 0; i < length; i++) {
+	pdf_printf(p, "%f ", darray[i]);
+    }
+    pdf_puts(p, "] 0 d\n");
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setflat(PDF *p, float flat)
+{
+    if (flat < 0.0 || flat > 100.0) {
+	pdf_error(p, PDF_NonfatalError, "Illegal flat value %f", flat);
+	return;
+    }
+
+    if (p->track_state && pdf_gs(p)->flatness == flat)
+	return;
+    pdf_gs(p)->flatness = flat;
+
+    pdf_printf(p, "%f i\n", flat);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setlinejoin(PDF *p, int join)
+{
+#define LAST_JOIN	2
+	if (join > LAST_JOIN) {
+		pdf_error(p, PDF_NonfatalError, "Bogus line join value %d",
+			join);
+		return;
+	}
+
+    if (p->track_state && pdf_gs(p)->linejoin == join)
+	return;
+    pdf_gs(p)->linejoin = join;
+
+    pdf_printf(p, "%d j\n", join);
+#undef LAST_JOIN
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setlinecap(PDF *p, int cap)
+{
+#define LAST_CAP	2
+	if (cap > LAST_CAP) {
+		pdf_error(p, PDF_NonfatalError, "Bogus line cap value %d",
+			cap);
+		return;
+	}
+
+    if (p->track_state && pdf_gs(p)->linecap == cap)
+	return;
+    pdf_gs(p)->linecap = cap;
+
+    pdf_printf(p, "%d J\n", cap);
+#undef LAST_CAP
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setmiterlimit(PDF *p, float miter)
+{
+    if (miter < 1.0) {
+	pdf_error(p, PDF_NonfatalError, "Bogus miter limit %f", miter);
+	return;
+    }
+
+    if (p->track_state && pdf_gs(p)->miterlimit == miter)
+	return;
+    pdf_gs(p)->miterlimit = miter;
+
+    pdf_printf(p, "%f M\n", miter);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_setlinewidth(PDF *p, float width)
+{
+    if (width <= 0.0) {
+	pdf_error(p, PDF_NonfatalError, "Bogus line width %f", width);
+	return;
+    }
+
+    if (p->track_state && pdf_gs(p)->linewidth == width)
+	return;
+    pdf_gs(p)->linewidth = width;
+
+    pdf_printf(p, "%f w\n", width);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_fillrule(PDF *p, const char* fillrule)
+{
+    if (fillrule == NULL) {
+	pdf_error(p, PDF_ValueError, "Null name for fill rule");
+	return;
+    }
+
+    if (!strcmp(fillrule, "winding"))
+	p->fill_rule = pdf_fill_winding;
+    else if (!strcmp(fillrule, "evenodd"))
+	p->fill_rule = pdf_fill_evenodd;
+    else
+	pdf_error(p, PDF_ValueError, "Bogus fill rule '%s'", fillrule);
+}
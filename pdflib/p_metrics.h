@@ -1,2097 +1,4394 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* p_metrics.h
- *
- * Built-in font info for the 14 base fonts of PDF.
- * These "in-core" metrics may be extended beyond the base-14 fonts
- * with a supplied utility which generates this source file from an
- * arbitrary number of AFMs.
- *
- * This file contains the metrics for the 14 base fonts for both
- * winansi and macroman encodings. According to the target platform,
- * only one set of metrics will be used:
- *
- * Mac: macroman encoding
- * all other platforms: winansi encoding
- *
- */
-
-#ifndef P_METRICS_H
-#define P_METRICS_H
-
-#ifndef MAC
-
-pdf_font pdf_core_metrics[] = {
-
-/* ---------------------------------------------------------- */
-{	"Courier-Bold",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262177l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier Bold",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Bold",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-113,				/* llx */
-	-250,				/* lly */
-	749,				/* urx */
-	801,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	439,				/* xHeight */
-	626,				/* Ascender */
-	-142,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier-Bold */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Courier-BoldOblique",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262241l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier Bold Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Bold",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-56,				/* llx */
-	-250,				/* lly */
-	868,				/* urx */
-	801,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	439,				/* xHeight */
-	626,				/* Ascender */
-	-142,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier-BoldOblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Courier-Oblique",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	97l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Medium",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-28,				/* llx */
-	-250,				/* lly */
-	742,				/* urx */
-	805,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	426,				/* xHeight */
-	629,				/* Ascender */
-	-157,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier-Oblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Courier",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	33l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-28,				/* llx */
-	-250,				/* lly */
-	628,				/* urx */
-	805,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	426,				/* xHeight */
-	629,				/* Ascender */
-	-157,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica-Bold",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262176l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica Bold",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Bold",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-170,				/* llx */
-	-228,				/* lly */
-	1003,				/* urx */
-	962,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	532,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica-Bold */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
-	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
-	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
-	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
-	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
-	556,	556,	500,	389,	280,	389,	584,	350, /* 0x7f */
-	250,	350,	278,	556,	500,	1000,	556,	556, /* 0x87 */
-	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
-	350,	278,	278,	500,	500,	350,	556,	1000, /* 0x97 */
-	333,	1000,	556,	333,	944,	350,	500,	667, /* 0x9f */
-	278,	333,	556,	556,	556,	556,	280,	556, /* 0xa7 */
-	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
-	400,	584,	333,	333,	333,	611,	556,	278, /* 0xb7 */
-	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
-	722,	722,	722,	722,	722,	722,	1000,	722, /* 0xc7 */
-	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
-	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
-	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
-	556,	556,	556,	556,	556,	556,	889,	556, /* 0xe7 */
-	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
-	611,	611,	611,	611,	611,	611,	611,	584, /* 0xf7 */
-	611,	611,	611,	611,	611,	556,	611,	556  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica-BoldOblique",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262240l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica Bold Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Bold",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-174,				/* llx */
-	-228,				/* lly */
-	1114,				/* urx */
-	962,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	532,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica-BoldOblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
-	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
-	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
-	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
-	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
-	556,	556,	500,	389,	280,	389,	584,	350, /* 0x7f */
-	250,	350,	278,	556,	500,	1000,	556,	556, /* 0x87 */
-	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
-	350,	278,	278,	500,	500,	350,	556,	1000, /* 0x97 */
-	333,	1000,	556,	333,	944,	350,	500,	667, /* 0x9f */
-	278,	333,	556,	556,	556,	556,	280,	556, /* 0xa7 */
-	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
-	400,	584,	333,	333,	333,	611,	556,	278, /* 0xb7 */
-	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
-	722,	722,	722,	722,	722,	722,	1000,	722, /* 0xc7 */
-	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
-	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
-	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
-	556,	556,	556,	556,	556,	556,	889,	556, /* 0xe7 */
-	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
-	611,	611,	611,	611,	611,	611,	611,	584, /* 0xf7 */
-	611,	611,	611,	611,	611,	556,	611,	556  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica-Oblique",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	96l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Medium",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-170,				/* llx */
-	-225,				/* lly */
-	1116,				/* urx */
-	931,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	523,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica-Oblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
-	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
-	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
-	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
-	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
-	500,	500,	500,	334,	260,	334,	584,	350, /* 0x7f */
-	250,	350,	222,	556,	333,	1000,	556,	556, /* 0x87 */
-	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
-	350,	222,	222,	333,	333,	350,	556,	1000, /* 0x97 */
-	333,	1000,	500,	333,	944,	350,	500,	667, /* 0x9f */
-	278,	333,	556,	556,	556,	556,	260,	556, /* 0xa7 */
-	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
-	400,	584,	333,	333,	333,	556,	537,	278, /* 0xb7 */
-	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
-	667,	667,	667,	667,	667,	667,	1000,	722, /* 0xc7 */
-	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
-	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
-	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
-	556,	556,	556,	556,	556,	556,	889,	500, /* 0xe7 */
-	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
-	556,	556,	556,	556,	556,	556,	556,	584, /* 0xf7 */
-	611,	556,	556,	556,	556,	500,	556,	500  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	32l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-166,				/* llx */
-	-225,				/* lly */
-	1000,				/* urx */
-	931,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	523,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
-	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
-	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
-	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
-	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
-	500,	500,	500,	334,	260,	334,	584,	350, /* 0x7f */
-	250,	350,	222,	556,	333,	1000,	556,	556, /* 0x87 */
-	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
-	350,	222,	222,	333,	333,	350,	556,	1000, /* 0x97 */
-	333,	1000,	500,	333,	944,	350,	500,	667, /* 0x9f */
-	278,	333,	556,	556,	556,	556,	260,	556, /* 0xa7 */
-	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
-	400,	584,	333,	333,	333,	556,	537,	278, /* 0xb7 */
-	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
-	667,	667,	667,	667,	667,	667,	1000,	722, /* 0xc7 */
-	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
-	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
-	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
-	556,	556,	556,	556,	556,	556,	889,	500, /* 0xe7 */
-	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
-	556,	556,	556,	556,	556,	556,	556,	584, /* 0xf7 */
-	611,	556,	556,	556,	556,	500,	556,	500  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Symbol",			/* FontName */
-	builtin,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	4l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Symbol",			/* Full name */
-	"FontSpecific",		/* Native encoding */
-	"Symbol",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-180,				/* llx */
-	-293,				/* lly */
-	1090,				/* urx */
-	1010,				/* ury */
-	-98,				/* UnderlinePosition */
-	54,				/* UnderlineThickness */
-	700,				/* CapHeight */
-	523,				/* xHeight */
-	800,				/* Ascender */
-	-200,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Symbol */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	713,	500,	549,	833,	778,	439, /* 0x27 */
-	333,	333,	500,	549,	250,	549,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	278,	278,	549,	549,	549,	444, /* 0x3f */
-	549,	722,	667,	722,	612,	611,	763,	603, /* 0x47 */
-	722,	333,	631,	722,	686,	889,	722,	722, /* 0x4f */
-	768,	741,	556,	592,	611,	690,	439,	768, /* 0x57 */
-	645,	795,	611,	333,	863,	333,	658,	500, /* 0x5f */
-	500,	631,	549,	549,	494,	439,	521,	411, /* 0x67 */
-	603,	329,	603,	549,	549,	576,	521,	549, /* 0x6f */
-	549,	521,	549,	603,	439,	576,	713,	686, /* 0x77 */
-	493,	686,	494,	480,	200,	480,	549,	250, /* 0x7f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
-	250,	620,	247,	549,	167,	713,	500,	753, /* 0xa7 */
-	753,	753,	753,	1042,	987,	603,	987,	603, /* 0xaf */
-	400,	549,	411,	549,	549,	713,	494,	460, /* 0xb7 */
-	549,	549,	549,	549,	1000,	603,	1000,	658, /* 0xbf */
-	823,	686,	795,	987,	768,	768,	823,	768, /* 0xc7 */
-	768,	713,	713,	713,	713,	713,	713,	713, /* 0xcf */
-	768,	713,	790,	790,	890,	823,	549,	250, /* 0xd7 */
-	713,	603,	603,	1042,	987,	603,	987,	603, /* 0xdf */
-	494,	329,	790,	790,	786,	713,	384,	384, /* 0xe7 */
-	384,	384,	384,	384,	494,	494,	494,	494, /* 0xef */
-	250,	329,	274,	686,	686,	686,	384,	384, /* 0xf7 */
-	384,	384,	384,	384,	494,	494,	494,	250  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-Bold",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262176l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Bold",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Bold",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-168,				/* llx */
-	-218,				/* lly */
-	1000,				/* urx */
-	935,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	676,				/* CapHeight */
-	461,				/* xHeight */
-	676,				/* Ascender */
-	-205,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-Bold */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	555,	500,	500,	1000,	833,	278, /* 0x27 */
-	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
-	930,	722,	667,	722,	722,	667,	611,	778, /* 0x47 */
-	778,	389,	500,	778,	667,	944,	722,	778, /* 0x4f */
-	611,	778,	722,	556,	667,	722,	722,	1000, /* 0x57 */
-	722,	722,	667,	333,	278,	333,	581,	500, /* 0x5f */
-	333,	500,	556,	444,	556,	444,	333,	500, /* 0x67 */
-	556,	278,	333,	556,	278,	833,	556,	500, /* 0x6f */
-	556,	556,	444,	389,	333,	556,	500,	722, /* 0x77 */
-	500,	500,	444,	394,	220,	394,	520,	350, /* 0x7f */
-	250,	350,	333,	500,	500,	1000,	500,	500, /* 0x87 */
-	333,	1000,	556,	333,	1000,	350,	667,	350, /* 0x8f */
-	350,	333,	333,	500,	500,	350,	500,	1000, /* 0x97 */
-	333,	1000,	389,	333,	722,	350,	444,	722, /* 0x9f */
-	250,	333,	500,	500,	500,	500,	220,	500, /* 0xa7 */
-	333,	747,	300,	500,	570,	333,	747,	333, /* 0xaf */
-	400,	570,	300,	300,	333,	556,	540,	250, /* 0xb7 */
-	333,	300,	330,	500,	750,	750,	750,	500, /* 0xbf */
-	722,	722,	722,	722,	722,	722,	1000,	722, /* 0xc7 */
-	667,	667,	667,	667,	389,	389,	389,	389, /* 0xcf */
-	722,	722,	778,	778,	778,	778,	778,	570, /* 0xd7 */
-	778,	722,	722,	722,	722,	722,	611,	556, /* 0xdf */
-	500,	500,	500,	500,	500,	500,	722,	444, /* 0xe7 */
-	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
-	500,	556,	500,	500,	500,	500,	500,	570, /* 0xf7 */
-	500,	556,	556,	556,	556,	500,	556,	500  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-BoldItalic",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262240l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Bold Italic",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Bold",				/* Weight */
-	(float) -15.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-200,				/* llx */
-	-218,				/* lly */
-	996,				/* urx */
-	921,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	669,				/* CapHeight */
-	462,				/* xHeight */
-	699,				/* Ascender */
-	-205,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-BoldItalic */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	389,	555,	500,	500,	833,	778,	278, /* 0x27 */
-	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
-	832,	667,	667,	667,	722,	667,	667,	722, /* 0x47 */
-	778,	389,	500,	667,	611,	889,	722,	722, /* 0x4f */
-	611,	722,	667,	556,	611,	722,	667,	889, /* 0x57 */
-	667,	611,	611,	333,	278,	333,	570,	500, /* 0x5f */
-	333,	500,	500,	444,	500,	444,	333,	500, /* 0x67 */
-	556,	278,	278,	500,	278,	778,	556,	500, /* 0x6f */
-	500,	500,	389,	389,	278,	556,	444,	667, /* 0x77 */
-	500,	444,	389,	348,	220,	348,	570,	350, /* 0x7f */
-	250,	350,	333,	500,	500,	1000,	500,	500, /* 0x87 */
-	333,	1000,	556,	333,	944,	350,	611,	350, /* 0x8f */
-	350,	333,	333,	500,	500,	350,	500,	1000, /* 0x97 */
-	333,	1000,	389,	333,	722,	350,	389,	611, /* 0x9f */
-	250,	389,	500,	500,	500,	500,	220,	500, /* 0xa7 */
-	333,	747,	266,	500,	606,	333,	747,	333, /* 0xaf */
-	400,	570,	300,	300,	333,	576,	500,	250, /* 0xb7 */
-	333,	300,	300,	500,	750,	750,	750,	500, /* 0xbf */
-	667,	667,	667,	667,	667,	667,	944,	667, /* 0xc7 */
-	667,	667,	667,	667,	389,	389,	389,	389, /* 0xcf */
-	722,	722,	722,	722,	722,	722,	722,	570, /* 0xd7 */
-	722,	722,	722,	722,	722,	611,	611,	500, /* 0xdf */
-	500,	500,	500,	500,	500,	500,	722,	444, /* 0xe7 */
-	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
-	500,	556,	500,	500,	500,	500,	500,	570, /* 0xf7 */
-	500,	556,	556,	556,	556,	444,	500,	444  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-Italic",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	96l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Italic",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Medium",				/* Weight */
-	(float) -15.5,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-169,				/* llx */
-	-217,				/* lly */
-	1010,				/* urx */
-	883,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	653,				/* CapHeight */
-	441,				/* xHeight */
-	683,				/* Ascender */
-	-205,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-Italic */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	420,	500,	500,	833,	778,	214, /* 0x27 */
-	333,	333,	500,	675,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	333,	333,	675,	675,	675,	500, /* 0x3f */
-	920,	611,	611,	667,	722,	611,	611,	722, /* 0x47 */
-	722,	333,	444,	667,	556,	833,	667,	722, /* 0x4f */
-	611,	722,	611,	500,	556,	722,	611,	833, /* 0x57 */
-	611,	556,	556,	389,	278,	389,	422,	500, /* 0x5f */
-	333,	500,	500,	444,	500,	444,	278,	500, /* 0x67 */
-	500,	278,	278,	444,	278,	722,	500,	500, /* 0x6f */
-	500,	500,	389,	389,	278,	500,	444,	667, /* 0x77 */
-	444,	444,	389,	400,	275,	400,	541,	350, /* 0x7f */
-	250,	350,	333,	500,	556,	889,	500,	500, /* 0x87 */
-	333,	1000,	500,	333,	944,	350,	556,	350, /* 0x8f */
-	350,	333,	333,	556,	556,	350,	500,	889, /* 0x97 */
-	333,	980,	389,	333,	667,	350,	389,	556, /* 0x9f */
-	250,	389,	500,	500,	500,	500,	275,	500, /* 0xa7 */
-	333,	760,	276,	500,	675,	333,	760,	333, /* 0xaf */
-	400,	675,	300,	300,	333,	500,	523,	250, /* 0xb7 */
-	333,	300,	310,	500,	750,	750,	750,	500, /* 0xbf */
-	611,	611,	611,	611,	611,	611,	889,	667, /* 0xc7 */
-	611,	611,	611,	611,	333,	333,	333,	333, /* 0xcf */
-	722,	667,	722,	722,	722,	722,	722,	675, /* 0xd7 */
-	722,	722,	722,	722,	722,	556,	611,	500, /* 0xdf */
-	500,	500,	500,	500,	500,	500,	667,	444, /* 0xe7 */
-	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
-	500,	500,	500,	500,	500,	500,	500,	675, /* 0xf7 */
-	500,	500,	500,	500,	500,	444,	500,	444  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-Roman",			/* FontName */
-	winansi,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	32l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Roman",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Roman",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-168,				/* llx */
-	-218,				/* lly */
-	1000,				/* urx */
-	898,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	662,				/* CapHeight */
-	450,				/* xHeight */
-	683,				/* Ascender */
-	-217,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-Roman */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	408,	500,	500,	833,	778,	180, /* 0x27 */
-	333,	333,	500,	564,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	278,	278,	564,	564,	564,	444, /* 0x3f */
-	921,	722,	667,	667,	722,	611,	556,	722, /* 0x47 */
-	722,	333,	389,	722,	611,	889,	722,	722, /* 0x4f */
-	556,	722,	667,	556,	611,	722,	722,	944, /* 0x57 */
-	722,	722,	611,	333,	278,	333,	469,	500, /* 0x5f */
-	333,	444,	500,	444,	500,	444,	333,	500, /* 0x67 */
-	500,	278,	278,	500,	278,	778,	500,	500, /* 0x6f */
-	500,	500,	333,	389,	278,	500,	500,	722, /* 0x77 */
-	500,	500,	444,	480,	200,	480,	541,	350, /* 0x7f */
-	250,	350,	333,	500,	444,	1000,	500,	500, /* 0x87 */
-	333,	1000,	556,	333,	889,	350,	611,	350, /* 0x8f */
-	350,	333,	333,	444,	444,	350,	500,	1000, /* 0x97 */
-	333,	980,	389,	333,	722,	350,	444,	722, /* 0x9f */
-	250,	333,	500,	500,	500,	500,	200,	500, /* 0xa7 */
-	333,	760,	276,	500,	564,	333,	760,	333, /* 0xaf */
-	400,	564,	300,	300,	333,	500,	453,	250, /* 0xb7 */
-	333,	300,	310,	500,	750,	750,	750,	444, /* 0xbf */
-	722,	722,	722,	722,	722,	722,	889,	667, /* 0xc7 */
-	611,	611,	611,	611,	333,	333,	333,	333, /* 0xcf */
-	722,	722,	722,	722,	722,	722,	722,	564, /* 0xd7 */
-	722,	722,	722,	722,	722,	722,	556,	500, /* 0xdf */
-	444,	444,	444,	444,	444,	444,	667,	444, /* 0xe7 */
-	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
-	500,	500,	500,	500,	500,	500,	500,	564, /* 0xf7 */
-	500,	500,	500,	500,	500,	500,	500,	500  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"ZapfDingbats",			/* FontName */
-	builtin,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	4l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"ITC Zapf Dingbats",			/* Full name */
-	"FontSpecific",		/* Native encoding */
-	"ITC Zapf Dingbats",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-1,				/* llx */
-	-143,				/* lly */
-	981,				/* urx */
-	820,				/* ury */
-	-98,				/* UnderlinePosition */
-	54,				/* UnderlineThickness */
-	700,				/* CapHeight */
-	450,				/* xHeight */
-	800,				/* Ascender */
-	-200,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font ZapfDingbats */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	974,	961,	974,	980,	719,	789,	790, /* 0x27 */
-	791,	690,	960,	939,	549,	855,	911,	933, /* 0x2f */
-	911,	945,	974,	755,	846,	762,	761,	571, /* 0x37 */
-	677,	763,	760,	759,	754,	494,	552,	537, /* 0x3f */
-	577,	692,	786,	788,	788,	790,	793,	794, /* 0x47 */
-	816,	823,	789,	841,	823,	833,	816,	831, /* 0x4f */
-	923,	744,	723,	749,	790,	792,	695,	776, /* 0x57 */
-	768,	792,	759,	707,	708,	682,	701,	826, /* 0x5f */
-	815,	789,	789,	707,	687,	696,	689,	786, /* 0x67 */
-	787,	713,	791,	785,	791,	873,	761,	762, /* 0x6f */
-	762,	759,	759,	892,	892,	788,	784,	438, /* 0x77 */
-	138,	277,	415,	392,	392,	668,	668,	250, /* 0x7f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
-	250,	732,	544,	544,	910,	667,	760,	760, /* 0xa7 */
-	776,	595,	694,	626,	788,	788,	788,	788, /* 0xaf */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xb7 */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xbf */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xc7 */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xcf */
-	788,	788,	788,	788,	894,	838,	1016,	458, /* 0xd7 */
-	748,	924,	748,	918,	927,	928,	928,	834, /* 0xdf */
-	873,	828,	924,	924,	917,	930,	931,	463, /* 0xe7 */
-	883,	836,	836,	867,	867,	696,	696,	874, /* 0xef */
-	250,	874,	760,	946,	771,	865,	771,	888, /* 0xf7 */
-	967,	888,	831,	873,	927,	970,	918,	250  /* 0xff */
-}
-}
-};
-
-#else /* MAC */
-
-pdf_font pdf_core_metrics[] = {
-
-/* ---------------------------------------------------------- */
-{	"Courier-Bold",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262177l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier Bold",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Bold",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-113,				/* llx */
-	-250,				/* lly */
-	749,				/* urx */
-	801,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	439,				/* xHeight */
-	626,				/* Ascender */
-	-142,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier-Bold */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
-	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
-	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
-	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
-	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Courier-BoldOblique",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262241l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier Bold Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Bold",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-56,				/* llx */
-	-250,				/* lly */
-	868,				/* urx */
-	801,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	439,				/* xHeight */
-	626,				/* Ascender */
-	-142,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier-BoldOblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
-	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
-	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
-	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
-	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Courier-Oblique",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	97l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Medium",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-28,				/* llx */
-	-250,				/* lly */
-	742,				/* urx */
-	805,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	426,				/* xHeight */
-	629,				/* Ascender */
-	-157,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier-Oblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
-	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
-	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
-	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
-	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Courier",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	33l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Courier",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Courier",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	1,				/* isFixedPitch */
-	-28,				/* llx */
-	-250,				/* lly */
-	628,				/* urx */
-	805,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	562,				/* CapHeight */
-	426,				/* xHeight */
-	629,				/* Ascender */
-	-157,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Courier */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
-	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
-	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
-	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
-	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
-	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
-	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
-	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
-	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
-	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica-Bold",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262176l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica Bold",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Bold",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-170,				/* llx */
-	-228,				/* lly */
-	1003,				/* urx */
-	962,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	532,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica-Bold */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
-	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
-	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
-	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
-	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
-	556,	556,	500,	389,	280,	389,	584,	250, /* 0x7f */
-	722,	722,	722,	667,	722,	778,	722,	556, /* 0x87 */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x8f */
-	556,	556,	278,	278,	278,	278,	611,	611, /* 0x97 */
-	611,	611,	611,	611,	611,	611,	611,	611, /* 0x9f */
-	556,	400,	556,	556,	556,	350,	556,	611, /* 0xa7 */
-	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
-	250,	584,	250,	250,	556,	611,	250,	250, /* 0xb7 */
-	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
-	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
-	556,	1000,	278,	722,	722,	778,	1000,	944, /* 0xcf */
-	556,	1000,	500,	500,	278,	278,	584,	250, /* 0xd7 */
-	556,	667,	167,	556,	250,	250,	611,	611, /* 0xdf */
-	556,	278,	278,	500,	1000,	722,	667,	722, /* 0xe7 */
-	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
-	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica-BoldOblique",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262240l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica Bold Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Bold",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-174,				/* llx */
-	-228,				/* lly */
-	1114,				/* urx */
-	962,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	532,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica-BoldOblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
-	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
-	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
-	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
-	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
-	556,	556,	500,	389,	280,	389,	584,	250, /* 0x7f */
-	722,	722,	722,	667,	722,	778,	722,	556, /* 0x87 */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x8f */
-	556,	556,	278,	278,	278,	278,	611,	611, /* 0x97 */
-	611,	611,	611,	611,	611,	611,	611,	611, /* 0x9f */
-	556,	400,	556,	556,	556,	350,	556,	611, /* 0xa7 */
-	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
-	250,	584,	250,	250,	556,	611,	250,	250, /* 0xb7 */
-	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
-	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
-	556,	1000,	278,	722,	722,	778,	1000,	944, /* 0xcf */
-	556,	1000,	500,	500,	278,	278,	584,	250, /* 0xd7 */
-	556,	667,	167,	556,	250,	250,	611,	611, /* 0xdf */
-	556,	278,	278,	500,	1000,	722,	667,	722, /* 0xe7 */
-	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
-	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica-Oblique",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	96l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica Oblique",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Medium",				/* Weight */
-	(float) -12.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-170,				/* llx */
-	-225,				/* lly */
-	1116,				/* urx */
-	931,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	523,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica-Oblique */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
-	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
-	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
-	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
-	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
-	500,	500,	500,	334,	260,	334,	584,	250, /* 0x7f */
-	667,	667,	722,	667,	722,	778,	722,	556, /* 0x87 */
-	556,	556,	556,	556,	556,	500,	556,	556, /* 0x8f */
-	556,	556,	278,	278,	278,	278,	556,	556, /* 0x97 */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x9f */
-	556,	400,	556,	556,	556,	350,	537,	611, /* 0xa7 */
-	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
-	250,	584,	250,	250,	556,	556,	250,	250, /* 0xb7 */
-	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
-	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
-	556,	1000,	278,	667,	667,	778,	1000,	944, /* 0xcf */
-	556,	1000,	333,	333,	222,	222,	584,	250, /* 0xd7 */
-	500,	667,	167,	556,	250,	250,	500,	500, /* 0xdf */
-	556,	278,	222,	333,	1000,	667,	667,	667, /* 0xe7 */
-	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
-	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Helvetica",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	32l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Helvetica",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Helvetica",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-166,				/* llx */
-	-225,				/* lly */
-	1000,				/* urx */
-	931,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	718,				/* CapHeight */
-	523,				/* xHeight */
-	718,				/* Ascender */
-	-207,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Helvetica */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
-	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
-	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
-	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
-	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
-	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
-	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
-	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
-	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
-	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
-	500,	500,	500,	334,	260,	334,	584,	250, /* 0x7f */
-	667,	667,	722,	667,	722,	778,	722,	556, /* 0x87 */
-	556,	556,	556,	556,	556,	500,	556,	556, /* 0x8f */
-	556,	556,	278,	278,	278,	278,	556,	556, /* 0x97 */
-	556,	556,	556,	556,	556,	556,	556,	556, /* 0x9f */
-	556,	400,	556,	556,	556,	350,	537,	611, /* 0xa7 */
-	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
-	250,	584,	250,	250,	556,	556,	250,	250, /* 0xb7 */
-	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
-	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
-	556,	1000,	278,	667,	667,	778,	1000,	944, /* 0xcf */
-	556,	1000,	333,	333,	222,	222,	584,	250, /* 0xd7 */
-	500,	667,	167,	556,	250,	250,	500,	500, /* 0xdf */
-	556,	278,	222,	333,	1000,	667,	667,	667, /* 0xe7 */
-	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
-	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Symbol",			/* FontName */
-	builtin,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	4l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Symbol",			/* Full name */
-	"FontSpecific",		/* Native encoding */
-	"Symbol",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-180,				/* llx */
-	-293,				/* lly */
-	1090,				/* urx */
-	1010,				/* ury */
-	-98,				/* UnderlinePosition */
-	54,				/* UnderlineThickness */
-	700,				/* CapHeight */
-	523,				/* xHeight */
-	800,				/* Ascender */
-	-200,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Symbol */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	713,	500,	549,	833,	778,	439, /* 0x27 */
-	333,	333,	500,	549,	250,	549,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	278,	278,	549,	549,	549,	444, /* 0x3f */
-	549,	722,	667,	722,	612,	611,	763,	603, /* 0x47 */
-	722,	333,	631,	722,	686,	889,	722,	722, /* 0x4f */
-	768,	741,	556,	592,	611,	690,	439,	768, /* 0x57 */
-	645,	795,	611,	333,	863,	333,	658,	500, /* 0x5f */
-	500,	631,	549,	549,	494,	439,	521,	411, /* 0x67 */
-	603,	329,	603,	549,	549,	576,	521,	549, /* 0x6f */
-	549,	521,	549,	603,	439,	576,	713,	686, /* 0x77 */
-	493,	686,	494,	480,	200,	480,	549,	250, /* 0x7f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
-	250,	620,	247,	549,	167,	713,	500,	753, /* 0xa7 */
-	753,	753,	753,	1042,	987,	603,	987,	603, /* 0xaf */
-	400,	549,	411,	549,	549,	713,	494,	460, /* 0xb7 */
-	549,	549,	549,	549,	1000,	603,	1000,	658, /* 0xbf */
-	823,	686,	795,	987,	768,	768,	823,	768, /* 0xc7 */
-	768,	713,	713,	713,	713,	713,	713,	713, /* 0xcf */
-	768,	713,	790,	790,	890,	823,	549,	250, /* 0xd7 */
-	713,	603,	603,	1042,	987,	603,	987,	603, /* 0xdf */
-	494,	329,	790,	790,	786,	713,	384,	384, /* 0xe7 */
-	384,	384,	384,	384,	494,	494,	494,	494, /* 0xef */
-	250,	329,	274,	686,	686,	686,	384,	384, /* 0xf7 */
-	384,	384,	384,	384,	494,	494,	494,	250  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-Bold",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262176l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Bold",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Bold",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-168,				/* llx */
-	-218,				/* lly */
-	1000,				/* urx */
-	935,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	676,				/* CapHeight */
-	461,				/* xHeight */
-	676,				/* Ascender */
-	-205,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-Bold */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	555,	500,	500,	1000,	833,	278, /* 0x27 */
-	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
-	930,	722,	667,	722,	722,	667,	611,	778, /* 0x47 */
-	778,	389,	500,	778,	667,	944,	722,	778, /* 0x4f */
-	611,	778,	722,	556,	667,	722,	722,	1000, /* 0x57 */
-	722,	722,	667,	333,	278,	333,	581,	500, /* 0x5f */
-	333,	500,	556,	444,	556,	444,	333,	500, /* 0x67 */
-	556,	278,	333,	556,	278,	833,	556,	500, /* 0x6f */
-	556,	556,	444,	389,	333,	556,	500,	722, /* 0x77 */
-	500,	500,	444,	394,	220,	394,	520,	250, /* 0x7f */
-	722,	722,	722,	667,	722,	778,	722,	500, /* 0x87 */
-	500,	500,	500,	500,	500,	444,	444,	444, /* 0x8f */
-	444,	444,	278,	278,	278,	278,	556,	500, /* 0x97 */
-	500,	500,	500,	500,	556,	556,	556,	556, /* 0x9f */
-	500,	400,	500,	500,	500,	350,	540,	556, /* 0xa7 */
-	747,	747,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
-	250,	570,	250,	250,	500,	556,	250,	250, /* 0xb7 */
-	250,	250,	250,	300,	330,	250,	722,	500, /* 0xbf */
-	500,	333,	570,	250,	500,	250,	250,	500, /* 0xc7 */
-	500,	1000,	250,	722,	722,	778,	1000,	722, /* 0xcf */
-	500,	1000,	500,	500,	333,	333,	570,	250, /* 0xd7 */
-	500,	722,	167,	500,	250,	250,	556,	556, /* 0xdf */
-	500,	250,	333,	500,	1000,	722,	667,	722, /* 0xe7 */
-	667,	667,	389,	389,	389,	389,	778,	778, /* 0xef */
-	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-BoldItalic",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	262240l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Bold Italic",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Bold",				/* Weight */
-	(float) -15.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-200,				/* llx */
-	-218,				/* lly */
-	996,				/* urx */
-	921,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	669,				/* CapHeight */
-	462,				/* xHeight */
-	699,				/* Ascender */
-	-205,				/* Descender */
-	130,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-BoldItalic */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	389,	555,	500,	500,	833,	778,	278, /* 0x27 */
-	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
-	832,	667,	667,	667,	722,	667,	667,	722, /* 0x47 */
-	778,	389,	500,	667,	611,	889,	722,	722, /* 0x4f */
-	611,	722,	667,	556,	611,	722,	667,	889, /* 0x57 */
-	667,	611,	611,	333,	278,	333,	570,	500, /* 0x5f */
-	333,	500,	500,	444,	500,	444,	333,	500, /* 0x67 */
-	556,	278,	278,	500,	278,	778,	556,	500, /* 0x6f */
-	500,	500,	389,	389,	278,	556,	444,	667, /* 0x77 */
-	500,	444,	389,	348,	220,	348,	570,	250, /* 0x7f */
-	667,	667,	667,	667,	722,	722,	722,	500, /* 0x87 */
-	500,	500,	500,	500,	500,	444,	444,	444, /* 0x8f */
-	444,	444,	278,	278,	278,	278,	556,	500, /* 0x97 */
-	500,	500,	500,	500,	556,	556,	556,	556, /* 0x9f */
-	500,	400,	500,	500,	500,	350,	500,	500, /* 0xa7 */
-	747,	747,	1000,	333,	333,	250,	944,	722, /* 0xaf */
-	250,	570,	250,	250,	500,	576,	250,	250, /* 0xb7 */
-	250,	250,	250,	266,	300,	250,	722,	500, /* 0xbf */
-	500,	389,	606,	250,	500,	250,	250,	500, /* 0xc7 */
-	500,	1000,	250,	667,	667,	722,	944,	722, /* 0xcf */
-	500,	1000,	500,	500,	333,	333,	570,	250, /* 0xd7 */
-	444,	611,	167,	500,	250,	250,	556,	556, /* 0xdf */
-	500,	250,	333,	500,	1000,	667,	667,	667, /* 0xe7 */
-	667,	667,	389,	389,	389,	389,	722,	722, /* 0xef */
-	250,	722,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-Italic",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	96l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Italic",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Medium",				/* Weight */
-	(float) -15.5,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-169,				/* llx */
-	-217,				/* lly */
-	1010,				/* urx */
-	883,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	653,				/* CapHeight */
-	441,				/* xHeight */
-	683,				/* Ascender */
-	-205,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-Italic */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	420,	500,	500,	833,	778,	214, /* 0x27 */
-	333,	333,	500,	675,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	333,	333,	675,	675,	675,	500, /* 0x3f */
-	920,	611,	611,	667,	722,	611,	611,	722, /* 0x47 */
-	722,	333,	444,	667,	556,	833,	667,	722, /* 0x4f */
-	611,	722,	611,	500,	556,	722,	611,	833, /* 0x57 */
-	611,	556,	556,	389,	278,	389,	422,	500, /* 0x5f */
-	333,	500,	500,	444,	500,	444,	278,	500, /* 0x67 */
-	500,	278,	278,	444,	278,	722,	500,	500, /* 0x6f */
-	500,	500,	389,	389,	278,	500,	444,	667, /* 0x77 */
-	444,	444,	389,	400,	275,	400,	541,	250, /* 0x7f */
-	611,	611,	667,	611,	667,	722,	722,	500, /* 0x87 */
-	500,	500,	500,	500,	500,	444,	444,	444, /* 0x8f */
-	444,	444,	278,	278,	278,	278,	500,	500, /* 0x97 */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x9f */
-	500,	400,	500,	500,	500,	350,	523,	500, /* 0xa7 */
-	760,	760,	980,	333,	333,	250,	889,	722, /* 0xaf */
-	250,	675,	250,	250,	500,	500,	250,	250, /* 0xb7 */
-	250,	250,	250,	276,	310,	250,	667,	500, /* 0xbf */
-	500,	389,	675,	250,	500,	250,	250,	500, /* 0xc7 */
-	500,	889,	250,	611,	611,	722,	944,	667, /* 0xcf */
-	500,	889,	556,	556,	333,	333,	675,	250, /* 0xd7 */
-	444,	556,	167,	500,	250,	250,	500,	500, /* 0xdf */
-	500,	250,	333,	556,	1000,	611,	611,	611, /* 0xe7 */
-	611,	611,	333,	333,	333,	333,	722,	722, /* 0xef */
-	250,	722,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"Times-Roman",			/* FontName */
-	macroman,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	32l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"Times Roman",			/* Full name */
-	"AdobeStandardEncoding",		/* Native encoding */
-	"Times",			/* Family name */
-	"Roman",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-168,				/* llx */
-	-218,				/* lly */
-	1000,				/* urx */
-	898,				/* ury */
-	-100,				/* UnderlinePosition */
-	50,				/* UnderlineThickness */
-	662,				/* CapHeight */
-	450,				/* xHeight */
-	683,				/* Ascender */
-	-217,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font Times-Roman */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	250,	333,	408,	500,	500,	833,	778,	180, /* 0x27 */
-	333,	333,	500,	564,	250,	333,	250,	278, /* 0x2f */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
-	500,	500,	278,	278,	564,	564,	564,	444, /* 0x3f */
-	921,	722,	667,	667,	722,	611,	556,	722, /* 0x47 */
-	722,	333,	389,	722,	611,	889,	722,	722, /* 0x4f */
-	556,	722,	667,	556,	611,	722,	722,	944, /* 0x57 */
-	722,	722,	611,	333,	278,	333,	469,	500, /* 0x5f */
-	333,	444,	500,	444,	500,	444,	333,	500, /* 0x67 */
-	500,	278,	278,	500,	278,	778,	500,	500, /* 0x6f */
-	500,	500,	333,	389,	278,	500,	500,	722, /* 0x77 */
-	500,	500,	444,	480,	200,	480,	541,	250, /* 0x7f */
-	722,	722,	667,	611,	722,	722,	722,	444, /* 0x87 */
-	444,	444,	444,	444,	444,	444,	444,	444, /* 0x8f */
-	444,	444,	278,	278,	278,	278,	500,	500, /* 0x97 */
-	500,	500,	500,	500,	500,	500,	500,	500, /* 0x9f */
-	500,	400,	500,	500,	500,	350,	453,	500, /* 0xa7 */
-	760,	760,	980,	333,	333,	250,	889,	722, /* 0xaf */
-	250,	564,	250,	250,	500,	500,	250,	250, /* 0xb7 */
-	250,	250,	250,	276,	310,	250,	667,	500, /* 0xbf */
-	444,	333,	564,	250,	500,	250,	250,	500, /* 0xc7 */
-	500,	1000,	250,	722,	722,	722,	889,	722, /* 0xcf */
-	500,	1000,	444,	444,	333,	333,	564,	250, /* 0xd7 */
-	500,	722,	167,	500,	250,	250,	556,	556, /* 0xdf */
-	500,	250,	333,	444,	1000,	722,	611,	722, /* 0xe7 */
-	611,	611,	333,	333,	333,	333,	722,	722, /* 0xef */
-	250,	722,	722,	722,	722,	278,	333,	333, /* 0xf7 */
-	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
-}
-},
-
-/* ---------------------------------------------------------- */
-{	"ZapfDingbats",			/* FontName */
-	builtin,			/* Encoding */
-	0,				/* used on current page */
-	0,				/* embed flag */
-	(char *) NULL,			/* Name of external font file */
-	0L,				/* Object id */
-	4l,			/* Font flags */
-	pdf_false,			/* Read from AFM file */
-	"ITC Zapf Dingbats",			/* Full name */
-	"FontSpecific",		/* Native encoding */
-	"ITC Zapf Dingbats",			/* Family name */
-	"Medium",				/* Weight */
-	(float) 0.0,			/* ItalicAngle */
-	0,				/* isFixedPitch */
-	-1,				/* llx */
-	-143,				/* lly */
-	981,				/* urx */
-	820,				/* ury */
-	-98,				/* UnderlinePosition */
-	54,				/* UnderlineThickness */
-	700,				/* CapHeight */
-	450,				/* xHeight */
-	800,				/* Ascender */
-	-200,				/* Descender */
-	75,				/* StdVW */
-	0,				/* StdHW */
-
-	0,				/* numOfChars */
-	(CharMetricInfo *) NULL,	/* cmi */
-	0,				/* numOfTracks */
-	(TrackKernData *) NULL,		/* tkd */
-	0,				/* numOfPairs */
-	(PairKernData *) NULL,		/* pkd */
-	0,				/* numOfComps */
-	(CompCharData *) NULL,		/* ccd */
-
-/* Character metrics for font ZapfDingbats */
-{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
-	278,	974,	961,	974,	980,	719,	789,	790, /* 0x27 */
-	791,	690,	960,	939,	549,	855,	911,	933, /* 0x2f */
-	911,	945,	974,	755,	846,	762,	761,	571, /* 0x37 */
-	677,	763,	760,	759,	754,	494,	552,	537, /* 0x3f */
-	577,	692,	786,	788,	788,	790,	793,	794, /* 0x47 */
-	816,	823,	789,	841,	823,	833,	816,	831, /* 0x4f */
-	923,	744,	723,	749,	790,	792,	695,	776, /* 0x57 */
-	768,	792,	759,	707,	708,	682,	701,	826, /* 0x5f */
-	815,	789,	789,	707,	687,	696,	689,	786, /* 0x67 */
-	787,	713,	791,	785,	791,	873,	761,	762, /* 0x6f */
-	762,	759,	759,	892,	892,	788,	784,	438, /* 0x77 */
-	138,	277,	415,	392,	392,	668,	668,	250, /* 0x7f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
-	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
-	250,	732,	544,	544,	910,	667,	760,	760, /* 0xa7 */
-	776,	595,	694,	626,	788,	788,	788,	788, /* 0xaf */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xb7 */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xbf */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xc7 */
-	788,	788,	788,	788,	788,	788,	788,	788, /* 0xcf */
-	788,	788,	788,	788,	894,	838,	1016,	458, /* 0xd7 */
-	748,	924,	748,	918,	927,	928,	928,	834, /* 0xdf */
-	873,	828,	924,	924,	917,	930,	931,	463, /* 0xe7 */
-	883,	836,	836,	867,	867,	696,	696,	874, /* 0xef */
-	250,	874,	760,	946,	771,	865,	771,	888, /* 0xf7 */
-	967,	888,	831,	873,	927,	970,	918,	250  /* 0xff */
-}
-}
-};
-
-#endif /* MAC */
-
-#define SIZEOF_CORE_METRICS	(sizeof(pdf_core_metrics)/sizeof(pdf_font))
-#endif /* P_METRICS_H */
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_metrics.h
+ *
+ * Built-in font info for the 14 base fonts of PDF.
+ * These "in-core" metrics may be extended beyond the base-14 fonts
+ * with a supplied utility which generates this source file from an
+ * arbitrary number of AFMs.
+ *
+ * This file contains the metrics for the 14 base fonts for both
+ * winansi and macroman encodings. According to the target platform,
+ * only one set of metrics will be used:
+ *
+ * Mac: macroman encoding
+ * all other platforms: winansi encoding
+ *
+ */
+
+#ifndef P_METRICS_H
+#define P_METRICS_H
+
+/* The kerning pairs don't depend on the encoding, and are shared by the
+ * entries of both metrics sets below.
+ */
+
+/* Kerning pairs for font Helvetica-Bold */
+static PairKernData pdf_pairs_Helvetica_Bold[] = {
+    { "A",	"y",	-30,	0 },
+    { "A",	"w",	-30,	0 },
+    { "A",	"v",	-40,	0 },
+    { "A",	"u",	-30,	0 },
+    { "A",	"Y",	-110,	0 },
+    { "A",	"W",	-60,	0 },
+    { "A",	"V",	-80,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-90,	0 },
+    { "A",	"Q",	-40,	0 },
+    { "A",	"O",	-40,	0 },
+    { "A",	"G",	-50,	0 },
+    { "A",	"C",	-40,	0 },
+    { "B",	"U",	-10,	0 },
+    { "B",	"A",	-30,	0 },
+    { "D",	"period",	-30,	0 },
+    { "D",	"comma",	-30,	0 },
+    { "D",	"Y",	-70,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-40,	0 },
+    { "D",	"A",	-40,	0 },
+    { "F",	"period",	-100,	0 },
+    { "F",	"comma",	-100,	0 },
+    { "F",	"a",	-20,	0 },
+    { "F",	"A",	-80,	0 },
+    { "J",	"u",	-20,	0 },
+    { "J",	"period",	-20,	0 },
+    { "J",	"comma",	-20,	0 },
+    { "J",	"A",	-20,	0 },
+    { "K",	"y",	-40,	0 },
+    { "K",	"u",	-30,	0 },
+    { "K",	"o",	-35,	0 },
+    { "K",	"e",	-15,	0 },
+    { "K",	"O",	-30,	0 },
+    { "L",	"y",	-30,	0 },
+    { "L",	"quoteright",	-140,	0 },
+    { "L",	"quotedblright",	-140,	0 },
+    { "L",	"Y",	-120,	0 },
+    { "L",	"W",	-80,	0 },
+    { "L",	"V",	-110,	0 },
+    { "L",	"T",	-90,	0 },
+    { "O",	"period",	-40,	0 },
+    { "O",	"comma",	-40,	0 },
+    { "O",	"Y",	-70,	0 },
+    { "O",	"X",	-50,	0 },
+    { "O",	"W",	-50,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-50,	0 },
+    { "P",	"period",	-120,	0 },
+    { "P",	"o",	-40,	0 },
+    { "P",	"e",	-30,	0 },
+    { "P",	"comma",	-120,	0 },
+    { "P",	"a",	-30,	0 },
+    { "P",	"A",	-100,	0 },
+    { "Q",	"period",	20,	0 },
+    { "Q",	"comma",	20,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-50,	0 },
+    { "R",	"W",	-40,	0 },
+    { "R",	"V",	-50,	0 },
+    { "R",	"U",	-20,	0 },
+    { "R",	"T",	-20,	0 },
+    { "R",	"O",	-20,	0 },
+    { "T",	"y",	-60,	0 },
+    { "T",	"w",	-60,	0 },
+    { "T",	"u",	-90,	0 },
+    { "T",	"semicolon",	-40,	0 },
+    { "T",	"r",	-80,	0 },
+    { "T",	"period",	-80,	0 },
+    { "T",	"o",	-80,	0 },
+    { "T",	"hyphen",	-120,	0 },
+    { "T",	"e",	-60,	0 },
+    { "T",	"comma",	-80,	0 },
+    { "T",	"colon",	-40,	0 },
+    { "T",	"a",	-80,	0 },
+    { "T",	"O",	-40,	0 },
+    { "T",	"A",	-90,	0 },
+    { "U",	"period",	-30,	0 },
+    { "U",	"comma",	-30,	0 },
+    { "U",	"A",	-50,	0 },
+    { "V",	"u",	-60,	0 },
+    { "V",	"semicolon",	-40,	0 },
+    { "V",	"period",	-120,	0 },
+    { "V",	"o",	-90,	0 },
+    { "V",	"hyphen",	-80,	0 },
+    { "V",	"e",	-50,	0 },
+    { "V",	"comma",	-120,	0 },
+    { "V",	"colon",	-40,	0 },
+    { "V",	"a",	-60,	0 },
+    { "V",	"O",	-50,	0 },
+    { "V",	"G",	-50,	0 },
+    { "V",	"A",	-80,	0 },
+    { "W",	"y",	-20,	0 },
+    { "W",	"u",	-45,	0 },
+    { "W",	"semicolon",	-10,	0 },
+    { "W",	"period",	-80,	0 },
+    { "W",	"o",	-60,	0 },
+    { "W",	"hyphen",	-40,	0 },
+    { "W",	"e",	-35,	0 },
+    { "W",	"comma",	-80,	0 },
+    { "W",	"colon",	-10,	0 },
+    { "W",	"a",	-40,	0 },
+    { "W",	"O",	-20,	0 },
+    { "W",	"A",	-60,	0 },
+    { "Y",	"u",	-100,	0 },
+    { "Y",	"semicolon",	-50,	0 },
+    { "Y",	"period",	-100,	0 },
+    { "Y",	"o",	-100,	0 },
+    { "Y",	"e",	-80,	0 },
+    { "Y",	"comma",	-100,	0 },
+    { "Y",	"colon",	-50,	0 },
+    { "Y",	"a",	-90,	0 },
+    { "Y",	"O",	-70,	0 },
+    { "Y",	"A",	-110,	0 },
+    { "a",	"y",	-20,	0 },
+    { "a",	"w",	-15,	0 },
+    { "a",	"v",	-15,	0 },
+    { "a",	"g",	-10,	0 },
+    { "b",	"y",	-20,	0 },
+    { "b",	"v",	-20,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"l",	-10,	0 },
+    { "c",	"y",	-10,	0 },
+    { "c",	"l",	-20,	0 },
+    { "c",	"k",	-20,	0 },
+    { "c",	"h",	-10,	0 },
+    { "colon",	"space",	-40,	0 },
+    { "comma",	"space",	-40,	0 },
+    { "comma",	"quoteright",	-120,	0 },
+    { "comma",	"quotedblright",	-120,	0 },
+    { "d",	"y",	-15,	0 },
+    { "d",	"w",	-15,	0 },
+    { "d",	"v",	-15,	0 },
+    { "d",	"d",	-10,	0 },
+    { "e",	"y",	-15,	0 },
+    { "e",	"x",	-15,	0 },
+    { "e",	"w",	-15,	0 },
+    { "e",	"v",	-15,	0 },
+    { "e",	"period",	20,	0 },
+    { "e",	"comma",	10,	0 },
+    { "f",	"quoteright",	30,	0 },
+    { "f",	"quotedblright",	30,	0 },
+    { "f",	"period",	-10,	0 },
+    { "f",	"o",	-20,	0 },
+    { "f",	"e",	-10,	0 },
+    { "f",	"comma",	-10,	0 },
+    { "g",	"g",	-10,	0 },
+    { "g",	"e",	10,	0 },
+    { "h",	"y",	-20,	0 },
+    { "k",	"o",	-15,	0 },
+    { "l",	"y",	-15,	0 },
+    { "l",	"w",	-15,	0 },
+    { "m",	"y",	-30,	0 },
+    { "m",	"u",	-20,	0 },
+    { "n",	"y",	-20,	0 },
+    { "n",	"v",	-40,	0 },
+    { "n",	"u",	-10,	0 },
+    { "o",	"y",	-20,	0 },
+    { "o",	"x",	-30,	0 },
+    { "o",	"w",	-15,	0 },
+    { "o",	"v",	-20,	0 },
+    { "p",	"y",	-15,	0 },
+    { "period",	"space",	-40,	0 },
+    { "period",	"quoteright",	-120,	0 },
+    { "period",	"quotedblright",	-120,	0 },
+    { "quotedblright",	"space",	-80,	0 },
+    { "quoteleft",	"quoteleft",	-46,	0 },
+    { "quoteright",	"v",	-20,	0 },
+    { "quoteright",	"space",	-80,	0 },
+    { "quoteright",	"s",	-60,	0 },
+    { "quoteright",	"r",	-40,	0 },
+    { "quoteright",	"quoteright",	-46,	0 },
+    { "quoteright",	"l",	-20,	0 },
+    { "quoteright",	"d",	-80,	0 },
+    { "r",	"y",	10,	0 },
+    { "r",	"v",	10,	0 },
+    { "r",	"t",	20,	0 },
+    { "r",	"s",	-15,	0 },
+    { "r",	"q",	-20,	0 },
+    { "r",	"period",	-60,	0 },
+    { "r",	"o",	-20,	0 },
+    { "r",	"hyphen",	-20,	0 },
+    { "r",	"g",	-15,	0 },
+    { "r",	"d",	-20,	0 },
+    { "r",	"comma",	-60,	0 },
+    { "r",	"c",	-20,	0 },
+    { "s",	"w",	-15,	0 },
+    { "semicolon",	"space",	-40,	0 },
+    { "space",	"quoteleft",	-60,	0 },
+    { "space",	"quotedblleft",	-80,	0 },
+    { "space",	"Y",	-120,	0 },
+    { "space",	"W",	-80,	0 },
+    { "space",	"V",	-80,	0 },
+    { "space",	"T",	-100,	0 },
+    { "v",	"period",	-80,	0 },
+    { "v",	"o",	-30,	0 },
+    { "v",	"comma",	-80,	0 },
+    { "v",	"a",	-20,	0 },
+    { "w",	"period",	-40,	0 },
+    { "w",	"o",	-20,	0 },
+    { "w",	"comma",	-40,	0 },
+    { "x",	"e",	-10,	0 },
+    { "y",	"period",	-80,	0 },
+    { "y",	"o",	-25,	0 },
+    { "y",	"e",	-10,	0 },
+    { "y",	"comma",	-80,	0 },
+    { "y",	"a",	-30,	0 },
+    { "z",	"e",	10,	0 }
+};
+
+/* Kerning pairs for font Helvetica-BoldOblique */
+static PairKernData pdf_pairs_Helvetica_BoldOblique[] = {
+    { "A",	"y",	-30,	0 },
+    { "A",	"w",	-30,	0 },
+    { "A",	"v",	-40,	0 },
+    { "A",	"u",	-30,	0 },
+    { "A",	"Y",	-110,	0 },
+    { "A",	"W",	-60,	0 },
+    { "A",	"V",	-80,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-90,	0 },
+    { "A",	"Q",	-40,	0 },
+    { "A",	"O",	-40,	0 },
+    { "A",	"G",	-50,	0 },
+    { "A",	"C",	-40,	0 },
+    { "B",	"U",	-10,	0 },
+    { "B",	"A",	-30,	0 },
+    { "D",	"period",	-30,	0 },
+    { "D",	"comma",	-30,	0 },
+    { "D",	"Y",	-70,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-40,	0 },
+    { "D",	"A",	-40,	0 },
+    { "F",	"period",	-100,	0 },
+    { "F",	"comma",	-100,	0 },
+    { "F",	"a",	-20,	0 },
+    { "F",	"A",	-80,	0 },
+    { "J",	"u",	-20,	0 },
+    { "J",	"period",	-20,	0 },
+    { "J",	"comma",	-20,	0 },
+    { "J",	"A",	-20,	0 },
+    { "K",	"y",	-40,	0 },
+    { "K",	"u",	-30,	0 },
+    { "K",	"o",	-35,	0 },
+    { "K",	"e",	-15,	0 },
+    { "K",	"O",	-30,	0 },
+    { "L",	"y",	-30,	0 },
+    { "L",	"quoteright",	-140,	0 },
+    { "L",	"quotedblright",	-140,	0 },
+    { "L",	"Y",	-120,	0 },
+    { "L",	"W",	-80,	0 },
+    { "L",	"V",	-110,	0 },
+    { "L",	"T",	-90,	0 },
+    { "O",	"period",	-40,	0 },
+    { "O",	"comma",	-40,	0 },
+    { "O",	"Y",	-70,	0 },
+    { "O",	"X",	-50,	0 },
+    { "O",	"W",	-50,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-50,	0 },
+    { "P",	"period",	-120,	0 },
+    { "P",	"o",	-40,	0 },
+    { "P",	"e",	-30,	0 },
+    { "P",	"comma",	-120,	0 },
+    { "P",	"a",	-30,	0 },
+    { "P",	"A",	-100,	0 },
+    { "Q",	"period",	20,	0 },
+    { "Q",	"comma",	20,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-50,	0 },
+    { "R",	"W",	-40,	0 },
+    { "R",	"V",	-50,	0 },
+    { "R",	"U",	-20,	0 },
+    { "R",	"T",	-20,	0 },
+    { "R",	"O",	-20,	0 },
+    { "T",	"y",	-60,	0 },
+    { "T",	"w",	-60,	0 },
+    { "T",	"u",	-90,	0 },
+    { "T",	"semicolon",	-40,	0 },
+    { "T",	"r",	-80,	0 },
+    { "T",	"period",	-80,	0 },
+    { "T",	"o",	-80,	0 },
+    { "T",	"hyphen",	-120,	0 },
+    { "T",	"e",	-60,	0 },
+    { "T",	"comma",	-80,	0 },
+    { "T",	"colon",	-40,	0 },
+    { "T",	"a",	-80,	0 },
+    { "T",	"O",	-40,	0 },
+    { "T",	"A",	-90,	0 },
+    { "U",	"period",	-30,	0 },
+    { "U",	"comma",	-30,	0 },
+    { "U",	"A",	-50,	0 },
+    { "V",	"u",	-60,	0 },
+    { "V",	"semicolon",	-40,	0 },
+    { "V",	"period",	-120,	0 },
+    { "V",	"o",	-90,	0 },
+    { "V",	"hyphen",	-80,	0 },
+    { "V",	"e",	-50,	0 },
+    { "V",	"comma",	-120,	0 },
+    { "V",	"colon",	-40,	0 },
+    { "V",	"a",	-60,	0 },
+    { "V",	"O",	-50,	0 },
+    { "V",	"G",	-50,	0 },
+    { "V",	"A",	-80,	0 },
+    { "W",	"y",	-20,	0 },
+    { "W",	"u",	-45,	0 },
+    { "W",	"semicolon",	-10,	0 },
+    { "W",	"period",	-80,	0 },
+    { "W",	"o",	-60,	0 },
+    { "W",	"hyphen",	-40,	0 },
+    { "W",	"e",	-35,	0 },
+    { "W",	"comma",	-80,	0 },
+    { "W",	"colon",	-10,	0 },
+    { "W",	"a",	-40,	0 },
+    { "W",	"O",	-20,	0 },
+    { "W",	"A",	-60,	0 },
+    { "Y",	"u",	-100,	0 },
+    { "Y",	"semicolon",	-50,	0 },
+    { "Y",	"period",	-100,	0 },
+    { "Y",	"o",	-100,	0 },
+    { "Y",	"e",	-80,	0 },
+    { "Y",	"comma",	-100,	0 },
+    { "Y",	"colon",	-50,	0 },
+    { "Y",	"a",	-90,	0 },
+    { "Y",	"O",	-70,	0 },
+    { "Y",	"A",	-110,	0 },
+    { "a",	"y",	-20,	0 },
+    { "a",	"w",	-15,	0 },
+    { "a",	"v",	-15,	0 },
+    { "a",	"g",	-10,	0 },
+    { "b",	"y",	-20,	0 },
+    { "b",	"v",	-20,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"l",	-10,	0 },
+    { "c",	"y",	-10,	0 },
+    { "c",	"l",	-20,	0 },
+    { "c",	"k",	-20,	0 },
+    { "c",	"h",	-10,	0 },
+    { "colon",	"space",	-40,	0 },
+    { "comma",	"space",	-40,	0 },
+    { "comma",	"quoteright",	-120,	0 },
+    { "comma",	"quotedblright",	-120,	0 },
+    { "d",	"y",	-15,	0 },
+    { "d",	"w",	-15,	0 },
+    { "d",	"v",	-15,	0 },
+    { "d",	"d",	-10,	0 },
+    { "e",	"y",	-15,	0 },
+    { "e",	"x",	-15,	0 },
+    { "e",	"w",	-15,	0 },
+    { "e",	"v",	-15,	0 },
+    { "e",	"period",	20,	0 },
+    { "e",	"comma",	10,	0 },
+    { "f",	"quoteright",	30,	0 },
+    { "f",	"quotedblright",	30,	0 },
+    { "f",	"period",	-10,	0 },
+    { "f",	"o",	-20,	0 },
+    { "f",	"e",	-10,	0 },
+    { "f",	"comma",	-10,	0 },
+    { "g",	"g",	-10,	0 },
+    { "g",	"e",	10,	0 },
+    { "h",	"y",	-20,	0 },
+    { "k",	"o",	-15,	0 },
+    { "l",	"y",	-15,	0 },
+    { "l",	"w",	-15,	0 },
+    { "m",	"y",	-30,	0 },
+    { "m",	"u",	-20,	0 },
+    { "n",	"y",	-20,	0 },
+    { "n",	"v",	-40,	0 },
+    { "n",	"u",	-10,	0 },
+    { "o",	"y",	-20,	0 },
+    { "o",	"x",	-30,	0 },
+    { "o",	"w",	-15,	0 },
+    { "o",	"v",	-20,	0 },
+    { "p",	"y",	-15,	0 },
+    { "period",	"space",	-40,	0 },
+    { "period",	"quoteright",	-120,	0 },
+    { "period",	"quotedblright",	-120,	0 },
+    { "quotedblright",	"space",	-80,	0 },
+    { "quoteleft",	"quoteleft",	-46,	0 },
+    { "quoteright",	"v",	-20,	0 },
+    { "quoteright",	"space",	-80,	0 },
+    { "quoteright",	"s",	-60,	0 },
+    { "quoteright",	"r",	-40,	0 },
+    { "quoteright",	"quoteright",	-46,	0 },
+    { "quoteright",	"l",	-20,	0 },
+    { "quoteright",	"d",	-80,	0 },
+    { "r",	"y",	10,	0 },
+    { "r",	"v",	10,	0 },
+    { "r",	"t",	20,	0 },
+    { "r",	"s",	-15,	0 },
+    { "r",	"q",	-20,	0 },
+    { "r",	"period",	-60,	0 },
+    { "r",	"o",	-20,	0 },
+    { "r",	"hyphen",	-20,	0 },
+    { "r",	"g",	-15,	0 },
+    { "r",	"d",	-20,	0 },
+    { "r",	"comma",	-60,	0 },
+    { "r",	"c",	-20,	0 },
+    { "s",	"w",	-15,	0 },
+    { "semicolon",	"space",	-40,	0 },
+    { "space",	"quoteleft",	-60,	0 },
+    { "space",	"quotedblleft",	-80,	0 },
+    { "space",	"Y",	-120,	0 },
+    { "space",	"W",	-80,	0 },
+    { "space",	"V",	-80,	0 },
+    { "space",	"T",	-100,	0 },
+    { "v",	"period",	-80,	0 },
+    { "v",	"o",	-30,	0 },
+    { "v",	"comma",	-80,	0 },
+    { "v",	"a",	-20,	0 },
+    { "w",	"period",	-40,	0 },
+    { "w",	"o",	-20,	0 },
+    { "w",	"comma",	-40,	0 },
+    { "x",	"e",	-10,	0 },
+    { "y",	"period",	-80,	0 },
+    { "y",	"o",	-25,	0 },
+    { "y",	"e",	-10,	0 },
+    { "y",	"comma",	-80,	0 },
+    { "y",	"a",	-30,	0 },
+    { "z",	"e",	10,	0 }
+};
+
+/* Kerning pairs for font Helvetica-Oblique */
+static PairKernData pdf_pairs_Helvetica_Oblique[] = {
+    { "A",	"y",	-40,	0 },
+    { "A",	"w",	-40,	0 },
+    { "A",	"v",	-40,	0 },
+    { "A",	"u",	-30,	0 },
+    { "A",	"Y",	-100,	0 },
+    { "A",	"W",	-50,	0 },
+    { "A",	"V",	-70,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-120,	0 },
+    { "A",	"Q",	-30,	0 },
+    { "A",	"O",	-30,	0 },
+    { "A",	"G",	-30,	0 },
+    { "A",	"C",	-30,	0 },
+    { "B",	"period",	-20,	0 },
+    { "B",	"comma",	-20,	0 },
+    { "B",	"U",	-10,	0 },
+    { "C",	"period",	-30,	0 },
+    { "C",	"comma",	-30,	0 },
+    { "D",	"period",	-70,	0 },
+    { "D",	"comma",	-70,	0 },
+    { "D",	"Y",	-90,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-70,	0 },
+    { "D",	"A",	-40,	0 },
+    { "F",	"r",	-45,	0 },
+    { "F",	"period",	-150,	0 },
+    { "F",	"o",	-30,	0 },
+    { "F",	"e",	-30,	0 },
+    { "F",	"comma",	-150,	0 },
+    { "F",	"a",	-50,	0 },
+    { "F",	"A",	-80,	0 },
+    { "J",	"u",	-20,	0 },
+    { "J",	"period",	-30,	0 },
+    { "J",	"comma",	-30,	0 },
+    { "J",	"a",	-20,	0 },
+    { "J",	"A",	-20,	0 },
+    { "K",	"y",	-50,	0 },
+    { "K",	"u",	-30,	0 },
+    { "K",	"o",	-40,	0 },
+    { "K",	"e",	-40,	0 },
+    { "K",	"O",	-50,	0 },
+    { "L",	"y",	-30,	0 },
+    { "L",	"quoteright",	-160,	0 },
+    { "L",	"quotedblright",	-140,	0 },
+    { "L",	"Y",	-140,	0 },
+    { "L",	"W",	-70,	0 },
+    { "L",	"V",	-110,	0 },
+    { "L",	"T",	-110,	0 },
+    { "O",	"period",	-40,	0 },
+    { "O",	"comma",	-40,	0 },
+    { "O",	"Y",	-70,	0 },
+    { "O",	"X",	-60,	0 },
+    { "O",	"W",	-30,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-20,	0 },
+    { "P",	"period",	-180,	0 },
+    { "P",	"o",	-50,	0 },
+    { "P",	"e",	-50,	0 },
+    { "P",	"comma",	-180,	0 },
+    { "P",	"a",	-40,	0 },
+    { "P",	"A",	-120,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-50,	0 },
+    { "R",	"W",	-30,	0 },
+    { "R",	"V",	-50,	0 },
+    { "R",	"U",	-40,	0 },
+    { "R",	"T",	-30,	0 },
+    { "R",	"O",	-20,	0 },
+    { "S",	"period",	-20,	0 },
+    { "S",	"comma",	-20,	0 },
+    { "T",	"y",	-120,	0 },
+    { "T",	"w",	-120,	0 },
+    { "T",	"u",	-120,	0 },
+    { "T",	"semicolon",	-20,	0 },
+    { "T",	"r",	-120,	0 },
+    { "T",	"period",	-120,	0 },
+    { "T",	"o",	-120,	0 },
+    { "T",	"hyphen",	-140,	0 },
+    { "T",	"e",	-120,	0 },
+    { "T",	"comma",	-120,	0 },
+    { "T",	"colon",	-20,	0 },
+    { "T",	"a",	-120,	0 },
+    { "T",	"O",	-40,	0 },
+    { "T",	"A",	-120,	0 },
+    { "U",	"period",	-40,	0 },
+    { "U",	"comma",	-40,	0 },
+    { "U",	"A",	-40,	0 },
+    { "V",	"u",	-70,	0 },
+    { "V",	"semicolon",	-40,	0 },
+    { "V",	"period",	-125,	0 },
+    { "V",	"o",	-80,	0 },
+    { "V",	"hyphen",	-80,	0 },
+    { "V",	"e",	-80,	0 },
+    { "V",	"comma",	-125,	0 },
+    { "V",	"colon",	-40,	0 },
+    { "V",	"a",	-70,	0 },
+    { "V",	"O",	-40,	0 },
+    { "V",	"G",	-40,	0 },
+    { "V",	"A",	-80,	0 },
+    { "W",	"y",	-20,	0 },
+    { "W",	"u",	-30,	0 },
+    { "W",	"period",	-80,	0 },
+    { "W",	"o",	-30,	0 },
+    { "W",	"hyphen",	-40,	0 },
+    { "W",	"e",	-30,	0 },
+    { "W",	"comma",	-80,	0 },
+    { "W",	"a",	-40,	0 },
+    { "W",	"O",	-20,	0 },
+    { "W",	"A",	-50,	0 },
+    { "Y",	"u",	-110,	0 },
+    { "Y",	"semicolon",	-60,	0 },
+    { "Y",	"period",	-140,	0 },
+    { "Y",	"o",	-140,	0 },
+    { "Y",	"i",	-20,	0 },
+    { "Y",	"hyphen",	-140,	0 },
+    { "Y",	"e",	-140,	0 },
+    { "Y",	"comma",	-140,	0 },
+    { "Y",	"colon",	-60,	0 },
+    { "Y",	"a",	-140,	0 },
+    { "Y",	"O",	-85,	0 },
+    { "Y",	"A",	-110,	0 },
+    { "a",	"y",	-30,	0 },
+    { "a",	"w",	-20,	0 },
+    { "a",	"v",	-20,	0 },
+    { "b",	"y",	-20,	0 },
+    { "b",	"v",	-20,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"period",	-40,	0 },
+    { "b",	"l",	-20,	0 },
+    { "b",	"comma",	-40,	0 },
+    { "b",	"b",	-10,	0 },
+    { "c",	"k",	-20,	0 },
+    { "c",	"comma",	-15,	0 },
+    { "colon",	"space",	-50,	0 },
+    { "comma",	"quoteright",	-100,	0 },
+    { "comma",	"quotedblright",	-100,	0 },
+    { "e",	"y",	-20,	0 },
+    { "e",	"x",	-30,	0 },
+    { "e",	"w",	-20,	0 },
+    { "e",	"v",	-30,	0 },
+    { "e",	"period",	-15,	0 },
+    { "e",	"comma",	-15,	0 },
+    { "f",	"quoteright",	50,	0 },
+    { "f",	"quotedblright",	60,	0 },
+    { "f",	"period",	-30,	0 },
+    { "f",	"o",	-30,	0 },
+    { "f",	"e",	-30,	0 },
+    { "f",	"dotlessi",	-28,	0 },
+    { "f",	"comma",	-30,	0 },
+    { "f",	"a",	-30,	0 },
+    { "g",	"r",	-10,	0 },
+    { "h",	"y",	-30,	0 },
+    { "k",	"o",	-20,	0 },
+    { "k",	"e",	-20,	0 },
+    { "m",	"y",	-15,	0 },
+    { "m",	"u",	-10,	0 },
+    { "n",	"y",	-15,	0 },
+    { "n",	"v",	-20,	0 },
+    { "n",	"u",	-10,	0 },
+    { "o",	"y",	-30,	0 },
+    { "o",	"x",	-30,	0 },
+    { "o",	"w",	-15,	0 },
+    { "o",	"v",	-15,	0 },
+    { "o",	"period",	-40,	0 },
+    { "o",	"comma",	-40,	0 },
+    { "oslash",	"z",	-55,	0 },
+    { "oslash",	"y",	-70,	0 },
+    { "oslash",	"x",	-85,	0 },
+    { "oslash",	"w",	-70,	0 },
+    { "oslash",	"v",	-70,	0 },
+    { "oslash",	"u",	-55,	0 },
+    { "oslash",	"t",	-55,	0 },
+    { "oslash",	"s",	-55,	0 },
+    { "oslash",	"r",	-55,	0 },
+    { "oslash",	"q",	-55,	0 },
+    { "oslash",	"period",	-95,	0 },
+    { "oslash",	"p",	-55,	0 },
+    { "oslash",	"o",	-55,	0 },
+    { "oslash",	"n",	-55,	0 },
+    { "oslash",	"m",	-55,	0 },
+    { "oslash",	"l",	-55,	0 },
+    { "oslash",	"k",	-55,	0 },
+    { "oslash",	"j",	-55,	0 },
+    { "oslash",	"i",	-55,	0 },
+    { "oslash",	"h",	-55,	0 },
+    { "oslash",	"g",	-55,	0 },
+    { "oslash",	"f",	-55,	0 },
+    { "oslash",	"e",	-55,	0 },
+    { "oslash",	"d",	-55,	0 },
+    { "oslash",	"comma",	-95,	0 },
+    { "oslash",	"c",	-55,	0 },
+    { "oslash",	"b",	-55,	0 },
+    { "oslash",	"a",	-55,	0 },
+    { "p",	"y",	-30,	0 },
+    { "p",	"period",	-35,	0 },
+    { "p",	"comma",	-35,	0 },
+    { "period",	"space",	-60,	0 },
+    { "period",	"quoteright",	-100,	0 },
+    { "period",	"quotedblright",	-100,	0 },
+    { "quotedblright",	"space",	-40,	0 },
+    { "quoteleft",	"quoteleft",	-57,	0 },
+    { "quoteright",	"space",	-70,	0 },
+    { "quoteright",	"s",	-50,	0 },
+    { "quoteright",	"r",	-50,	0 },
+    { "quoteright",	"quoteright",	-57,	0 },
+    { "quoteright",	"d",	-50,	0 },
+    { "r",	"y",	30,	0 },
+    { "r",	"v",	30,	0 },
+    { "r",	"u",	15,	0 },
+    { "r",	"t",	40,	0 },
+    { "r",	"semicolon",	30,	0 },
+    { "r",	"period",	-50,	0 },
+    { "r",	"p",	30,	0 },
+    { "r",	"n",	25,	0 },
+    { "r",	"m",	25,	0 },
+    { "r",	"l",	15,	0 },
+    { "r",	"k",	15,	0 },
+    { "r",	"i",	15,	0 },
+    { "r",	"comma",	-50,	0 },
+    { "r",	"colon",	30,	0 },
+    { "r",	"a",	-10,	0 },
+    { "s",	"w",	-30,	0 },
+    { "s",	"period",	-15,	0 },
+    { "s",	"comma",	-15,	0 },
+    { "semicolon",	"space",	-50,	0 },
+    { "space",	"quoteleft",	-60,	0 },
+    { "space",	"quotedblleft",	-30,	0 },
+    { "space",	"Y",	-90,	0 },
+    { "space",	"W",	-40,	0 },
+    { "space",	"V",	-50,	0 },
+    { "space",	"T",	-50,	0 },
+    { "v",	"period",	-80,	0 },
+    { "v",	"o",	-25,	0 },
+    { "v",	"e",	-25,	0 },
+    { "v",	"comma",	-80,	0 },
+    { "v",	"a",	-25,	0 },
+    { "w",	"period",	-60,	0 },
+    { "w",	"o",	-10,	0 },
+    { "w",	"e",	-10,	0 },
+    { "w",	"comma",	-60,	0 },
+    { "w",	"a",	-15,	0 },
+    { "x",	"e",	-30,	0 },
+    { "y",	"period",	-100,	0 },
+    { "y",	"o",	-20,	0 },
+    { "y",	"e",	-20,	0 },
+    { "y",	"comma",	-100,	0 },
+    { "y",	"a",	-20,	0 },
+    { "z",	"o",	-15,	0 },
+    { "z",	"e",	-15,	0 }
+};
+
+/* Kerning pairs for font Helvetica */
+static PairKernData pdf_pairs_Helvetica[] = {
+    { "A",	"y",	-40,	0 },
+    { "A",	"w",	-40,	0 },
+    { "A",	"v",	-40,	0 },
+    { "A",	"u",	-30,	0 },
+    { "A",	"Y",	-100,	0 },
+    { "A",	"W",	-50,	0 },
+    { "A",	"V",	-70,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-120,	0 },
+    { "A",	"Q",	-30,	0 },
+    { "A",	"O",	-30,	0 },
+    { "A",	"G",	-30,	0 },
+    { "A",	"C",	-30,	0 },
+    { "B",	"period",	-20,	0 },
+    { "B",	"comma",	-20,	0 },
+    { "B",	"U",	-10,	0 },
+    { "C",	"period",	-30,	0 },
+    { "C",	"comma",	-30,	0 },
+    { "D",	"period",	-70,	0 },
+    { "D",	"comma",	-70,	0 },
+    { "D",	"Y",	-90,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-70,	0 },
+    { "D",	"A",	-40,	0 },
+    { "F",	"r",	-45,	0 },
+    { "F",	"period",	-150,	0 },
+    { "F",	"o",	-30,	0 },
+    { "F",	"e",	-30,	0 },
+    { "F",	"comma",	-150,	0 },
+    { "F",	"a",	-50,	0 },
+    { "F",	"A",	-80,	0 },
+    { "J",	"u",	-20,	0 },
+    { "J",	"period",	-30,	0 },
+    { "J",	"comma",	-30,	0 },
+    { "J",	"a",	-20,	0 },
+    { "J",	"A",	-20,	0 },
+    { "K",	"y",	-50,	0 },
+    { "K",	"u",	-30,	0 },
+    { "K",	"o",	-40,	0 },
+    { "K",	"e",	-40,	0 },
+    { "K",	"O",	-50,	0 },
+    { "L",	"y",	-30,	0 },
+    { "L",	"quoteright",	-160,	0 },
+    { "L",	"quotedblright",	-140,	0 },
+    { "L",	"Y",	-140,	0 },
+    { "L",	"W",	-70,	0 },
+    { "L",	"V",	-110,	0 },
+    { "L",	"T",	-110,	0 },
+    { "O",	"period",	-40,	0 },
+    { "O",	"comma",	-40,	0 },
+    { "O",	"Y",	-70,	0 },
+    { "O",	"X",	-60,	0 },
+    { "O",	"W",	-30,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-20,	0 },
+    { "P",	"period",	-180,	0 },
+    { "P",	"o",	-50,	0 },
+    { "P",	"e",	-50,	0 },
+    { "P",	"comma",	-180,	0 },
+    { "P",	"a",	-40,	0 },
+    { "P",	"A",	-120,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-50,	0 },
+    { "R",	"W",	-30,	0 },
+    { "R",	"V",	-50,	0 },
+    { "R",	"U",	-40,	0 },
+    { "R",	"T",	-30,	0 },
+    { "R",	"O",	-20,	0 },
+    { "S",	"period",	-20,	0 },
+    { "S",	"comma",	-20,	0 },
+    { "T",	"y",	-120,	0 },
+    { "T",	"w",	-120,	0 },
+    { "T",	"u",	-120,	0 },
+    { "T",	"semicolon",	-20,	0 },
+    { "T",	"r",	-120,	0 },
+    { "T",	"period",	-120,	0 },
+    { "T",	"o",	-120,	0 },
+    { "T",	"hyphen",	-140,	0 },
+    { "T",	"e",	-120,	0 },
+    { "T",	"comma",	-120,	0 },
+    { "T",	"colon",	-20,	0 },
+    { "T",	"a",	-120,	0 },
+    { "T",	"O",	-40,	0 },
+    { "T",	"A",	-120,	0 },
+    { "U",	"period",	-40,	0 },
+    { "U",	"comma",	-40,	0 },
+    { "U",	"A",	-40,	0 },
+    { "V",	"u",	-70,	0 },
+    { "V",	"semicolon",	-40,	0 },
+    { "V",	"period",	-125,	0 },
+    { "V",	"o",	-80,	0 },
+    { "V",	"hyphen",	-80,	0 },
+    { "V",	"e",	-80,	0 },
+    { "V",	"comma",	-125,	0 },
+    { "V",	"colon",	-40,	0 },
+    { "V",	"a",	-70,	0 },
+    { "V",	"O",	-40,	0 },
+    { "V",	"G",	-40,	0 },
+    { "V",	"A",	-80,	0 },
+    { "W",	"y",	-20,	0 },
+    { "W",	"u",	-30,	0 },
+    { "W",	"period",	-80,	0 },
+    { "W",	"o",	-30,	0 },
+    { "W",	"hyphen",	-40,	0 },
+    { "W",	"e",	-30,	0 },
+    { "W",	"comma",	-80,	0 },
+    { "W",	"a",	-40,	0 },
+    { "W",	"O",	-20,	0 },
+    { "W",	"A",	-50,	0 },
+    { "Y",	"u",	-110,	0 },
+    { "Y",	"semicolon",	-60,	0 },
+    { "Y",	"period",	-140,	0 },
+    { "Y",	"o",	-140,	0 },
+    { "Y",	"i",	-20,	0 },
+    { "Y",	"hyphen",	-140,	0 },
+    { "Y",	"e",	-140,	0 },
+    { "Y",	"comma",	-140,	0 },
+    { "Y",	"colon",	-60,	0 },
+    { "Y",	"a",	-140,	0 },
+    { "Y",	"O",	-85,	0 },
+    { "Y",	"A",	-110,	0 },
+    { "a",	"y",	-30,	0 },
+    { "a",	"w",	-20,	0 },
+    { "a",	"v",	-20,	0 },
+    { "b",	"y",	-20,	0 },
+    { "b",	"v",	-20,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"period",	-40,	0 },
+    { "b",	"l",	-20,	0 },
+    { "b",	"comma",	-40,	0 },
+    { "b",	"b",	-10,	0 },
+    { "c",	"k",	-20,	0 },
+    { "c",	"comma",	-15,	0 },
+    { "colon",	"space",	-50,	0 },
+    { "comma",	"quoteright",	-100,	0 },
+    { "comma",	"quotedblright",	-100,	0 },
+    { "e",	"y",	-20,	0 },
+    { "e",	"x",	-30,	0 },
+    { "e",	"w",	-20,	0 },
+    { "e",	"v",	-30,	0 },
+    { "e",	"period",	-15,	0 },
+    { "e",	"comma",	-15,	0 },
+    { "f",	"quoteright",	50,	0 },
+    { "f",	"quotedblright",	60,	0 },
+    { "f",	"period",	-30,	0 },
+    { "f",	"o",	-30,	0 },
+    { "f",	"e",	-30,	0 },
+    { "f",	"dotlessi",	-28,	0 },
+    { "f",	"comma",	-30,	0 },
+    { "f",	"a",	-30,	0 },
+    { "g",	"r",	-10,	0 },
+    { "h",	"y",	-30,	0 },
+    { "k",	"o",	-20,	0 },
+    { "k",	"e",	-20,	0 },
+    { "m",	"y",	-15,	0 },
+    { "m",	"u",	-10,	0 },
+    { "n",	"y",	-15,	0 },
+    { "n",	"v",	-20,	0 },
+    { "n",	"u",	-10,	0 },
+    { "o",	"y",	-30,	0 },
+    { "o",	"x",	-30,	0 },
+    { "o",	"w",	-15,	0 },
+    { "o",	"v",	-15,	0 },
+    { "o",	"period",	-40,	0 },
+    { "o",	"comma",	-40,	0 },
+    { "oslash",	"z",	-55,	0 },
+    { "oslash",	"y",	-70,	0 },
+    { "oslash",	"x",	-85,	0 },
+    { "oslash",	"w",	-70,	0 },
+    { "oslash",	"v",	-70,	0 },
+    { "oslash",	"u",	-55,	0 },
+    { "oslash",	"t",	-55,	0 },
+    { "oslash",	"s",	-55,	0 },
+    { "oslash",	"r",	-55,	0 },
+    { "oslash",	"q",	-55,	0 },
+    { "oslash",	"period",	-95,	0 },
+    { "oslash",	"p",	-55,	0 },
+    { "oslash",	"o",	-55,	0 },
+    { "oslash",	"n",	-55,	0 },
+    { "oslash",	"m",	-55,	0 },
+    { "oslash",	"l",	-55,	0 },
+    { "oslash",	"k",	-55,	0 },
+    { "oslash",	"j",	-55,	0 },
+    { "oslash",	"i",	-55,	0 },
+    { "oslash",	"h",	-55,	0 },
+    { "oslash",	"g",	-55,	0 },
+    { "oslash",	"f",	-55,	0 },
+    { "oslash",	"e",	-55,	0 },
+    { "oslash",	"d",	-55,	0 },
+    { "oslash",	"comma",	-95,	0 },
+    { "oslash",	"c",	-55,	0 },
+    { "oslash",	"b",	-55,	0 },
+    { "oslash",	"a",	-55,	0 },
+    { "p",	"y",	-30,	0 },
+    { "p",	"period",	-35,	0 },
+    { "p",	"comma",	-35,	0 },
+    { "period",	"space",	-60,	0 },
+    { "period",	"quoteright",	-100,	0 },
+    { "period",	"quotedblright",	-100,	0 },
+    { "quotedblright",	"space",	-40,	0 },
+    { "quoteleft",	"quoteleft",	-57,	0 },
+    { "quoteright",	"space",	-70,	0 },
+    { "quoteright",	"s",	-50,	0 },
+    { "quoteright",	"r",	-50,	0 },
+    { "quoteright",	"quoteright",	-57,	0 },
+    { "quoteright",	"d",	-50,	0 },
+    { "r",	"y",	30,	0 },
+    { "r",	"v",	30,	0 },
+    { "r",	"u",	15,	0 },
+    { "r",	"t",	40,	0 },
+    { "r",	"semicolon",	30,	0 },
+    { "r",	"period",	-50,	0 },
+    { "r",	"p",	30,	0 },
+    { "r",	"n",	25,	0 },
+    { "r",	"m",	25,	0 },
+    { "r",	"l",	15,	0 },
+    { "r",	"k",	15,	0 },
+    { "r",	"i",	15,	0 },
+    { "r",	"comma",	-50,	0 },
+    { "r",	"colon",	30,	0 },
+    { "r",	"a",	-10,	0 },
+    { "s",	"w",	-30,	0 },
+    { "s",	"period",	-15,	0 },
+    { "s",	"comma",	-15,	0 },
+    { "semicolon",	"space",	-50,	0 },
+    { "space",	"quoteleft",	-60,	0 },
+    { "space",	"quotedblleft",	-30,	0 },
+    { "space",	"Y",	-90,	0 },
+    { "space",	"W",	-40,	0 },
+    { "space",	"V",	-50,	0 },
+    { "space",	"T",	-50,	0 },
+    { "v",	"period",	-80,	0 },
+    { "v",	"o",	-25,	0 },
+    { "v",	"e",	-25,	0 },
+    { "v",	"comma",	-80,	0 },
+    { "v",	"a",	-25,	0 },
+    { "w",	"period",	-60,	0 },
+    { "w",	"o",	-10,	0 },
+    { "w",	"e",	-10,	0 },
+    { "w",	"comma",	-60,	0 },
+    { "w",	"a",	-15,	0 },
+    { "x",	"e",	-30,	0 },
+    { "y",	"period",	-100,	0 },
+    { "y",	"o",	-20,	0 },
+    { "y",	"e",	-20,	0 },
+    { "y",	"comma",	-100,	0 },
+    { "y",	"a",	-20,	0 },
+    { "z",	"o",	-15,	0 },
+    { "z",	"e",	-15,	0 }
+};
+
+/* Kerning pairs for font Times-Bold */
+static PairKernData pdf_pairs_Times_Bold[] = {
+    { "A",	"y",	-74,	0 },
+    { "A",	"w",	-90,	0 },
+    { "A",	"v",	-100,	0 },
+    { "A",	"u",	-50,	0 },
+    { "A",	"quoteright",	-74,	0 },
+    { "A",	"quotedblright",	0,	0 },
+    { "A",	"p",	-25,	0 },
+    { "A",	"Y",	-100,	0 },
+    { "A",	"W",	-130,	0 },
+    { "A",	"V",	-145,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-95,	0 },
+    { "A",	"Q",	-45,	0 },
+    { "A",	"O",	-45,	0 },
+    { "A",	"G",	-55,	0 },
+    { "A",	"C",	-55,	0 },
+    { "B",	"period",	0,	0 },
+    { "B",	"comma",	0,	0 },
+    { "B",	"U",	-10,	0 },
+    { "B",	"A",	-30,	0 },
+    { "D",	"period",	-20,	0 },
+    { "D",	"comma",	0,	0 },
+    { "D",	"Y",	-40,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-40,	0 },
+    { "D",	"A",	-35,	0 },
+    { "F",	"r",	0,	0 },
+    { "F",	"period",	-110,	0 },
+    { "F",	"o",	-25,	0 },
+    { "F",	"i",	0,	0 },
+    { "F",	"e",	-25,	0 },
+    { "F",	"comma",	-92,	0 },
+    { "F",	"a",	-25,	0 },
+    { "F",	"A",	-90,	0 },
+    { "G",	"period",	0,	0 },
+    { "G",	"comma",	0,	0 },
+    { "J",	"u",	-15,	0 },
+    { "J",	"period",	-20,	0 },
+    { "J",	"o",	-15,	0 },
+    { "J",	"e",	-15,	0 },
+    { "J",	"comma",	0,	0 },
+    { "J",	"a",	-15,	0 },
+    { "J",	"A",	-30,	0 },
+    { "K",	"y",	-45,	0 },
+    { "K",	"u",	-15,	0 },
+    { "K",	"o",	-25,	0 },
+    { "K",	"e",	-25,	0 },
+    { "K",	"O",	-30,	0 },
+    { "L",	"y",	-55,	0 },
+    { "L",	"quoteright",	-110,	0 },
+    { "L",	"quotedblright",	-20,	0 },
+    { "L",	"Y",	-92,	0 },
+    { "L",	"W",	-92,	0 },
+    { "L",	"V",	-92,	0 },
+    { "L",	"T",	-92,	0 },
+    { "N",	"period",	0,	0 },
+    { "N",	"comma",	0,	0 },
+    { "N",	"A",	-20,	0 },
+    { "O",	"period",	0,	0 },
+    { "O",	"comma",	0,	0 },
+    { "O",	"Y",	-50,	0 },
+    { "O",	"X",	-40,	0 },
+    { "O",	"W",	-50,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-40,	0 },
+    { "P",	"period",	-110,	0 },
+    { "P",	"o",	-20,	0 },
+    { "P",	"e",	-20,	0 },
+    { "P",	"comma",	-92,	0 },
+    { "P",	"a",	-10,	0 },
+    { "P",	"A",	-74,	0 },
+    { "Q",	"period",	-20,	0 },
+    { "Q",	"comma",	0,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-35,	0 },
+    { "R",	"W",	-35,	0 },
+    { "R",	"V",	-55,	0 },
+    { "R",	"U",	-30,	0 },
+    { "R",	"T",	-40,	0 },
+    { "R",	"O",	-30,	0 },
+    { "S",	"period",	0,	0 },
+    { "S",	"comma",	0,	0 },
+    { "T",	"y",	-74,	0 },
+    { "T",	"w",	-74,	0 },
+    { "T",	"u",	-92,	0 },
+    { "T",	"semicolon",	-74,	0 },
+    { "T",	"r",	-74,	0 },
+    { "T",	"period",	-90,	0 },
+    { "T",	"o",	-92,	0 },
+    { "T",	"i",	-18,	0 },
+    { "T",	"hyphen",	-92,	0 },
+    { "T",	"h",	0,	0 },
+    { "T",	"e",	-92,	0 },
+    { "T",	"comma",	-74,	0 },
+    { "T",	"colon",	-74,	0 },
+    { "T",	"a",	-92,	0 },
+    { "T",	"O",	-18,	0 },
+    { "T",	"A",	-90,	0 },
+    { "U",	"period",	-50,	0 },
+    { "U",	"comma",	-50,	0 },
+    { "U",	"A",	-60,	0 },
+    { "V",	"u",	-92,	0 },
+    { "V",	"semicolon",	-92,	0 },
+    { "V",	"period",	-145,	0 },
+    { "V",	"o",	-100,	0 },
+    { "V",	"i",	-37,	0 },
+    { "V",	"hyphen",	-74,	0 },
+    { "V",	"e",	-100,	0 },
+    { "V",	"comma",	-129,	0 },
+    { "V",	"colon",	-92,	0 },
+    { "V",	"a",	-92,	0 },
+    { "V",	"O",	-45,	0 },
+    { "V",	"G",	-30,	0 },
+    { "V",	"A",	-135,	0 },
+    { "W",	"y",	-60,	0 },
+    { "W",	"u",	-50,	0 },
+    { "W",	"semicolon",	-55,	0 },
+    { "W",	"period",	-92,	0 },
+    { "W",	"o",	-75,	0 },
+    { "W",	"i",	-18,	0 },
+    { "W",	"hyphen",	-37,	0 },
+    { "W",	"h",	0,	0 },
+    { "W",	"e",	-65,	0 },
+    { "W",	"comma",	-92,	0 },
+    { "W",	"colon",	-55,	0 },
+    { "W",	"a",	-65,	0 },
+    { "W",	"O",	-10,	0 },
+    { "W",	"A",	-120,	0 },
+    { "Y",	"u",	-92,	0 },
+    { "Y",	"semicolon",	-92,	0 },
+    { "Y",	"period",	-92,	0 },
+    { "Y",	"o",	-111,	0 },
+    { "Y",	"i",	-37,	0 },
+    { "Y",	"hyphen",	-92,	0 },
+    { "Y",	"e",	-111,	0 },
+    { "Y",	"comma",	-92,	0 },
+    { "Y",	"colon",	-92,	0 },
+    { "Y",	"a",	-85,	0 },
+    { "Y",	"O",	-35,	0 },
+    { "Y",	"A",	-110,	0 },
+    { "a",	"y",	0,	0 },
+    { "a",	"w",	0,	0 },
+    { "a",	"v",	-25,	0 },
+    { "a",	"t",	0,	0 },
+    { "a",	"p",	0,	0 },
+    { "a",	"g",	0,	0 },
+    { "a",	"b",	0,	0 },
+    { "b",	"y",	0,	0 },
+    { "b",	"v",	-15,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"period",	-40,	0 },
+    { "b",	"l",	0,	0 },
+    { "b",	"comma",	0,	0 },
+    { "b",	"b",	-10,	0 },
+    { "c",	"y",	0,	0 },
+    { "c",	"period",	0,	0 },
+    { "c",	"l",	0,	0 },
+    { "c",	"k",	0,	0 },
+    { "c",	"h",	0,	0 },
+    { "c",	"comma",	0,	0 },
+    { "colon",	"space",	0,	0 },
+    { "comma",	"space",	0,	0 },
+    { "comma",	"quoteright",	-55,	0 },
+    { "comma",	"quotedblright",	-45,	0 },
+    { "d",	"y",	0,	0 },
+    { "d",	"w",	-15,	0 },
+    { "d",	"v",	0,	0 },
+    { "d",	"period",	0,	0 },
+    { "d",	"d",	0,	0 },
+    { "d",	"comma",	0,	0 },
+    { "e",	"y",	0,	0 },
+    { "e",	"x",	0,	0 },
+    { "e",	"w",	0,	0 },
+    { "e",	"v",	-15,	0 },
+    { "e",	"period",	0,	0 },
+    { "e",	"p",	0,	0 },
+    { "e",	"g",	0,	0 },
+    { "e",	"comma",	0,	0 },
+    { "e",	"b",	0,	0 },
+    { "f",	"quoteright",	55,	0 },
+    { "f",	"quotedblright",	50,	0 },
+    { "f",	"period",	-15,	0 },
+    { "f",	"o",	-25,	0 },
+    { "f",	"l",	0,	0 },
+    { "f",	"i",	-25,	0 },
+    { "f",	"f",	0,	0 },
+    { "f",	"e",	0,	0 },
+    { "f",	"dotlessi",	-35,	0 },
+    { "f",	"comma",	-15,	0 },
+    { "f",	"a",	0,	0 },
+    { "g",	"y",	0,	0 },
+    { "g",	"r",	0,	0 },
+    { "g",	"period",	-15,	0 },
+    { "g",	"o",	0,	0 },
+    { "g",	"i",	0,	0 },
+    { "g",	"g",	0,	0 },
+    { "g",	"e",	0,	0 },
+    { "g",	"comma",	0,	0 },
+    { "g",	"a",	0,	0 },
+    { "h",	"y",	-15,	0 },
+    { "i",	"v",	-10,	0 },
+    { "k",	"y",	-15,	0 },
+    { "k",	"o",	-15,	0 },
+    { "k",	"e",	-10,	0 },
+    { "l",	"y",	0,	0 },
+    { "l",	"w",	0,	0 },
+    { "m",	"y",	0,	0 },
+    { "m",	"u",	0,	0 },
+    { "n",	"y",	0,	0 },
+    { "n",	"v",	-40,	0 },
+    { "n",	"u",	0,	0 },
+    { "o",	"y",	0,	0 },
+    { "o",	"x",	0,	0 },
+    { "o",	"w",	-10,	0 },
+    { "o",	"v",	-10,	0 },
+    { "o",	"g",	0,	0 },
+    { "p",	"y",	0,	0 },
+    { "period",	"quoteright",	-55,	0 },
+    { "period",	"quotedblright",	-55,	0 },
+    { "quotedblleft",	"quoteleft",	0,	0 },
+    { "quotedblleft",	"A",	-10,	0 },
+    { "quotedblright",	"space",	0,	0 },
+    { "quoteleft",	"quoteleft",	-63,	0 },
+    { "quoteleft",	"A",	-10,	0 },
+    { "quoteright",	"v",	-20,	0 },
+    { "quoteright",	"t",	0,	0 },
+    { "quoteright",	"space",	-74,	0 },
+    { "quoteright",	"s",	-37,	0 },
+    { "quoteright",	"r",	-20,	0 },
+    { "quoteright",	"quoteright",	-63,	0 },
+    { "quoteright",	"quotedblright",	0,	0 },
+    { "quoteright",	"l",	0,	0 },
+    { "quoteright",	"d",	-20,	0 },
+    { "r",	"y",	0,	0 },
+    { "r",	"v",	-10,	0 },
+    { "r",	"u",	0,	0 },
+    { "r",	"t",	0,	0 },
+    { "r",	"s",	0,	0 },
+    { "r",	"r",	0,	0 },
+    { "r",	"q",	-18,	0 },
+    { "r",	"period",	-100,	0 },
+    { "r",	"p",	-10,	0 },
+    { "r",	"o",	-18,	0 },
+    { "r",	"n",	-15,	0 },
+    { "r",	"m",	0,	0 },
+    { "r",	"l",	0,	0 },
+    { "r",	"k",	0,	0 },
+    { "r",	"i",	0,	0 },
+    { "r",	"hyphen",	-37,	0 },
+    { "r",	"g",	-10,	0 },
+    { "r",	"e",	-18,	0 },
+    { "r",	"d",	0,	0 },
+    { "r",	"comma",	-92,	0 },
+    { "r",	"c",	-18,	0 },
+    { "r",	"a",	0,	0 },
+    { "s",	"w",	0,	0 },
+    { "space",	"quoteleft",	0,	0 },
+    { "space",	"quotedblleft",	0,	0 },
+    { "space",	"Y",	-55,	0 },
+    { "space",	"W",	-30,	0 },
+    { "space",	"V",	-45,	0 },
+    { "space",	"T",	-30,	0 },
+    { "space",	"A",	-55,	0 },
+    { "v",	"period",	-70,	0 },
+    { "v",	"o",	-10,	0 },
+    { "v",	"e",	-10,	0 },
+    { "v",	"comma",	-55,	0 },
+    { "v",	"a",	-10,	0 },
+    { "w",	"period",	-70,	0 },
+    { "w",	"o",	-10,	0 },
+    { "w",	"h",	0,	0 },
+    { "w",	"e",	0,	0 },
+    { "w",	"comma",	-55,	0 },
+    { "w",	"a",	0,	0 },
+    { "x",	"e",	0,	0 },
+    { "y",	"period",	-70,	0 },
+    { "y",	"o",	-25,	0 },
+    { "y",	"e",	-10,	0 },
+    { "y",	"comma",	-55,	0 },
+    { "y",	"a",	0,	0 },
+    { "z",	"o",	0,	0 },
+    { "z",	"e",	0,	0 }
+};
+
+/* Kerning pairs for font Times-BoldItalic */
+static PairKernData pdf_pairs_Times_BoldItalic[] = {
+    { "A",	"y",	-74,	0 },
+    { "A",	"w",	-74,	0 },
+    { "A",	"v",	-74,	0 },
+    { "A",	"u",	-30,	0 },
+    { "A",	"quoteright",	-74,	0 },
+    { "A",	"quotedblright",	0,	0 },
+    { "A",	"p",	0,	0 },
+    { "A",	"Y",	-70,	0 },
+    { "A",	"W",	-100,	0 },
+    { "A",	"V",	-95,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-55,	0 },
+    { "A",	"Q",	-55,	0 },
+    { "A",	"O",	-50,	0 },
+    { "A",	"G",	-60,	0 },
+    { "A",	"C",	-65,	0 },
+    { "B",	"period",	0,	0 },
+    { "B",	"comma",	0,	0 },
+    { "B",	"U",	-10,	0 },
+    { "B",	"A",	-25,	0 },
+    { "D",	"period",	0,	0 },
+    { "D",	"comma",	0,	0 },
+    { "D",	"Y",	-50,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-50,	0 },
+    { "D",	"A",	-25,	0 },
+    { "F",	"r",	-50,	0 },
+    { "F",	"period",	-129,	0 },
+    { "F",	"o",	-70,	0 },
+    { "F",	"i",	-40,	0 },
+    { "F",	"e",	-100,	0 },
+    { "F",	"comma",	-129,	0 },
+    { "F",	"a",	-95,	0 },
+    { "F",	"A",	-100,	0 },
+    { "G",	"period",	0,	0 },
+    { "G",	"comma",	0,	0 },
+    { "J",	"u",	-40,	0 },
+    { "J",	"period",	-10,	0 },
+    { "J",	"o",	-40,	0 },
+    { "J",	"e",	-40,	0 },
+    { "J",	"comma",	-10,	0 },
+    { "J",	"a",	-40,	0 },
+    { "J",	"A",	-25,	0 },
+    { "K",	"y",	-20,	0 },
+    { "K",	"u",	-20,	0 },
+    { "K",	"o",	-25,	0 },
+    { "K",	"e",	-25,	0 },
+    { "K",	"O",	-30,	0 },
+    { "L",	"y",	-37,	0 },
+    { "L",	"quoteright",	-55,	0 },
+    { "L",	"quotedblright",	0,	0 },
+    { "L",	"Y",	-37,	0 },
+    { "L",	"W",	-37,	0 },
+    { "L",	"V",	-37,	0 },
+    { "L",	"T",	-18,	0 },
+    { "N",	"period",	0,	0 },
+    { "N",	"comma",	0,	0 },
+    { "N",	"A",	-30,	0 },
+    { "O",	"period",	0,	0 },
+    { "O",	"comma",	0,	0 },
+    { "O",	"Y",	-50,	0 },
+    { "O",	"X",	-40,	0 },
+    { "O",	"W",	-50,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-40,	0 },
+    { "P",	"period",	-129,	0 },
+    { "P",	"o",	-55,	0 },
+    { "P",	"e",	-50,	0 },
+    { "P",	"comma",	-129,	0 },
+    { "P",	"a",	-40,	0 },
+    { "P",	"A",	-85,	0 },
+    { "Q",	"period",	0,	0 },
+    { "Q",	"comma",	0,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-18,	0 },
+    { "R",	"W",	-18,	0 },
+    { "R",	"V",	-18,	0 },
+    { "R",	"U",	-40,	0 },
+    { "R",	"T",	-30,	0 },
+    { "R",	"O",	-40,	0 },
+    { "S",	"period",	0,	0 },
+    { "S",	"comma",	0,	0 },
+    { "T",	"y",	-37,	0 },
+    { "T",	"w",	-37,	0 },
+    { "T",	"u",	-37,	0 },
+    { "T",	"semicolon",	-74,	0 },
+    { "T",	"r",	-37,	0 },
+    { "T",	"period",	-92,	0 },
+    { "T",	"o",	-95,	0 },
+    { "T",	"i",	-37,	0 },
+    { "T",	"hyphen",	-92,	0 },
+    { "T",	"h",	0,	0 },
+    { "T",	"e",	-92,	0 },
+    { "T",	"comma",	-92,	0 },
+    { "T",	"colon",	-74,	0 },
+    { "T",	"a",	-92,	0 },
+    { "T",	"O",	-18,	0 },
+    { "T",	"A",	-55,	0 },
+    { "U",	"period",	0,	0 },
+    { "U",	"comma",	0,	0 },
+    { "U",	"A",	-45,	0 },
+    { "V",	"u",	-55,	0 },
+    { "V",	"semicolon",	-74,	0 },
+    { "V",	"period",	-129,	0 },
+    { "V",	"o",	-111,	0 },
+    { "V",	"i",	-55,	0 },
+    { "V",	"hyphen",	-70,	0 },
+    { "V",	"e",	-111,	0 },
+    { "V",	"comma",	-129,	0 },
+    { "V",	"colon",	-74,	0 },
+    { "V",	"a",	-111,	0 },
+    { "V",	"O",	-30,	0 },
+    { "V",	"G",	-10,	0 },
+    { "V",	"A",	-85,	0 },
+    { "W",	"y",	-55,	0 },
+    { "W",	"u",	-55,	0 },
+    { "W",	"semicolon",	-55,	0 },
+    { "W",	"period",	-74,	0 },
+    { "W",	"o",	-80,	0 },
+    { "W",	"i",	-37,	0 },
+    { "W",	"hyphen",	-50,	0 },
+    { "W",	"h",	0,	0 },
+    { "W",	"e",	-90,	0 },
+    { "W",	"comma",	-74,	0 },
+    { "W",	"colon",	-55,	0 },
+    { "W",	"a",	-85,	0 },
+    { "W",	"O",	-15,	0 },
+    { "W",	"A",	-74,	0 },
+    { "Y",	"u",	-92,	0 },
+    { "Y",	"semicolon",	-92,	0 },
+    { "Y",	"period",	-74,	0 },
+    { "Y",	"o",	-111,	0 },
+    { "Y",	"i",	-55,	0 },
+    { "Y",	"hyphen",	-92,	0 },
+    { "Y",	"e",	-111,	0 },
+    { "Y",	"comma",	-92,	0 },
+    { "Y",	"colon",	-92,	0 },
+    { "Y",	"a",	-92,	0 },
+    { "Y",	"O",	-25,	0 },
+    { "Y",	"A",	-74,	0 },
+    { "a",	"y",	0,	0 },
+    { "a",	"w",	0,	0 },
+    { "a",	"v",	0,	0 },
+    { "a",	"t",	0,	0 },
+    { "a",	"p",	0,	0 },
+    { "a",	"g",	0,	0 },
+    { "a",	"b",	0,	0 },
+    { "b",	"y",	0,	0 },
+    { "b",	"v",	0,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"period",	-40,	0 },
+    { "b",	"l",	0,	0 },
+    { "b",	"comma",	0,	0 },
+    { "b",	"b",	-10,	0 },
+    { "c",	"y",	0,	0 },
+    { "c",	"period",	0,	0 },
+    { "c",	"l",	0,	0 },
+    { "c",	"k",	-10,	0 },
+    { "c",	"h",	-10,	0 },
+    { "c",	"comma",	0,	0 },
+    { "colon",	"space",	0,	0 },
+    { "comma",	"space",	0,	0 },
+    { "comma",	"quoteright",	-95,	0 },
+    { "comma",	"quotedblright",	-95,	0 },
+    { "d",	"y",	0,	0 },
+    { "d",	"w",	0,	0 },
+    { "d",	"v",	0,	0 },
+    { "d",	"period",	0,	0 },
+    { "d",	"d",	0,	0 },
+    { "d",	"comma",	0,	0 },
+    { "e",	"y",	0,	0 },
+    { "e",	"x",	0,	0 },
+    { "e",	"w",	0,	0 },
+    { "e",	"v",	0,	0 },
+    { "e",	"period",	0,	0 },
+    { "e",	"p",	0,	0 },
+    { "e",	"g",	0,	0 },
+    { "e",	"comma",	0,	0 },
+    { "e",	"b",	-10,	0 },
+    { "f",	"quoteright",	55,	0 },
+    { "f",	"quotedblright",	0,	0 },
+    { "f",	"period",	-10,	0 },
+    { "f",	"o",	-10,	0 },
+    { "f",	"l",	0,	0 },
+    { "f",	"i",	0,	0 },
+    { "f",	"f",	-18,	0 },
+    { "f",	"e",	-10,	0 },
+    { "f",	"dotlessi",	-30,	0 },
+    { "f",	"comma",	-10,	0 },
+    { "f",	"a",	0,	0 },
+    { "g",	"y",	0,	0 },
+    { "g",	"r",	0,	0 },
+    { "g",	"period",	0,	0 },
+    { "g",	"o",	0,	0 },
+    { "g",	"i",	0,	0 },
+    { "g",	"g",	0,	0 },
+    { "g",	"e",	0,	0 },
+    { "g",	"comma",	0,	0 },
+    { "g",	"a",	0,	0 },
+    { "h",	"y",	0,	0 },
+    { "i",	"v",	0,	0 },
+    { "k",	"y",	0,	0 },
+    { "k",	"o",	-10,	0 },
+    { "k",	"e",	-30,	0 },
+    { "l",	"y",	0,	0 },
+    { "l",	"w",	0,	0 },
+    { "m",	"y",	0,	0 },
+    { "m",	"u",	0,	0 },
+    { "n",	"y",	0,	0 },
+    { "n",	"v",	-40,	0 },
+    { "n",	"u",	0,	0 },
+    { "o",	"y",	-10,	0 },
+    { "o",	"x",	-10,	0 },
+    { "o",	"w",	-25,	0 },
+    { "o",	"v",	-15,	0 },
+    { "o",	"g",	0,	0 },
+    { "p",	"y",	0,	0 },
+    { "period",	"quoteright",	-95,	0 },
+    { "period",	"quotedblright",	-95,	0 },
+    { "quotedblleft",	"quoteleft",	0,	0 },
+    { "quotedblleft",	"A",	0,	0 },
+    { "quotedblright",	"space",	0,	0 },
+    { "quoteleft",	"quoteleft",	-74,	0 },
+    { "quoteleft",	"A",	0,	0 },
+    { "quoteright",	"v",	-15,	0 },
+    { "quoteright",	"t",	-37,	0 },
+    { "quoteright",	"space",	-74,	0 },
+    { "quoteright",	"s",	-74,	0 },
+    { "quoteright",	"r",	-15,	0 },
+    { "quoteright",	"quoteright",	-74,	0 },
+    { "quoteright",	"quotedblright",	0,	0 },
+    { "quoteright",	"l",	0,	0 },
+    { "quoteright",	"d",	-15,	0 },
+    { "r",	"y",	0,	0 },
+    { "r",	"v",	0,	0 },
+    { "r",	"u",	0,	0 },
+    { "r",	"t",	0,	0 },
+    { "r",	"s",	0,	0 },
+    { "r",	"r",	0,	0 },
+    { "r",	"q",	0,	0 },
+    { "r",	"period",	-65,	0 },
+    { "r",	"p",	0,	0 },
+    { "r",	"o",	0,	0 },
+    { "r",	"n",	0,	0 },
+    { "r",	"m",	0,	0 },
+    { "r",	"l",	0,	0 },
+    { "r",	"k",	0,	0 },
+    { "r",	"i",	0,	0 },
+    { "r",	"hyphen",	0,	0 },
+    { "r",	"g",	0,	0 },
+    { "r",	"e",	0,	0 },
+    { "r",	"d",	0,	0 },
+    { "r",	"comma",	-65,	0 },
+    { "r",	"c",	0,	0 },
+    { "r",	"a",	0,	0 },
+    { "s",	"w",	0,	0 },
+    { "space",	"quoteleft",	0,	0 },
+    { "space",	"quotedblleft",	0,	0 },
+    { "space",	"Y",	-70,	0 },
+    { "space",	"W",	-70,	0 },
+    { "space",	"V",	-70,	0 },
+    { "space",	"T",	0,	0 },
+    { "space",	"A",	-37,	0 },
+    { "v",	"period",	-37,	0 },
+    { "v",	"o",	-15,	0 },
+    { "v",	"e",	-15,	0 },
+    { "v",	"comma",	-37,	0 },
+    { "v",	"a",	0,	0 },
+    { "w",	"period",	-37,	0 },
+    { "w",	"o",	-15,	0 },
+    { "w",	"h",	0,	0 },
+    { "w",	"e",	-10,	0 },
+    { "w",	"comma",	-37,	0 },
+    { "w",	"a",	-10,	0 },
+    { "x",	"e",	-10,	0 },
+    { "y",	"period",	-37,	0 },
+    { "y",	"o",	0,	0 },
+    { "y",	"e",	0,	0 },
+    { "y",	"comma",	-37,	0 },
+    { "y",	"a",	0,	0 },
+    { "z",	"o",	0,	0 },
+    { "z",	"e",	0,	0 }
+};
+
+/* Kerning pairs for font Times-Italic */
+static PairKernData pdf_pairs_Times_Italic[] = {
+    { "A",	"y",	-55,	0 },
+    { "A",	"w",	-55,	0 },
+    { "A",	"v",	-55,	0 },
+    { "A",	"u",	-20,	0 },
+    { "A",	"quoteright",	-37,	0 },
+    { "A",	"quotedblright",	0,	0 },
+    { "A",	"p",	0,	0 },
+    { "A",	"Y",	-55,	0 },
+    { "A",	"W",	-95,	0 },
+    { "A",	"V",	-105,	0 },
+    { "A",	"U",	-50,	0 },
+    { "A",	"T",	-37,	0 },
+    { "A",	"Q",	-40,	0 },
+    { "A",	"O",	-40,	0 },
+    { "A",	"G",	-35,	0 },
+    { "A",	"C",	-30,	0 },
+    { "B",	"period",	0,	0 },
+    { "B",	"comma",	0,	0 },
+    { "B",	"U",	-10,	0 },
+    { "B",	"A",	-25,	0 },
+    { "D",	"period",	0,	0 },
+    { "D",	"comma",	0,	0 },
+    { "D",	"Y",	-40,	0 },
+    { "D",	"W",	-40,	0 },
+    { "D",	"V",	-40,	0 },
+    { "D",	"A",	-35,	0 },
+    { "F",	"r",	-55,	0 },
+    { "F",	"period",	-135,	0 },
+    { "F",	"o",	-105,	0 },
+    { "F",	"i",	-45,	0 },
+    { "F",	"e",	-75,	0 },
+    { "F",	"comma",	-135,	0 },
+    { "F",	"a",	-75,	0 },
+    { "F",	"A",	-115,	0 },
+    { "G",	"period",	0,	0 },
+    { "G",	"comma",	0,	0 },
+    { "J",	"u",	-35,	0 },
+    { "J",	"period",	-25,	0 },
+    { "J",	"o",	-25,	0 },
+    { "J",	"e",	-25,	0 },
+    { "J",	"comma",	-25,	0 },
+    { "J",	"a",	-35,	0 },
+    { "J",	"A",	-40,	0 },
+    { "K",	"y",	-40,	0 },
+    { "K",	"u",	-40,	0 },
+    { "K",	"o",	-40,	0 },
+    { "K",	"e",	-35,	0 },
+    { "K",	"O",	-50,	0 },
+    { "L",	"y",	-30,	0 },
+    { "L",	"quoteright",	-37,	0 },
+    { "L",	"quotedblright",	0,	0 },
+    { "L",	"Y",	-20,	0 },
+    { "L",	"W",	-55,	0 },
+    { "L",	"V",	-55,	0 },
+    { "L",	"T",	-20,	0 },
+    { "N",	"period",	0,	0 },
+    { "N",	"comma",	0,	0 },
+    { "N",	"A",	-27,	0 },
+    { "O",	"period",	0,	0 },
+    { "O",	"comma",	0,	0 },
+    { "O",	"Y",	-50,	0 },
+    { "O",	"X",	-40,	0 },
+    { "O",	"W",	-50,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-55,	0 },
+    { "P",	"period",	-135,	0 },
+    { "P",	"o",	-80,	0 },
+    { "P",	"e",	-80,	0 },
+    { "P",	"comma",	-135,	0 },
+    { "P",	"a",	-80,	0 },
+    { "P",	"A",	-90,	0 },
+    { "Q",	"period",	0,	0 },
+    { "Q",	"comma",	0,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-18,	0 },
+    { "R",	"W",	-18,	0 },
+    { "R",	"V",	-18,	0 },
+    { "R",	"U",	-40,	0 },
+    { "R",	"T",	0,	0 },
+    { "R",	"O",	-40,	0 },
+    { "S",	"period",	0,	0 },
+    { "S",	"comma",	0,	0 },
+    { "T",	"y",	-74,	0 },
+    { "T",	"w",	-74,	0 },
+    { "T",	"u",	-55,	0 },
+    { "T",	"semicolon",	-65,	0 },
+    { "T",	"r",	-55,	0 },
+    { "T",	"period",	-74,	0 },
+    { "T",	"o",	-92,	0 },
+    { "T",	"i",	-55,	0 },
+    { "T",	"hyphen",	-74,	0 },
+    { "T",	"h",	0,	0 },
+    { "T",	"e",	-92,	0 },
+    { "T",	"comma",	-74,	0 },
+    { "T",	"colon",	-55,	0 },
+    { "T",	"a",	-92,	0 },
+    { "T",	"O",	-18,	0 },
+    { "T",	"A",	-50,	0 },
+    { "U",	"period",	-25,	0 },
+    { "U",	"comma",	-25,	0 },
+    { "U",	"A",	-40,	0 },
+    { "V",	"u",	-74,	0 },
+    { "V",	"semicolon",	-74,	0 },
+    { "V",	"period",	-129,	0 },
+    { "V",	"o",	-111,	0 },
+    { "V",	"i",	-74,	0 },
+    { "V",	"hyphen",	-55,	0 },
+    { "V",	"e",	-111,	0 },
+    { "V",	"comma",	-129,	0 },
+    { "V",	"colon",	-65,	0 },
+    { "V",	"a",	-111,	0 },
+    { "V",	"O",	-30,	0 },
+    { "V",	"G",	0,	0 },
+    { "V",	"A",	-60,	0 },
+    { "W",	"y",	-70,	0 },
+    { "W",	"u",	-55,	0 },
+    { "W",	"semicolon",	-65,	0 },
+    { "W",	"period",	-92,	0 },
+    { "W",	"o",	-92,	0 },
+    { "W",	"i",	-55,	0 },
+    { "W",	"hyphen",	-37,	0 },
+    { "W",	"h",	0,	0 },
+    { "W",	"e",	-92,	0 },
+    { "W",	"comma",	-92,	0 },
+    { "W",	"colon",	-65,	0 },
+    { "W",	"a",	-92,	0 },
+    { "W",	"O",	-25,	0 },
+    { "W",	"A",	-60,	0 },
+    { "Y",	"u",	-92,	0 },
+    { "Y",	"semicolon",	-65,	0 },
+    { "Y",	"period",	-92,	0 },
+    { "Y",	"o",	-92,	0 },
+    { "Y",	"i",	-74,	0 },
+    { "Y",	"hyphen",	-74,	0 },
+    { "Y",	"e",	-92,	0 },
+    { "Y",	"comma",	-92,	0 },
+    { "Y",	"colon",	-65,	0 },
+    { "Y",	"a",	-92,	0 },
+    { "Y",	"O",	-15,	0 },
+    { "Y",	"A",	-50,	0 },
+    { "a",	"y",	0,	0 },
+    { "a",	"w",	0,	0 },
+    { "a",	"v",	0,	0 },
+    { "a",	"t",	0,	0 },
+    { "a",	"p",	0,	0 },
+    { "a",	"g",	-10,	0 },
+    { "a",	"b",	0,	0 },
+    { "b",	"y",	0,	0 },
+    { "b",	"v",	0,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"period",	-40,	0 },
+    { "b",	"l",	0,	0 },
+    { "b",	"comma",	0,	0 },
+    { "b",	"b",	0,	0 },
+    { "c",	"y",	0,	0 },
+    { "c",	"period",	0,	0 },
+    { "c",	"l",	0,	0 },
+    { "c",	"k",	-20,	0 },
+    { "c",	"h",	-15,	0 },
+    { "c",	"comma",	0,	0 },
+    { "colon",	"space",	0,	0 },
+    { "comma",	"space",	0,	0 },
+    { "comma",	"quoteright",	-140,	0 },
+    { "comma",	"quotedblright",	-140,	0 },
+    { "d",	"y",	0,	0 },
+    { "d",	"w",	0,	0 },
+    { "d",	"v",	0,	0 },
+    { "d",	"period",	0,	0 },
+    { "d",	"d",	0,	0 },
+    { "d",	"comma",	0,	0 },
+    { "e",	"y",	-30,	0 },
+    { "e",	"x",	-20,	0 },
+    { "e",	"w",	-15,	0 },
+    { "e",	"v",	-15,	0 },
+    { "e",	"period",	-15,	0 },
+    { "e",	"p",	0,	0 },
+    { "e",	"g",	-40,	0 },
+    { "e",	"comma",	-10,	0 },
+    { "e",	"b",	0,	0 },
+    { "f",	"quoteright",	92,	0 },
+    { "f",	"quotedblright",	0,	0 },
+    { "f",	"period",	-15,	0 },
+    { "f",	"o",	0,	0 },
+    { "f",	"l",	0,	0 },
+    { "f",	"i",	-20,	0 },
+    { "f",	"f",	-18,	0 },
+    { "f",	"e",	0,	0 },
+    { "f",	"dotlessi",	-60,	0 },
+    { "f",	"comma",	-10,	0 },
+    { "f",	"a",	0,	0 },
+    { "g",	"y",	0,	0 },
+    { "g",	"r",	0,	0 },
+    { "g",	"period",	-15,	0 },
+    { "g",	"o",	0,	0 },
+    { "g",	"i",	0,	0 },
+    { "g",	"g",	-10,	0 },
+    { "g",	"e",	-10,	0 },
+    { "g",	"comma",	-10,	0 },
+    { "g",	"a",	0,	0 },
+    { "h",	"y",	0,	0 },
+    { "i",	"v",	0,	0 },
+    { "k",	"y",	-10,	0 },
+    { "k",	"o",	-10,	0 },
+    { "k",	"e",	-10,	0 },
+    { "l",	"y",	0,	0 },
+    { "l",	"w",	0,	0 },
+    { "m",	"y",	0,	0 },
+    { "m",	"u",	0,	0 },
+    { "n",	"y",	0,	0 },
+    { "n",	"v",	-40,	0 },
+    { "n",	"u",	0,	0 },
+    { "o",	"y",	0,	0 },
+    { "o",	"x",	0,	0 },
+    { "o",	"w",	0,	0 },
+    { "o",	"v",	-10,	0 },
+    { "o",	"g",	-10,	0 },
+    { "p",	"y",	0,	0 },
+    { "period",	"quoteright",	-140,	0 },
+    { "period",	"quotedblright",	-140,	0 },
+    { "quotedblleft",	"quoteleft",	0,	0 },
+    { "quotedblleft",	"A",	0,	0 },
+    { "quotedblright",	"space",	0,	0 },
+    { "quoteleft",	"quoteleft",	-111,	0 },
+    { "quoteleft",	"A",	0,	0 },
+    { "quoteright",	"v",	-10,	0 },
+    { "quoteright",	"t",	-30,	0 },
+    { "quoteright",	"space",	-111,	0 },
+    { "quoteright",	"s",	-40,	0 },
+    { "quoteright",	"r",	-25,	0 },
+    { "quoteright",	"quoteright",	-111,	0 },
+    { "quoteright",	"quotedblright",	0,	0 },
+    { "quoteright",	"l",	0,	0 },
+    { "quoteright",	"d",	-25,	0 },
+    { "r",	"y",	0,	0 },
+    { "r",	"v",	0,	0 },
+    { "r",	"u",	0,	0 },
+    { "r",	"t",	0,	0 },
+    { "r",	"s",	-10,	0 },
+    { "r",	"r",	0,	0 },
+    { "r",	"q",	-37,	0 },
+    { "r",	"period",	-111,	0 },
+    { "r",	"p",	0,	0 },
+    { "r",	"o",	-45,	0 },
+    { "r",	"n",	0,	0 },
+    { "r",	"m",	0,	0 },
+    { "r",	"l",	0,	0 },
+    { "r",	"k",	0,	0 },
+    { "r",	"i",	0,	0 },
+    { "r",	"hyphen",	-20,	0 },
+    { "r",	"g",	-37,	0 },
+    { "r",	"e",	-37,	0 },
+    { "r",	"d",	-37,	0 },
+    { "r",	"comma",	-111,	0 },
+    { "r",	"c",	-37,	0 },
+    { "r",	"a",	-15,	0 },
+    { "s",	"w",	0,	0 },
+    { "space",	"quoteleft",	0,	0 },
+    { "space",	"quotedblleft",	0,	0 },
+    { "space",	"Y",	-75,	0 },
+    { "space",	"W",	-40,	0 },
+    { "space",	"V",	-35,	0 },
+    { "space",	"T",	-18,	0 },
+    { "space",	"A",	-18,	0 },
+    { "v",	"period",	-74,	0 },
+    { "v",	"o",	0,	0 },
+    { "v",	"e",	0,	0 },
+    { "v",	"comma",	-74,	0 },
+    { "v",	"a",	0,	0 },
+    { "w",	"period",	-74,	0 },
+    { "w",	"o",	0,	0 },
+    { "w",	"h",	0,	0 },
+    { "w",	"e",	0,	0 },
+    { "w",	"comma",	-74,	0 },
+    { "w",	"a",	0,	0 },
+    { "x",	"e",	0,	0 },
+    { "y",	"period",	-55,	0 },
+    { "y",	"o",	0,	0 },
+    { "y",	"e",	0,	0 },
+    { "y",	"comma",	-55,	0 },
+    { "y",	"a",	0,	0 },
+    { "z",	"o",	0,	0 },
+    { "z",	"e",	0,	0 }
+};
+
+/* Kerning pairs for font Times-Roman */
+static PairKernData pdf_pairs_Times_Roman[] = {
+    { "A",	"y",	-92,	0 },
+    { "A",	"w",	-92,	0 },
+    { "A",	"v",	-74,	0 },
+    { "A",	"u",	0,	0 },
+    { "A",	"quoteright",	-111,	0 },
+    { "A",	"quotedblright",	0,	0 },
+    { "A",	"p",	0,	0 },
+    { "A",	"Y",	-105,	0 },
+    { "A",	"W",	-90,	0 },
+    { "A",	"V",	-135,	0 },
+    { "A",	"U",	-55,	0 },
+    { "A",	"T",	-111,	0 },
+    { "A",	"Q",	-55,	0 },
+    { "A",	"O",	-55,	0 },
+    { "A",	"G",	-40,	0 },
+    { "A",	"C",	-40,	0 },
+    { "B",	"period",	0,	0 },
+    { "B",	"comma",	0,	0 },
+    { "B",	"U",	-10,	0 },
+    { "B",	"A",	-35,	0 },
+    { "D",	"period",	0,	0 },
+    { "D",	"comma",	0,	0 },
+    { "D",	"Y",	-55,	0 },
+    { "D",	"W",	-30,	0 },
+    { "D",	"V",	-40,	0 },
+    { "D",	"A",	-40,	0 },
+    { "F",	"r",	0,	0 },
+    { "F",	"period",	-80,	0 },
+    { "F",	"o",	-15,	0 },
+    { "F",	"i",	0,	0 },
+    { "F",	"e",	0,	0 },
+    { "F",	"comma",	-80,	0 },
+    { "F",	"a",	-15,	0 },
+    { "F",	"A",	-74,	0 },
+    { "G",	"period",	0,	0 },
+    { "G",	"comma",	0,	0 },
+    { "J",	"u",	0,	0 },
+    { "J",	"period",	0,	0 },
+    { "J",	"o",	0,	0 },
+    { "J",	"e",	0,	0 },
+    { "J",	"comma",	0,	0 },
+    { "J",	"a",	0,	0 },
+    { "J",	"A",	-60,	0 },
+    { "K",	"y",	-25,	0 },
+    { "K",	"u",	-15,	0 },
+    { "K",	"o",	-35,	0 },
+    { "K",	"e",	-25,	0 },
+    { "K",	"O",	-30,	0 },
+    { "L",	"y",	-55,	0 },
+    { "L",	"quoteright",	-92,	0 },
+    { "L",	"quotedblright",	0,	0 },
+    { "L",	"Y",	-100,	0 },
+    { "L",	"W",	-74,	0 },
+    { "L",	"V",	-100,	0 },
+    { "L",	"T",	-92,	0 },
+    { "N",	"period",	0,	0 },
+    { "N",	"comma",	0,	0 },
+    { "N",	"A",	-35,	0 },
+    { "O",	"period",	0,	0 },
+    { "O",	"comma",	0,	0 },
+    { "O",	"Y",	-50,	0 },
+    { "O",	"X",	-40,	0 },
+    { "O",	"W",	-35,	0 },
+    { "O",	"V",	-50,	0 },
+    { "O",	"T",	-40,	0 },
+    { "O",	"A",	-35,	0 },
+    { "P",	"period",	-111,	0 },
+    { "P",	"o",	0,	0 },
+    { "P",	"e",	0,	0 },
+    { "P",	"comma",	-111,	0 },
+    { "P",	"a",	-15,	0 },
+    { "P",	"A",	-92,	0 },
+    { "Q",	"period",	0,	0 },
+    { "Q",	"comma",	0,	0 },
+    { "Q",	"U",	-10,	0 },
+    { "R",	"Y",	-65,	0 },
+    { "R",	"W",	-55,	0 },
+    { "R",	"V",	-80,	0 },
+    { "R",	"U",	-40,	0 },
+    { "R",	"T",	-60,	0 },
+    { "R",	"O",	-40,	0 },
+    { "S",	"period",	0,	0 },
+    { "S",	"comma",	0,	0 },
+    { "T",	"y",	-80,	0 },
+    { "T",	"w",	-80,	0 },
+    { "T",	"u",	-45,	0 },
+    { "T",	"semicolon",	-55,	0 },
+    { "T",	"r",	-35,	0 },
+    { "T",	"period",	-74,	0 },
+    { "T",	"o",	-80,	0 },
+    { "T",	"i",	-35,	0 },
+    { "T",	"hyphen",	-92,	0 },
+    { "T",	"h",	0,	0 },
+    { "T",	"e",	-70,	0 },
+    { "T",	"comma",	-74,	0 },
+    { "T",	"colon",	-50,	0 },
+    { "T",	"a",	-80,	0 },
+    { "T",	"O",	-18,	0 },
+    { "T",	"A",	-93,	0 },
+    { "U",	"period",	0,	0 },
+    { "U",	"comma",	0,	0 },
+    { "U",	"A",	-40,	0 },
+    { "V",	"u",	-75,	0 },
+    { "V",	"semicolon",	-74,	0 },
+    { "V",	"period",	-129,	0 },
+    { "V",	"o",	-129,	0 },
+    { "V",	"i",	-60,	0 },
+    { "V",	"hyphen",	-100,	0 },
+    { "V",	"e",	-111,	0 },
+    { "V",	"comma",	-129,	0 },
+    { "V",	"colon",	-74,	0 },
+    { "V",	"a",	-111,	0 },
+    { "V",	"O",	-40,	0 },
+    { "V",	"G",	-15,	0 },
+    { "V",	"A",	-135,	0 },
+    { "W",	"y",	-73,	0 },
+    { "W",	"u",	-50,	0 },
+    { "W",	"semicolon",	-37,	0 },
+    { "W",	"period",	-92,	0 },
+    { "W",	"o",	-80,	0 },
+    { "W",	"i",	-40,	0 },
+    { "W",	"hyphen",	-65,	0 },
+    { "W",	"h",	0,	0 },
+    { "W",	"e",	-80,	0 },
+    { "W",	"comma",	-92,	0 },
+    { "W",	"colon",	-37,	0 },
+    { "W",	"a",	-80,	0 },
+    { "W",	"O",	-10,	0 },
+    { "W",	"A",	-120,	0 },
+    { "Y",	"u",	-111,	0 },
+    { "Y",	"semicolon",	-92,	0 },
+    { "Y",	"period",	-129,	0 },
+    { "Y",	"o",	-110,	0 },
+    { "Y",	"i",	-55,	0 },
+    { "Y",	"hyphen",	-111,	0 },
+    { "Y",	"e",	-100,	0 },
+    { "Y",	"comma",	-129,	0 },
+    { "Y",	"colon",	-92,	0 },
+    { "Y",	"a",	-100,	0 },
+    { "Y",	"O",	-30,	0 },
+    { "Y",	"A",	-120,	0 },
+    { "a",	"y",	0,	0 },
+    { "a",	"w",	-15,	0 },
+    { "a",	"v",	-20,	0 },
+    { "a",	"t",	0,	0 },
+    { "a",	"p",	0,	0 },
+    { "a",	"g",	0,	0 },
+    { "a",	"b",	0,	0 },
+    { "b",	"y",	0,	0 },
+    { "b",	"v",	-15,	0 },
+    { "b",	"u",	-20,	0 },
+    { "b",	"period",	-40,	0 },
+    { "b",	"l",	0,	0 },
+    { "b",	"comma",	0,	0 },
+    { "b",	"b",	0,	0 },
+    { "c",	"y",	-15,	0 },
+    { "c",	"period",	0,	0 },
+    { "c",	"l",	0,	0 },
+    { "c",	"k",	0,	0 },
+    { "c",	"h",	0,	0 },
+    { "c",	"comma",	0,	0 },
+    { "colon",	"space",	0,	0 },
+    { "comma",	"space",	0,	0 },
+    { "comma",	"quoteright",	-70,	0 },
+    { "comma",	"quotedblright",	-70,	0 },
+    { "d",	"y",	0,	0 },
+    { "d",	"w",	0,	0 },
+    { "d",	"v",	0,	0 },
+    { "d",	"period",	0,	0 },
+    { "d",	"d",	0,	0 },
+    { "d",	"comma",	0,	0 },
+    { "e",	"y",	-15,	0 },
+    { "e",	"x",	-15,	0 },
+    { "e",	"w",	-25,	0 },
+    { "e",	"v",	-25,	0 },
+    { "e",	"period",	0,	0 },
+    { "e",	"p",	0,	0 },
+    { "e",	"g",	-15,	0 },
+    { "e",	"comma",	0,	0 },
+    { "e",	"b",	0,	0 },
+    { "f",	"quoteright",	55,	0 },
+    { "f",	"quotedblright",	0,	0 },
+    { "f",	"period",	0,	0 },
+    { "f",	"o",	0,	0 },
+    { "f",	"l",	0,	0 },
+    { "f",	"i",	-20,	0 },
+    { "f",	"f",	-25,	0 },
+    { "f",	"e",	0,	0 },
+    { "f",	"dotlessi",	-50,	0 },
+    { "f",	"comma",	0,	0 },
+    { "f",	"a",	-10,	0 },
+    { "g",	"y",	0,	0 },
+    { "g",	"r",	0,	0 },
+    { "g",	"period",	0,	0 },
+    { "g",	"o",	0,	0 },
+    { "g",	"i",	0,	0 },
+    { "g",	"g",	0,	0 },
+    { "g",	"e",	0,	0 },
+    { "g",	"comma",	0,	0 },
+    { "g",	"a",	-5,	0 },
+    { "h",	"y",	-5,	0 },
+    { "i",	"v",	-25,	0 },
+    { "k",	"y",	-15,	0 },
+    { "k",	"o",	-10,	0 },
+    { "k",	"e",	-10,	0 },
+    { "l",	"y",	0,	0 },
+    { "l",	"w",	-10,	0 },
+    { "m",	"y",	0,	0 },
+    { "m",	"u",	0,	0 },
+    { "n",	"y",	-15,	0 },
+    { "n",	"v",	-40,	0 },
+    { "n",	"u",	0,	0 },
+    { "o",	"y",	-10,	0 },
+    { "o",	"x",	0,	0 },
+    { "o",	"w",	-25,	0 },
+    { "o",	"v",	-15,	0 },
+    { "o",	"g",	0,	0 },
+    { "p",	"y",	-10,	0 },
+    { "period",	"quoteright",	-70,	0 },
+    { "period",	"quotedblright",	-70,	0 },
+    { "quotedblleft",	"quoteleft",	0,	0 },
+    { "quotedblleft",	"A",	-80,	0 },
+    { "quotedblright",	"space",	0,	0 },
+    { "quoteleft",	"quoteleft",	-74,	0 },
+    { "quoteleft",	"A",	-80,	0 },
+    { "quoteright",	"v",	-50,	0 },
+    { "quoteright",	"t",	-18,	0 },
+    { "quoteright",	"space",	-74,	0 },
+    { "quoteright",	"s",	-55,	0 },
+    { "quoteright",	"r",	-50,	0 },
+    { "quoteright",	"quoteright",	-74,	0 },
+    { "quoteright",	"quotedblright",	0,	0 },
+    { "quoteright",	"l",	-10,	0 },
+    { "quoteright",	"d",	-50,	0 },
+    { "r",	"y",	0,	0 },
+    { "r",	"v",	0,	0 },
+    { "r",	"u",	0,	0 },
+    { "r",	"t",	0,	0 },
+    { "r",	"s",	0,	0 },
+    { "r",	"r",	0,	0 },
+    { "r",	"q",	0,	0 },
+    { "r",	"period",	-55,	0 },
+    { "r",	"p",	0,	0 },
+    { "r",	"o",	0,	0 },
+    { "r",	"n",	0,	0 },
+    { "r",	"m",	0,	0 },
+    { "r",	"l",	0,	0 },
+    { "r",	"k",	0,	0 },
+    { "r",	"i",	0,	0 },
+    { "r",	"hyphen",	-20,	0 },
+    { "r",	"g",	-18,	0 },
+    { "r",	"e",	0,	0 },
+    { "r",	"d",	0,	0 },
+    { "r",	"comma",	-40,	0 },
+    { "r",	"c",	0,	0 },
+    { "r",	"a",	0,	0 },
+    { "s",	"w",	0,	0 },
+    { "space",	"quoteleft",	0,	0 },
+    { "space",	"quotedblleft",	0,	0 },
+    { "space",	"Y",	-90,	0 },
+    { "space",	"W",	-30,	0 },
+    { "space",	"V",	-50,	0 },
+    { "space",	"T",	-18,	0 },
+    { "space",	"A",	-55,	0 },
+    { "v",	"period",	-65,	0 },
+    { "v",	"o",	-20,	0 },
+    { "v",	"e",	-15,	0 },
+    { "v",	"comma",	-65,	0 },
+    { "v",	"a",	-25,	0 },
+    { "w",	"period",	-65,	0 },
+    { "w",	"o",	-10,	0 },
+    { "w",	"h",	0,	0 },
+    { "w",	"e",	0,	0 },
+    { "w",	"comma",	-65,	0 },
+    { "w",	"a",	-10,	0 },
+    { "x",	"e",	-15,	0 },
+    { "y",	"period",	-65,	0 },
+    { "y",	"o",	0,	0 },
+    { "y",	"e",	0,	0 },
+    { "y",	"comma",	-65,	0 },
+    { "y",	"a",	0,	0 },
+    { "z",	"o",	0,	0 },
+    { "z",	"e",	0,	0 }
+};
+
+#ifndef MAC
+
+pdf_font pdf_core_metrics[] = {
+
+/* ---------------------------------------------------------- */
+{	"Courier-Bold",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262177l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier Bold",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Bold",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-113,				/* llx */
+	-250,				/* lly */
+	749,				/* urx */
+	801,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	439,				/* xHeight */
+	626,				/* Ascender */
+	-142,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier-Bold */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Courier-BoldOblique",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262241l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier Bold Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Bold",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-56,				/* llx */
+	-250,				/* lly */
+	868,				/* urx */
+	801,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	439,				/* xHeight */
+	626,				/* Ascender */
+	-142,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier-BoldOblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Courier-Oblique",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	97l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Medium",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-28,				/* llx */
+	-250,				/* lly */
+	742,				/* urx */
+	805,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	426,				/* xHeight */
+	629,				/* Ascender */
+	-157,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier-Oblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Courier",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	33l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-28,				/* llx */
+	-250,				/* lly */
+	628,				/* urx */
+	805,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	426,				/* xHeight */
+	629,				/* Ascender */
+	-157,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x7f */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xaf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xb7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xbf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xd7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica-Bold",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262176l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica Bold",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Bold",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-170,				/* llx */
+	-228,				/* lly */
+	1003,				/* urx */
+	962,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	532,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	209,				/* numOfPairs */
+	pdf_pairs_Helvetica_Bold,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica-Bold */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
+	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
+	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
+	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
+	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
+	556,	556,	500,	389,	280,	389,	584,	350, /* 0x7f */
+	250,	350,	278,	556,	500,	1000,	556,	556, /* 0x87 */
+	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
+	350,	278,	278,	500,	500,	350,	556,	1000, /* 0x97 */
+	333,	1000,	556,	333,	944,	350,	500,	667, /* 0x9f */
+	278,	333,	556,	556,	556,	556,	280,	556, /* 0xa7 */
+	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
+	400,	584,	333,	333,	333,	611,	556,	278, /* 0xb7 */
+	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
+	722,	722,	722,	722,	722,	722,	1000,	722, /* 0xc7 */
+	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
+	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
+	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
+	556,	556,	556,	556,	556,	556,	889,	556, /* 0xe7 */
+	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
+	611,	611,	611,	611,	611,	611,	611,	584, /* 0xf7 */
+	611,	611,	611,	611,	611,	556,	611,	556  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica-BoldOblique",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262240l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica Bold Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Bold",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-174,				/* llx */
+	-228,				/* lly */
+	1114,				/* urx */
+	962,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	532,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	209,				/* numOfPairs */
+	pdf_pairs_Helvetica_BoldOblique,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica-BoldOblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
+	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
+	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
+	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
+	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
+	556,	556,	500,	389,	280,	389,	584,	350, /* 0x7f */
+	250,	350,	278,	556,	500,	1000,	556,	556, /* 0x87 */
+	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
+	350,	278,	278,	500,	500,	350,	556,	1000, /* 0x97 */
+	333,	1000,	556,	333,	944,	350,	500,	667, /* 0x9f */
+	278,	333,	556,	556,	556,	556,	280,	556, /* 0xa7 */
+	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
+	400,	584,	333,	333,	333,	611,	556,	278, /* 0xb7 */
+	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
+	722,	722,	722,	722,	722,	722,	1000,	722, /* 0xc7 */
+	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
+	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
+	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
+	556,	556,	556,	556,	556,	556,	889,	556, /* 0xe7 */
+	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
+	611,	611,	611,	611,	611,	611,	611,	584, /* 0xf7 */
+	611,	611,	611,	611,	611,	556,	611,	556  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica-Oblique",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	96l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Medium",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-170,				/* llx */
+	-225,				/* lly */
+	1116,				/* urx */
+	931,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	523,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	250,				/* numOfPairs */
+	pdf_pairs_Helvetica_Oblique,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica-Oblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
+	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
+	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
+	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
+	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
+	500,	500,	500,	334,	260,	334,	584,	350, /* 0x7f */
+	250,	350,	222,	556,	333,	1000,	556,	556, /* 0x87 */
+	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
+	350,	222,	222,	333,	333,	350,	556,	1000, /* 0x97 */
+	333,	1000,	500,	333,	944,	350,	500,	667, /* 0x9f */
+	278,	333,	556,	556,	556,	556,	260,	556, /* 0xa7 */
+	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
+	400,	584,	333,	333,	333,	556,	537,	278, /* 0xb7 */
+	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
+	667,	667,	667,	667,	667,	667,	1000,	722, /* 0xc7 */
+	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
+	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
+	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
+	556,	556,	556,	556,	556,	556,	889,	500, /* 0xe7 */
+	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
+	556,	556,	556,	556,	556,	556,	556,	584, /* 0xf7 */
+	611,	556,	556,	556,	556,	500,	556,	500  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	32l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-166,				/* llx */
+	-225,				/* lly */
+	1000,				/* urx */
+	931,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	523,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	250,				/* numOfPairs */
+	pdf_pairs_Helvetica,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
+	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
+	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
+	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
+	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
+	500,	500,	500,	334,	260,	334,	584,	350, /* 0x7f */
+	250,	350,	222,	556,	333,	1000,	556,	556, /* 0x87 */
+	333,	1000,	667,	333,	1000,	350,	611,	350, /* 0x8f */
+	350,	222,	222,	333,	333,	350,	556,	1000, /* 0x97 */
+	333,	1000,	500,	333,	944,	350,	500,	667, /* 0x9f */
+	278,	333,	556,	556,	556,	556,	260,	556, /* 0xa7 */
+	333,	737,	370,	556,	584,	333,	737,	333, /* 0xaf */
+	400,	584,	333,	333,	333,	556,	537,	278, /* 0xb7 */
+	333,	333,	365,	556,	834,	834,	834,	611, /* 0xbf */
+	667,	667,	667,	667,	667,	667,	1000,	722, /* 0xc7 */
+	667,	667,	667,	667,	278,	278,	278,	278, /* 0xcf */
+	722,	722,	778,	778,	778,	778,	778,	584, /* 0xd7 */
+	778,	722,	722,	722,	722,	667,	667,	611, /* 0xdf */
+	556,	556,	556,	556,	556,	556,	889,	500, /* 0xe7 */
+	556,	556,	556,	556,	278,	278,	278,	278, /* 0xef */
+	556,	556,	556,	556,	556,	556,	556,	584, /* 0xf7 */
+	611,	556,	556,	556,	556,	500,	556,	500  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Symbol",			/* FontName */
+	builtin,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	4l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Symbol",			/* Full name */
+	"FontSpecific",		/* Native encoding */
+	"Symbol",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-180,				/* llx */
+	-293,				/* lly */
+	1090,				/* urx */
+	1010,				/* ury */
+	-98,				/* UnderlinePosition */
+	54,				/* UnderlineThickness */
+	700,				/* CapHeight */
+	523,				/* xHeight */
+	800,				/* Ascender */
+	-200,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Symbol */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	713,	500,	549,	833,	778,	439, /* 0x27 */
+	333,	333,	500,	549,	250,	549,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	278,	278,	549,	549,	549,	444, /* 0x3f */
+	549,	722,	667,	722,	612,	611,	763,	603, /* 0x47 */
+	722,	333,	631,	722,	686,	889,	722,	722, /* 0x4f */
+	768,	741,	556,	592,	611,	690,	439,	768, /* 0x57 */
+	645,	795,	611,	333,	863,	333,	658,	500, /* 0x5f */
+	500,	631,	549,	549,	494,	439,	521,	411, /* 0x67 */
+	603,	329,	603,	549,	549,	576,	521,	549, /* 0x6f */
+	549,	521,	549,	603,	439,	576,	713,	686, /* 0x77 */
+	493,	686,	494,	480,	200,	480,	549,	250, /* 0x7f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
+	250,	620,	247,	549,	167,	713,	500,	753, /* 0xa7 */
+	753,	753,	753,	1042,	987,	603,	987,	603, /* 0xaf */
+	400,	549,	411,	549,	549,	713,	494,	460, /* 0xb7 */
+	549,	549,	549,	549,	1000,	603,	1000,	658, /* 0xbf */
+	823,	686,	795,	987,	768,	768,	823,	768, /* 0xc7 */
+	768,	713,	713,	713,	713,	713,	713,	713, /* 0xcf */
+	768,	713,	790,	790,	890,	823,	549,	250, /* 0xd7 */
+	713,	603,	603,	1042,	987,	603,	987,	603, /* 0xdf */
+	494,	329,	790,	790,	786,	713,	384,	384, /* 0xe7 */
+	384,	384,	384,	384,	494,	494,	494,	494, /* 0xef */
+	250,	329,	274,	686,	686,	686,	384,	384, /* 0xf7 */
+	384,	384,	384,	384,	494,	494,	494,	250  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-Bold",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262176l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Bold",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Bold",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-168,				/* llx */
+	-218,				/* lly */
+	1000,				/* urx */
+	935,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	676,				/* CapHeight */
+	461,				/* xHeight */
+	676,				/* Ascender */
+	-205,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_Bold,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-Bold */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	555,	500,	500,	1000,	833,	278, /* 0x27 */
+	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
+	930,	722,	667,	722,	722,	667,	611,	778, /* 0x47 */
+	778,	389,	500,	778,	667,	944,	722,	778, /* 0x4f */
+	611,	778,	722,	556,	667,	722,	722,	1000, /* 0x57 */
+	722,	722,	667,	333,	278,	333,	581,	500, /* 0x5f */
+	333,	500,	556,	444,	556,	444,	333,	500, /* 0x67 */
+	556,	278,	333,	556,	278,	833,	556,	500, /* 0x6f */
+	556,	556,	444,	389,	333,	556,	500,	722, /* 0x77 */
+	500,	500,	444,	394,	220,	394,	520,	350, /* 0x7f */
+	250,	350,	333,	500,	500,	1000,	500,	500, /* 0x87 */
+	333,	1000,	556,	333,	1000,	350,	667,	350, /* 0x8f */
+	350,	333,	333,	500,	500,	350,	500,	1000, /* 0x97 */
+	333,	1000,	389,	333,	722,	350,	444,	722, /* 0x9f */
+	250,	333,	500,	500,	500,	500,	220,	500, /* 0xa7 */
+	333,	747,	300,	500,	570,	333,	747,	333, /* 0xaf */
+	400,	570,	300,	300,	333,	556,	540,	250, /* 0xb7 */
+	333,	300,	330,	500,	750,	750,	750,	500, /* 0xbf */
+	722,	722,	722,	722,	722,	722,	1000,	722, /* 0xc7 */
+	667,	667,	667,	667,	389,	389,	389,	389, /* 0xcf */
+	722,	722,	778,	778,	778,	778,	778,	570, /* 0xd7 */
+	778,	722,	722,	722,	722,	722,	611,	556, /* 0xdf */
+	500,	500,	500,	500,	500,	500,	722,	444, /* 0xe7 */
+	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
+	500,	556,	500,	500,	500,	500,	500,	570, /* 0xf7 */
+	500,	556,	556,	556,	556,	500,	556,	500  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-BoldItalic",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262240l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Bold Italic",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Bold",				/* Weight */
+	(float) -15.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-200,				/* llx */
+	-218,				/* lly */
+	996,				/* urx */
+	921,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	669,				/* CapHeight */
+	462,				/* xHeight */
+	699,				/* Ascender */
+	-205,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_BoldItalic,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-BoldItalic */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	389,	555,	500,	500,	833,	778,	278, /* 0x27 */
+	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
+	832,	667,	667,	667,	722,	667,	667,	722, /* 0x47 */
+	778,	389,	500,	667,	611,	889,	722,	722, /* 0x4f */
+	611,	722,	667,	556,	611,	722,	667,	889, /* 0x57 */
+	667,	611,	611,	333,	278,	333,	570,	500, /* 0x5f */
+	333,	500,	500,	444,	500,	444,	333,	500, /* 0x67 */
+	556,	278,	278,	500,	278,	778,	556,	500, /* 0x6f */
+	500,	500,	389,	389,	278,	556,	444,	667, /* 0x77 */
+	500,	444,	389,	348,	220,	348,	570,	350, /* 0x7f */
+	250,	350,	333,	500,	500,	1000,	500,	500, /* 0x87 */
+	333,	1000,	556,	333,	944,	350,	611,	350, /* 0x8f */
+	350,	333,	333,	500,	500,	350,	500,	1000, /* 0x97 */
+	333,	1000,	389,	333,	722,	350,	389,	611, /* 0x9f */
+	250,	389,	500,	500,	500,	500,	220,	500, /* 0xa7 */
+	333,	747,	266,	500,	606,	333,	747,	333, /* 0xaf */
+	400,	570,	300,	300,	333,	576,	500,	250, /* 0xb7 */
+	333,	300,	300,	500,	750,	750,	750,	500, /* 0xbf */
+	667,	667,	667,	667,	667,	667,	944,	667, /* 0xc7 */
+	667,	667,	667,	667,	389,	389,	389,	389, /* 0xcf */
+	722,	722,	722,	722,	722,	722,	722,	570, /* 0xd7 */
+	722,	722,	722,	722,	722,	611,	611,	500, /* 0xdf */
+	500,	500,	500,	500,	500,	500,	722,	444, /* 0xe7 */
+	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
+	500,	556,	500,	500,	500,	500,	500,	570, /* 0xf7 */
+	500,	556,	556,	556,	556,	444,	500,	444  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-Italic",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	96l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Italic",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Medium",				/* Weight */
+	(float) -15.5,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-169,				/* llx */
+	-217,				/* lly */
+	1010,				/* urx */
+	883,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	653,				/* CapHeight */
+	441,				/* xHeight */
+	683,				/* Ascender */
+	-205,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_Italic,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-Italic */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	420,	500,	500,	833,	778,	214, /* 0x27 */
+	333,	333,	500,	675,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	333,	333,	675,	675,	675,	500, /* 0x3f */
+	920,	611,	611,	667,	722,	611,	611,	722, /* 0x47 */
+	722,	333,	444,	667,	556,	833,	667,	722, /* 0x4f */
+	611,	722,	611,	500,	556,	722,	611,	833, /* 0x57 */
+	611,	556,	556,	389,	278,	389,	422,	500, /* 0x5f */
+	333,	500,	500,	444,	500,	444,	278,	500, /* 0x67 */
+	500,	278,	278,	444,	278,	722,	500,	500, /* 0x6f */
+	500,	500,	389,	389,	278,	500,	444,	667, /* 0x77 */
+	444,	444,	389,	400,	275,	400,	541,	350, /* 0x7f */
+	250,	350,	333,	500,	556,	889,	500,	500, /* 0x87 */
+	333,	1000,	500,	333,	944,	350,	556,	350, /* 0x8f */
+	350,	333,	333,	556,	556,	350,	500,	889, /* 0x97 */
+	333,	980,	389,	333,	667,	350,	389,	556, /* 0x9f */
+	250,	389,	500,	500,	500,	500,	275,	500, /* 0xa7 */
+	333,	760,	276,	500,	675,	333,	760,	333, /* 0xaf */
+	400,	675,	300,	300,	333,	500,	523,	250, /* 0xb7 */
+	333,	300,	310,	500,	750,	750,	750,	500, /* 0xbf */
+	611,	611,	611,	611,	611,	611,	889,	667, /* 0xc7 */
+	611,	611,	611,	611,	333,	333,	333,	333, /* 0xcf */
+	722,	667,	722,	722,	722,	722,	722,	675, /* 0xd7 */
+	722,	722,	722,	722,	722,	556,	611,	500, /* 0xdf */
+	500,	500,	500,	500,	500,	500,	667,	444, /* 0xe7 */
+	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
+	500,	500,	500,	500,	500,	500,	500,	675, /* 0xf7 */
+	500,	500,	500,	500,	500,	444,	500,	444  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-Roman",			/* FontName */
+	winansi,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	32l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Roman",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Roman",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-168,				/* llx */
+	-218,				/* lly */
+	1000,				/* urx */
+	898,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	662,				/* CapHeight */
+	450,				/* xHeight */
+	683,				/* Ascender */
+	-217,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_Roman,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-Roman */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	408,	500,	500,	833,	778,	180, /* 0x27 */
+	333,	333,	500,	564,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	278,	278,	564,	564,	564,	444, /* 0x3f */
+	921,	722,	667,	667,	722,	611,	556,	722, /* 0x47 */
+	722,	333,	389,	722,	611,	889,	722,	722, /* 0x4f */
+	556,	722,	667,	556,	611,	722,	722,	944, /* 0x57 */
+	722,	722,	611,	333,	278,	333,	469,	500, /* 0x5f */
+	333,	444,	500,	444,	500,	444,	333,	500, /* 0x67 */
+	500,	278,	278,	500,	278,	778,	500,	500, /* 0x6f */
+	500,	500,	333,	389,	278,	500,	500,	722, /* 0x77 */
+	500,	500,	444,	480,	200,	480,	541,	350, /* 0x7f */
+	250,	350,	333,	500,	444,	1000,	500,	500, /* 0x87 */
+	333,	1000,	556,	333,	889,	350,	611,	350, /* 0x8f */
+	350,	333,	333,	444,	444,	350,	500,	1000, /* 0x97 */
+	333,	980,	389,	333,	722,	350,	444,	722, /* 0x9f */
+	250,	333,	500,	500,	500,	500,	200,	500, /* 0xa7 */
+	333,	760,	276,	500,	564,	333,	760,	333, /* 0xaf */
+	400,	564,	300,	300,	333,	500,	453,	250, /* 0xb7 */
+	333,	300,	310,	500,	750,	750,	750,	444, /* 0xbf */
+	722,	722,	722,	722,	722,	722,	889,	667, /* 0xc7 */
+	611,	611,	611,	611,	333,	333,	333,	333, /* 0xcf */
+	722,	722,	722,	722,	722,	722,	722,	564, /* 0xd7 */
+	722,	722,	722,	722,	722,	722,	556,	500, /* 0xdf */
+	444,	444,	444,	444,	444,	444,	667,	444, /* 0xe7 */
+	444,	444,	444,	444,	278,	278,	278,	278, /* 0xef */
+	500,	500,	500,	500,	500,	500,	500,	564, /* 0xf7 */
+	500,	500,	500,	500,	500,	500,	500,	500  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"ZapfDingbats",			/* FontName */
+	builtin,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	4l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"ITC Zapf Dingbats",			/* Full name */
+	"FontSpecific",		/* Native encoding */
+	"ITC Zapf Dingbats",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-1,				/* llx */
+	-143,				/* lly */
+	981,				/* urx */
+	820,				/* ury */
+	-98,				/* UnderlinePosition */
+	54,				/* UnderlineThickness */
+	700,				/* CapHeight */
+	450,				/* xHeight */
+	800,				/* Ascender */
+	-200,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font ZapfDingbats */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	974,	961,	974,	980,	719,	789,	790, /* 0x27 */
+	791,	690,	960,	939,	549,	855,	911,	933, /* 0x2f */
+	911,	945,	974,	755,	846,	762,	761,	571, /* 0x37 */
+	677,	763,	760,	759,	754,	494,	552,	537, /* 0x3f */
+	577,	692,	786,	788,	788,	790,	793,	794, /* 0x47 */
+	816,	823,	789,	841,	823,	833,	816,	831, /* 0x4f */
+	923,	744,	723,	749,	790,	792,	695,	776, /* 0x57 */
+	768,	792,	759,	707,	708,	682,	701,	826, /* 0x5f */
+	815,	789,	789,	707,	687,	696,	689,	786, /* 0x67 */
+	787,	713,	791,	785,	791,	873,	761,	762, /* 0x6f */
+	762,	759,	759,	892,	892,	788,	784,	438, /* 0x77 */
+	138,	277,	415,	392,	392,	668,	668,	250, /* 0x7f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
+	250,	732,	544,	544,	910,	667,	760,	760, /* 0xa7 */
+	776,	595,	694,	626,	788,	788,	788,	788, /* 0xaf */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xb7 */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xbf */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xc7 */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xcf */
+	788,	788,	788,	788,	894,	838,	1016,	458, /* 0xd7 */
+	748,	924,	748,	918,	927,	928,	928,	834, /* 0xdf */
+	873,	828,	924,	924,	917,	930,	931,	463, /* 0xe7 */
+	883,	836,	836,	867,	867,	696,	696,	874, /* 0xef */
+	250,	874,	760,	946,	771,	865,	771,	888, /* 0xf7 */
+	967,	888,	831,	873,	927,	970,	918,	250  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+}
+};
+
+#else /* MAC */
+
+pdf_font pdf_core_metrics[] = {
+
+/* ---------------------------------------------------------- */
+{	"Courier-Bold",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262177l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier Bold",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Bold",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-113,				/* llx */
+	-250,				/* lly */
+	749,				/* urx */
+	801,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	439,				/* xHeight */
+	626,				/* Ascender */
+	-142,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier-Bold */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
+	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
+	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
+	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
+	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Courier-BoldOblique",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262241l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier Bold Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Bold",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-56,				/* llx */
+	-250,				/* lly */
+	868,				/* urx */
+	801,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	439,				/* xHeight */
+	626,				/* Ascender */
+	-142,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier-BoldOblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
+	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
+	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
+	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
+	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Courier-Oblique",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	97l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Medium",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-28,				/* llx */
+	-250,				/* lly */
+	742,				/* urx */
+	805,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	426,				/* xHeight */
+	629,				/* Ascender */
+	-157,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier-Oblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
+	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
+	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
+	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
+	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Courier",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	33l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Courier",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Courier",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	1,				/* isFixedPitch */
+	-28,				/* llx */
+	-250,				/* lly */
+	628,				/* urx */
+	805,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	562,				/* CapHeight */
+	426,				/* xHeight */
+	629,				/* Ascender */
+	-157,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Courier */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x27 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x2f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x37 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x3f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x47 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x4f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x57 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x5f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x67 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x6f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x77 */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0x7f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x87 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x8f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x97 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0x9f */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xa7 */
+	600,	600,	600,	600,	600,	250,	600,	600, /* 0xaf */
+	250,	600,	250,	250,	600,	600,	250,	250, /* 0xb7 */
+	250,	250,	250,	600,	600,	250,	600,	600, /* 0xbf */
+	600,	600,	600,	250,	600,	250,	250,	600, /* 0xc7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xcf */
+	600,	600,	600,	600,	600,	600,	600,	250, /* 0xd7 */
+	600,	600,	600,	600,	250,	250,	600,	600, /* 0xdf */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xe7 */
+	600,	600,	600,	600,	600,	600,	600,	600, /* 0xef */
+	250,	600,	600,	600,	600,	600,	600,	600, /* 0xf7 */
+	600,	600,	600,	600,	600,	600,	600,	600  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica-Bold",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262176l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica Bold",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Bold",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-170,				/* llx */
+	-228,				/* lly */
+	1003,				/* urx */
+	962,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	532,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	209,				/* numOfPairs */
+	pdf_pairs_Helvetica_Bold,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica-Bold */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
+	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
+	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
+	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
+	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
+	556,	556,	500,	389,	280,	389,	584,	250, /* 0x7f */
+	722,	722,	722,	667,	722,	778,	722,	556, /* 0x87 */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x8f */
+	556,	556,	278,	278,	278,	278,	611,	611, /* 0x97 */
+	611,	611,	611,	611,	611,	611,	611,	611, /* 0x9f */
+	556,	400,	556,	556,	556,	350,	556,	611, /* 0xa7 */
+	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
+	250,	584,	250,	250,	556,	611,	250,	250, /* 0xb7 */
+	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
+	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
+	556,	1000,	278,	722,	722,	778,	1000,	944, /* 0xcf */
+	556,	1000,	500,	500,	278,	278,	584,	250, /* 0xd7 */
+	556,	667,	167,	556,	250,	250,	611,	611, /* 0xdf */
+	556,	278,	278,	500,	1000,	722,	667,	722, /* 0xe7 */
+	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
+	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica-BoldOblique",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262240l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica Bold Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Bold",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-174,				/* llx */
+	-228,				/* lly */
+	1114,				/* urx */
+	962,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	532,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	209,				/* numOfPairs */
+	pdf_pairs_Helvetica_BoldOblique,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica-BoldOblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	333,	474,	556,	556,	889,	722,	238, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	333,	333,	584,	584,	584,	611, /* 0x3f */
+	975,	722,	722,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	556,	722,	611,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	333,	278,	333,	584,	556, /* 0x5f */
+	333,	556,	611,	556,	611,	556,	333,	611, /* 0x67 */
+	611,	278,	278,	556,	278,	889,	611,	611, /* 0x6f */
+	611,	611,	389,	556,	333,	611,	556,	778, /* 0x77 */
+	556,	556,	500,	389,	280,	389,	584,	250, /* 0x7f */
+	722,	722,	722,	667,	722,	778,	722,	556, /* 0x87 */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x8f */
+	556,	556,	278,	278,	278,	278,	611,	611, /* 0x97 */
+	611,	611,	611,	611,	611,	611,	611,	611, /* 0x9f */
+	556,	400,	556,	556,	556,	350,	556,	611, /* 0xa7 */
+	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
+	250,	584,	250,	250,	556,	611,	250,	250, /* 0xb7 */
+	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
+	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
+	556,	1000,	278,	722,	722,	778,	1000,	944, /* 0xcf */
+	556,	1000,	500,	500,	278,	278,	584,	250, /* 0xd7 */
+	556,	667,	167,	556,	250,	250,	611,	611, /* 0xdf */
+	556,	278,	278,	500,	1000,	722,	667,	722, /* 0xe7 */
+	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
+	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica-Oblique",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	96l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica Oblique",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Medium",				/* Weight */
+	(float) -12.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-170,				/* llx */
+	-225,				/* lly */
+	1116,				/* urx */
+	931,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	523,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	250,				/* numOfPairs */
+	pdf_pairs_Helvetica_Oblique,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica-Oblique */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
+	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
+	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
+	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
+	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
+	500,	500,	500,	334,	260,	334,	584,	250, /* 0x7f */
+	667,	667,	722,	667,	722,	778,	722,	556, /* 0x87 */
+	556,	556,	556,	556,	556,	500,	556,	556, /* 0x8f */
+	556,	556,	278,	278,	278,	278,	556,	556, /* 0x97 */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x9f */
+	556,	400,	556,	556,	556,	350,	537,	611, /* 0xa7 */
+	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
+	250,	584,	250,	250,	556,	556,	250,	250, /* 0xb7 */
+	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
+	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
+	556,	1000,	278,	667,	667,	778,	1000,	944, /* 0xcf */
+	556,	1000,	333,	333,	222,	222,	584,	250, /* 0xd7 */
+	500,	667,	167,	556,	250,	250,	500,	500, /* 0xdf */
+	556,	278,	222,	333,	1000,	667,	667,	667, /* 0xe7 */
+	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
+	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Helvetica",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	32l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Helvetica",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Helvetica",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-166,				/* llx */
+	-225,				/* lly */
+	1000,				/* urx */
+	931,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	718,				/* CapHeight */
+	523,				/* xHeight */
+	718,				/* Ascender */
+	-207,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	250,				/* numOfPairs */
+	pdf_pairs_Helvetica,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Helvetica */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	278,	355,	556,	556,	889,	667,	191, /* 0x27 */
+	333,	333,	389,	584,	278,	333,	278,	278, /* 0x2f */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x37 */
+	556,	556,	278,	278,	584,	584,	584,	556, /* 0x3f */
+	1015,	667,	667,	722,	722,	667,	611,	778, /* 0x47 */
+	722,	278,	500,	667,	556,	833,	722,	778, /* 0x4f */
+	667,	778,	722,	667,	611,	722,	667,	944, /* 0x57 */
+	667,	667,	611,	278,	278,	278,	469,	556, /* 0x5f */
+	333,	556,	556,	500,	556,	556,	278,	556, /* 0x67 */
+	556,	222,	222,	500,	222,	833,	556,	556, /* 0x6f */
+	556,	556,	333,	500,	278,	556,	500,	722, /* 0x77 */
+	500,	500,	500,	334,	260,	334,	584,	250, /* 0x7f */
+	667,	667,	722,	667,	722,	778,	722,	556, /* 0x87 */
+	556,	556,	556,	556,	556,	500,	556,	556, /* 0x8f */
+	556,	556,	278,	278,	278,	278,	556,	556, /* 0x97 */
+	556,	556,	556,	556,	556,	556,	556,	556, /* 0x9f */
+	556,	400,	556,	556,	556,	350,	537,	611, /* 0xa7 */
+	737,	737,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
+	250,	584,	250,	250,	556,	556,	250,	250, /* 0xb7 */
+	250,	250,	250,	370,	365,	250,	889,	611, /* 0xbf */
+	611,	333,	584,	250,	556,	250,	250,	556, /* 0xc7 */
+	556,	1000,	278,	667,	667,	778,	1000,	944, /* 0xcf */
+	556,	1000,	333,	333,	222,	222,	584,	250, /* 0xd7 */
+	500,	667,	167,	556,	250,	250,	500,	500, /* 0xdf */
+	556,	278,	222,	333,	1000,	667,	667,	667, /* 0xe7 */
+	667,	667,	278,	278,	278,	278,	778,	778, /* 0xef */
+	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Symbol",			/* FontName */
+	builtin,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	4l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Symbol",			/* Full name */
+	"FontSpecific",		/* Native encoding */
+	"Symbol",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-180,				/* llx */
+	-293,				/* lly */
+	1090,				/* urx */
+	1010,				/* ury */
+	-98,				/* UnderlinePosition */
+	54,				/* UnderlineThickness */
+	700,				/* CapHeight */
+	523,				/* xHeight */
+	800,				/* Ascender */
+	-200,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Symbol */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	713,	500,	549,	833,	778,	439, /* 0x27 */
+	333,	333,	500,	549,	250,	549,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	278,	278,	549,	549,	549,	444, /* 0x3f */
+	549,	722,	667,	722,	612,	611,	763,	603, /* 0x47 */
+	722,	333,	631,	722,	686,	889,	722,	722, /* 0x4f */
+	768,	741,	556,	592,	611,	690,	439,	768, /* 0x57 */
+	645,	795,	611,	333,	863,	333,	658,	500, /* 0x5f */
+	500,	631,	549,	549,	494,	439,	521,	411, /* 0x67 */
+	603,	329,	603,	549,	549,	576,	521,	549, /* 0x6f */
+	549,	521,	549,	603,	439,	576,	713,	686, /* 0x77 */
+	493,	686,	494,	480,	200,	480,	549,	250, /* 0x7f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
+	250,	620,	247,	549,	167,	713,	500,	753, /* 0xa7 */
+	753,	753,	753,	1042,	987,	603,	987,	603, /* 0xaf */
+	400,	549,	411,	549,	549,	713,	494,	460, /* 0xb7 */
+	549,	549,	549,	549,	1000,	603,	1000,	658, /* 0xbf */
+	823,	686,	795,	987,	768,	768,	823,	768, /* 0xc7 */
+	768,	713,	713,	713,	713,	713,	713,	713, /* 0xcf */
+	768,	713,	790,	790,	890,	823,	549,	250, /* 0xd7 */
+	713,	603,	603,	1042,	987,	603,	987,	603, /* 0xdf */
+	494,	329,	790,	790,	786,	713,	384,	384, /* 0xe7 */
+	384,	384,	384,	384,	494,	494,	494,	494, /* 0xef */
+	250,	329,	274,	686,	686,	686,	384,	384, /* 0xf7 */
+	384,	384,	384,	384,	494,	494,	494,	250  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-Bold",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262176l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Bold",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Bold",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-168,				/* llx */
+	-218,				/* lly */
+	1000,				/* urx */
+	935,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	676,				/* CapHeight */
+	461,				/* xHeight */
+	676,				/* Ascender */
+	-205,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_Bold,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-Bold */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	555,	500,	500,	1000,	833,	278, /* 0x27 */
+	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
+	930,	722,	667,	722,	722,	667,	611,	778, /* 0x47 */
+	778,	389,	500,	778,	667,	944,	722,	778, /* 0x4f */
+	611,	778,	722,	556,	667,	722,	722,	1000, /* 0x57 */
+	722,	722,	667,	333,	278,	333,	581,	500, /* 0x5f */
+	333,	500,	556,	444,	556,	444,	333,	500, /* 0x67 */
+	556,	278,	333,	556,	278,	833,	556,	500, /* 0x6f */
+	556,	556,	444,	389,	333,	556,	500,	722, /* 0x77 */
+	500,	500,	444,	394,	220,	394,	520,	250, /* 0x7f */
+	722,	722,	722,	667,	722,	778,	722,	500, /* 0x87 */
+	500,	500,	500,	500,	500,	444,	444,	444, /* 0x8f */
+	444,	444,	278,	278,	278,	278,	556,	500, /* 0x97 */
+	500,	500,	500,	500,	556,	556,	556,	556, /* 0x9f */
+	500,	400,	500,	500,	500,	350,	540,	556, /* 0xa7 */
+	747,	747,	1000,	333,	333,	250,	1000,	778, /* 0xaf */
+	250,	570,	250,	250,	500,	556,	250,	250, /* 0xb7 */
+	250,	250,	250,	300,	330,	250,	722,	500, /* 0xbf */
+	500,	333,	570,	250,	500,	250,	250,	500, /* 0xc7 */
+	500,	1000,	250,	722,	722,	778,	1000,	722, /* 0xcf */
+	500,	1000,	500,	500,	333,	333,	570,	250, /* 0xd7 */
+	500,	722,	167,	500,	250,	250,	556,	556, /* 0xdf */
+	500,	250,	333,	500,	1000,	722,	667,	722, /* 0xe7 */
+	667,	667,	389,	389,	389,	389,	778,	778, /* 0xef */
+	250,	778,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-BoldItalic",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	262240l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Bold Italic",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Bold",				/* Weight */
+	(float) -15.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-200,				/* llx */
+	-218,				/* lly */
+	996,				/* urx */
+	921,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	669,				/* CapHeight */
+	462,				/* xHeight */
+	699,				/* Ascender */
+	-205,				/* Descender */
+	130,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_BoldItalic,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-BoldItalic */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	389,	555,	500,	500,	833,	778,	278, /* 0x27 */
+	333,	333,	500,	570,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	333,	333,	570,	570,	570,	500, /* 0x3f */
+	832,	667,	667,	667,	722,	667,	667,	722, /* 0x47 */
+	778,	389,	500,	667,	611,	889,	722,	722, /* 0x4f */
+	611,	722,	667,	556,	611,	722,	667,	889, /* 0x57 */
+	667,	611,	611,	333,	278,	333,	570,	500, /* 0x5f */
+	333,	500,	500,	444,	500,	444,	333,	500, /* 0x67 */
+	556,	278,	278,	500,	278,	778,	556,	500, /* 0x6f */
+	500,	500,	389,	389,	278,	556,	444,	667, /* 0x77 */
+	500,	444,	389,	348,	220,	348,	570,	250, /* 0x7f */
+	667,	667,	667,	667,	722,	722,	722,	500, /* 0x87 */
+	500,	500,	500,	500,	500,	444,	444,	444, /* 0x8f */
+	444,	444,	278,	278,	278,	278,	556,	500, /* 0x97 */
+	500,	500,	500,	500,	556,	556,	556,	556, /* 0x9f */
+	500,	400,	500,	500,	500,	350,	500,	500, /* 0xa7 */
+	747,	747,	1000,	333,	333,	250,	944,	722, /* 0xaf */
+	250,	570,	250,	250,	500,	576,	250,	250, /* 0xb7 */
+	250,	250,	250,	266,	300,	250,	722,	500, /* 0xbf */
+	500,	389,	606,	250,	500,	250,	250,	500, /* 0xc7 */
+	500,	1000,	250,	667,	667,	722,	944,	722, /* 0xcf */
+	500,	1000,	500,	500,	333,	333,	570,	250, /* 0xd7 */
+	444,	611,	167,	500,	250,	250,	556,	556, /* 0xdf */
+	500,	250,	333,	500,	1000,	667,	667,	667, /* 0xe7 */
+	667,	667,	389,	389,	389,	389,	722,	722, /* 0xef */
+	250,	722,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-Italic",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	96l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Italic",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Medium",				/* Weight */
+	(float) -15.5,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-169,				/* llx */
+	-217,				/* lly */
+	1010,				/* urx */
+	883,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	653,				/* CapHeight */
+	441,				/* xHeight */
+	683,				/* Ascender */
+	-205,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_Italic,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-Italic */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	420,	500,	500,	833,	778,	214, /* 0x27 */
+	333,	333,	500,	675,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	333,	333,	675,	675,	675,	500, /* 0x3f */
+	920,	611,	611,	667,	722,	611,	611,	722, /* 0x47 */
+	722,	333,	444,	667,	556,	833,	667,	722, /* 0x4f */
+	611,	722,	611,	500,	556,	722,	611,	833, /* 0x57 */
+	611,	556,	556,	389,	278,	389,	422,	500, /* 0x5f */
+	333,	500,	500,	444,	500,	444,	278,	500, /* 0x67 */
+	500,	278,	278,	444,	278,	722,	500,	500, /* 0x6f */
+	500,	500,	389,	389,	278,	500,	444,	667, /* 0x77 */
+	444,	444,	389,	400,	275,	400,	541,	250, /* 0x7f */
+	611,	611,	667,	611,	667,	722,	722,	500, /* 0x87 */
+	500,	500,	500,	500,	500,	444,	444,	444, /* 0x8f */
+	444,	444,	278,	278,	278,	278,	500,	500, /* 0x97 */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x9f */
+	500,	400,	500,	500,	500,	350,	523,	500, /* 0xa7 */
+	760,	760,	980,	333,	333,	250,	889,	722, /* 0xaf */
+	250,	675,	250,	250,	500,	500,	250,	250, /* 0xb7 */
+	250,	250,	250,	276,	310,	250,	667,	500, /* 0xbf */
+	500,	389,	675,	250,	500,	250,	250,	500, /* 0xc7 */
+	500,	889,	250,	611,	611,	722,	944,	667, /* 0xcf */
+	500,	889,	556,	556,	333,	333,	675,	250, /* 0xd7 */
+	444,	556,	167,	500,	250,	250,	500,	500, /* 0xdf */
+	500,	250,	333,	556,	1000,	611,	611,	611, /* 0xe7 */
+	611,	611,	333,	333,	333,	333,	722,	722, /* 0xef */
+	250,	722,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"Times-Roman",			/* FontName */
+	macroman,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	32l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"Times Roman",			/* Full name */
+	"AdobeStandardEncoding",		/* Native encoding */
+	"Times",			/* Family name */
+	"Roman",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-168,				/* llx */
+	-218,				/* lly */
+	1000,				/* urx */
+	898,				/* ury */
+	-100,				/* UnderlinePosition */
+	50,				/* UnderlineThickness */
+	662,				/* CapHeight */
+	450,				/* xHeight */
+	683,				/* Ascender */
+	-217,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	283,				/* numOfPairs */
+	pdf_pairs_Times_Roman,	/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font Times-Roman */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	250,	333,	408,	500,	500,	833,	778,	180, /* 0x27 */
+	333,	333,	500,	564,	250,	333,	250,	278, /* 0x2f */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x37 */
+	500,	500,	278,	278,	564,	564,	564,	444, /* 0x3f */
+	921,	722,	667,	667,	722,	611,	556,	722, /* 0x47 */
+	722,	333,	389,	722,	611,	889,	722,	722, /* 0x4f */
+	556,	722,	667,	556,	611,	722,	722,	944, /* 0x57 */
+	722,	722,	611,	333,	278,	333,	469,	500, /* 0x5f */
+	333,	444,	500,	444,	500,	444,	333,	500, /* 0x67 */
+	500,	278,	278,	500,	278,	778,	500,	500, /* 0x6f */
+	500,	500,	333,	389,	278,	500,	500,	722, /* 0x77 */
+	500,	500,	444,	480,	200,	480,	541,	250, /* 0x7f */
+	722,	722,	667,	611,	722,	722,	722,	444, /* 0x87 */
+	444,	444,	444,	444,	444,	444,	444,	444, /* 0x8f */
+	444,	444,	278,	278,	278,	278,	500,	500, /* 0x97 */
+	500,	500,	500,	500,	500,	500,	500,	500, /* 0x9f */
+	500,	400,	500,	500,	500,	350,	453,	500, /* 0xa7 */
+	760,	760,	980,	333,	333,	250,	889,	722, /* 0xaf */
+	250,	564,	250,	250,	500,	500,	250,	250, /* 0xb7 */
+	250,	250,	250,	276,	310,	250,	667,	500, /* 0xbf */
+	444,	333,	564,	250,	500,	250,	250,	500, /* 0xc7 */
+	500,	1000,	250,	722,	722,	722,	889,	722, /* 0xcf */
+	500,	1000,	444,	444,	333,	333,	564,	250, /* 0xd7 */
+	500,	722,	167,	500,	250,	250,	556,	556, /* 0xdf */
+	500,	250,	333,	444,	1000,	722,	611,	722, /* 0xe7 */
+	611,	611,	333,	333,	333,	333,	722,	722, /* 0xef */
+	250,	722,	722,	722,	722,	278,	333,	333, /* 0xf7 */
+	333,	333,	333,	333,	333,	333,	333,	333  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+},
+
+/* ---------------------------------------------------------- */
+{	"ZapfDingbats",			/* FontName */
+	builtin,			/* Encoding */
+	0,				/* used on current page */
+	0,				/* embed flag */
+	(char *) NULL,			/* Name of external font file */
+	0L,				/* Object id */
+	4l,			/* Font flags */
+	pdf_false,			/* Read from AFM file */
+	"ITC Zapf Dingbats",			/* Full name */
+	"FontSpecific",		/* Native encoding */
+	"ITC Zapf Dingbats",			/* Family name */
+	"Medium",				/* Weight */
+	(float) 0.0,			/* ItalicAngle */
+	0,				/* isFixedPitch */
+	-1,				/* llx */
+	-143,				/* lly */
+	981,				/* urx */
+	820,				/* ury */
+	-98,				/* UnderlinePosition */
+	54,				/* UnderlineThickness */
+	700,				/* CapHeight */
+	450,				/* xHeight */
+	800,				/* Ascender */
+	-200,				/* Descender */
+	75,				/* StdVW */
+	0,				/* StdHW */
+
+	0,				/* numOfChars */
+	(CharMetricInfo *) NULL,	/* cmi */
+	0,				/* numOfTracks */
+	(TrackKernData *) NULL,		/* tkd */
+	0,				/* numOfPairs */
+	(PairKernData *) NULL,		/* pkd */
+	0,				/* numOfComps */
+	(CompCharData *) NULL,		/* ccd */
+
+/* Character metrics for font ZapfDingbats */
+{	250,	250,	250,	250,	250,	250,	250,	250, /* 0x07 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x0f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x17 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x1f */
+	278,	974,	961,	974,	980,	719,	789,	790, /* 0x27 */
+	791,	690,	960,	939,	549,	855,	911,	933, /* 0x2f */
+	911,	945,	974,	755,	846,	762,	761,	571, /* 0x37 */
+	677,	763,	760,	759,	754,	494,	552,	537, /* 0x3f */
+	577,	692,	786,	788,	788,	790,	793,	794, /* 0x47 */
+	816,	823,	789,	841,	823,	833,	816,	831, /* 0x4f */
+	923,	744,	723,	749,	790,	792,	695,	776, /* 0x57 */
+	768,	792,	759,	707,	708,	682,	701,	826, /* 0x5f */
+	815,	789,	789,	707,	687,	696,	689,	786, /* 0x67 */
+	787,	713,	791,	785,	791,	873,	761,	762, /* 0x6f */
+	762,	759,	759,	892,	892,	788,	784,	438, /* 0x77 */
+	138,	277,	415,	392,	392,	668,	668,	250, /* 0x7f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x87 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x8f */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x97 */
+	250,	250,	250,	250,	250,	250,	250,	250, /* 0x9f */
+	250,	732,	544,	544,	910,	667,	760,	760, /* 0xa7 */
+	776,	595,	694,	626,	788,	788,	788,	788, /* 0xaf */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xb7 */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xbf */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xc7 */
+	788,	788,	788,	788,	788,	788,	788,	788, /* 0xcf */
+	788,	788,	788,	788,	894,	838,	1016,	458, /* 0xd7 */
+	748,	924,	748,	918,	927,	928,	928,	834, /* 0xdf */
+	873,	828,	924,	924,	917,	930,	931,	463, /* 0xe7 */
+	883,	836,	836,	867,	867,	696,	696,	874, /* 0xef */
+	250,	874,	760,	946,	771,	865,	771,	888, /* 0xf7 */
+	967,	888,	831,	873,	927,	970,	918,	250  /* 0xff */
+},
+
+	-1,				/* hash_next */
+	(pdf_afm_cache *) NULL,		/* shared */
+	(int *) NULL,			/* glyph_hash */
+	0,				/* glyph_hashsize */
+	(pdf_kernpair *) NULL,		/* kerning */
+	0				/* kerning_size */
+}
+};
+
+#endif /* MAC */
+
+#define SIZEOF_CORE_METRICS	(sizeof(pdf_core_metrics)/sizeof(pdf_font))
+
+/* Hash index for pdf_core_metrics: slot numbers in the buckets given by
+ * pdf_hash_string(FontName) & (CORE_HASHSIZE - 1), using linear probing
+ * for collisions; -1 marks an empty bucket. Both metrics sets above
+ * contain the fonts in the same order, so the index is valid for both.
+ * CORE_HASHSIZE must be a power of 2.
+ */
+#define CORE_HASHSIZE		32
+
+static const int pdf_core_index[CORE_HASHSIZE] = {
+    -1,  4, -1, -1, -1,  0, -1, -1,
+    -1, -1, -1, -1,  1,  3,  9, -1,
+     5,  2,  7, -1, -1,  6, 12, 11,
+     8, 13, -1, -1, 10, -1, -1, -1
+};
+#endif /* P_METRICS_H */
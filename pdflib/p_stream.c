@@ -0,0 +1,465 @@
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_stream.c
+ *
+ * PDFlib output stream routines
+ *
+ */
+
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "p_intern.h"
+
+#ifdef HAVE_MMAP
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef HAVE_SENDFILE
+#include <sys/sendfile.h>
+#endif
+
+/* block size for copying image files without mmap() */
+#define COPY_BUFSIZE	65536
+
+/* All PDF output goes through the functions in this module. Depending on
+ * how the document was opened the data ends up in a disk file (PDF_open_file,
+ * PDF_open_fp), in a growable in-core buffer (PDF_open_mem without a write
+ * procedure), or is handed to a user-supplied write procedure (PDF_open_mem).
+ *
+ * Output is collected in p->outbuf and handed to the file or write procedure
+ * in large blocks. We keep track of the output position ourselves instead of
+ * asking ftell(), so the output file need not be seekable (pipes, sockets,
+ * stdout) and object offsets come for free.
+ */
+
+/* Hand the buffered data to the file or write procedure */
+void
+pdf_flush_stream(PDF *p)
+{
+    size_t len = p->outbuf_len;
+
+    if (len == 0)
+	return;
+
+    switch (p->sink) {
+	case pdf_sink_file:
+	    p->outbuf_len = 0;
+	    p->out_offset += (long) len;
+	    if (fwrite(p->outbuf, 1, len, p->fp) != len)
+		pdf_error(p, PDF_IOError, "Couldn't write output file");
+	    break;
+
+	case pdf_sink_proc:
+	    p->outbuf_len = 0;
+	    p->out_offset += (long) len;
+	    if (p->writeproc(p, p->outbuf, len) != len)
+		pdf_error(p, PDF_IOError, "Couldn't write output");
+	    break;
+
+	/* in-core data stays put until fetched with PDF_get_buffer() */
+	default:
+	    break;
+    }
+}
+
+/* Make room for size more bytes in the output buffer */
+static void
+pdf_grow_outbuf(PDF *p, size_t size)
+{
+    size_t newsize = p->outbuf_capacity + OUTBUF_CHUNKSIZE;
+
+    while (p->outbuf_len + size > newsize)
+	newsize += OUTBUF_CHUNKSIZE;
+
+    if (p->outbuf == NULL)
+	p->outbuf = (byte *) p->malloc(p, newsize, "pdf_grow_outbuf");
+    else
+	p->outbuf = (byte *) p->realloc(p, p->outbuf, newsize,
+			    "pdf_grow_outbuf");
+    p->outbuf_capacity = newsize;
+}
+
+#ifdef HAVE_LIBZ
+/* Page content streams are compressed on the fly. Content data is collected
+ * in zbuf and deflated in blocks directly into the output buffer.
+ */
+static void
+pdf_deflate(PDF *p, int flush)
+{
+    int status;
+
+    p->z.next_in = (Bytef *) p->zbuf;
+    p->z.avail_in = (uInt) p->zbuf_len;
+
+    for (;;) {
+	/* make room in the output buffer */
+	if (p->outbuf_len == p->outbuf_capacity) {
+	    if (p->sink != pdf_sink_mem && p->outbuf != NULL)
+		pdf_flush_stream(p);
+	    else
+		pdf_grow_outbuf(p, 1);
+	}
+
+	p->z.next_out = (Bytef *) (p->outbuf + p->outbuf_len);
+	p->z.avail_out = (uInt) (p->outbuf_capacity - p->outbuf_len);
+
+	status = deflate(&p->z, flush);
+	p->outbuf_len = p->outbuf_capacity - p->z.avail_out;
+
+	if (status == Z_STREAM_END)
+	    break;
+	if (status != Z_OK && status != Z_BUF_ERROR)
+	    pdf_error(p, PDF_SystemError, "Compression error!");
+	if (flush == Z_NO_FLUSH && p->z.avail_in == 0 && p->z.avail_out != 0)
+	    break;
+    }
+
+    p->zbuf_len = 0;
+}
+
+static void
+pdf_zbuf_write(PDF *p, const void *data, size_t size)
+{
+    const byte *cp = (const byte *) data;
+    size_t n;
+
+    while (size > 0) {
+	n = ZBUF_SIZE - p->zbuf_len;
+	if (n > size)
+	    n = size;
+
+	memcpy(p->zbuf + p->zbuf_len, cp, n);
+	p->zbuf_len += n;
+	cp += n;
+	size -= n;
+
+	if (p->zbuf_len == ZBUF_SIZE)
+	    pdf_deflate(p, Z_NO_FLUSH);
+    }
+}
+#endif	/* HAVE_LIBZ */
+
+/* Start compressing all output. Does nothing if compression is disabled. */
+void
+pdf_begin_compress(PDF *p)
+{
+#ifdef HAVE_LIBZ
+    if (p->compress == 0)
+	return;
+
+    if (!p->z_initialized) {
+	p->z.zalloc = (alloc_func) pdf_zlib_alloc;
+	p->z.zfree = (free_func) p->free;
+	p->z.opaque = (voidpf) p;
+
+	if (deflateInit(&p->z, p->compress) != Z_OK)
+	    pdf_error(p, PDF_SystemError, "Compression initialization error!");
+
+	p->zbuf = (byte *) p->malloc(p, ZBUF_SIZE, "pdf_begin_compress");
+	p->z_initialized = pdf_true;
+    } else {
+	/* re-use the deflate state of the previous stream */
+	if (deflateReset(&p->z) != Z_OK ||
+	    deflateParams(&p->z, p->compress, Z_DEFAULT_STRATEGY) != Z_OK)
+	    pdf_error(p, PDF_SystemError, "Compression initialization error!");
+    }
+
+    p->zbuf_len = 0;
+    p->compressing = pdf_true;
+#endif	/* HAVE_LIBZ */
+}
+
+/* Finish the compressed stream and write all pending compressed data */
+void
+pdf_end_compress(PDF *p)
+{
+#ifdef HAVE_LIBZ
+    if (!p->compressing)
+	return;
+
+    p->compressing = pdf_false;
+    pdf_deflate(p, Z_FINISH);
+#endif	/* HAVE_LIBZ */
+}
+
+void
+pdf_write(PDF *p, const void *data, size_t size)
+{
+#ifdef HAVE_LIBZ
+    if (p->compressing) {
+	pdf_zbuf_write(p, data, size);
+	return;
+    }
+#endif	/* HAVE_LIBZ */
+
+    if (p->outbuf_len + size > p->outbuf_capacity) {
+	if (p->sink == pdf_sink_none)
+	    pdf_error(p, PDF_SystemError, "No output sink for PDF data");
+
+	if (p->sink != pdf_sink_mem && p->outbuf != NULL) {
+	    pdf_flush_stream(p);
+
+	    /* large blocks (mostly image data) bypass the buffer */
+	    if (size >= p->outbuf_capacity) {
+		if (p->sink == pdf_sink_file) {
+		    if (fwrite(data, 1, size, p->fp) != size)
+			pdf_error(p, PDF_IOError, "Couldn't write output file");
+		} else if (p->writeproc(p, (void *) data, size) != size) {
+		    pdf_error(p, PDF_IOError, "Couldn't write output");
+		}
+		p->out_offset += (long) size;
+		return;
+	    }
+	} else {
+	    pdf_grow_outbuf(p, size);
+	}
+    }
+
+    memcpy(p->outbuf + p->outbuf_len, data, size);
+    p->outbuf_len += size;
+}
+
+#ifdef HAVE_SENDFILE
+/* Let the kernel copy size bytes of fp, starting at start, to the output
+ * file. Returns false if this doesn't work for the output file at all
+ * (e.g., it has been opened for appending), so the caller can fall back.
+ */
+static pdf_bool
+pdf_sendfile(PDF *p, FILE *fp, long start, long size)
+{
+    off_t	offset = (off_t) start;
+    long	done = 0;
+    ssize_t	n;
+
+    pdf_flush_stream(p);
+    if (fflush(p->fp) != 0)
+	pdf_error(p, PDF_IOError, "Couldn't write output file");
+
+    while (done < size) {
+	n = sendfile(fileno(p->fp), fileno(fp), &offset, (size_t) (size - done));
+	if (n < 0 && errno == EINTR)
+	    continue;
+	if (n <= 0) {
+	    if (done == 0)
+		return pdf_false;
+	    pdf_error(p, PDF_IOError, "Couldn't write output file");
+	}
+	done += (long) n;
+    }
+
+    p->out_offset += size;
+    return pdf_true;
+}
+#endif	/* HAVE_SENDFILE */
+
+/* Copy the image file fp from offset start to the end to the output.
+ * This is used for compressed image data which goes into the PDF
+ * unchanged. Instead of passing the data through a small read buffer and
+ * the output buffer we hand it over to the kernel with sendfile() if the
+ * output is a plain file, or map the file and write it with a single call.
+ * Input which can't be mapped (pipes, devices) is read in large blocks.
+ */
+void
+pdf_copy_file(PDF *p, FILE *fp, long start)
+{
+    byte	*buf;
+    size_t	n;
+#ifdef HAVE_MMAP
+    struct stat	st;
+    long	size, base;
+    void	*map;
+
+    if (fstat(fileno(fp), &st) == 0 && S_ISREG(st.st_mode)) {
+	if ((long) st.st_size <= start)
+	    return;
+	size = (long) st.st_size - start;
+
+#ifdef HAVE_SENDFILE
+	if (p->sink == pdf_sink_file && !p->compressing &&
+	    pdf_sendfile(p, fp, start, size))
+	    return;
+#endif
+
+	/* mmap() wants a page-aligned file offset */
+	base = start - start % sysconf(_SC_PAGESIZE);
+	map = mmap(NULL, (size_t) (st.st_size - base), PROT_READ, MAP_SHARED,
+			fileno(fp), (off_t) base);
+
+	if (map != MAP_FAILED) {
+	    pdf_write(p, (byte *) map + (start - base), (size_t) size);
+	    munmap(map, (size_t) (st.st_size - base));
+	    return;
+	}
+    }
+#endif	/* HAVE_MMAP */
+
+    if (fseek(fp, start, SEEK_SET) != 0)
+	pdf_error(p, PDF_IOError, "Couldn't read image file");
+
+    buf = (byte *) p->malloc(p, COPY_BUFSIZE, "pdf_copy_file");
+    while ((n = fread(buf, 1, COPY_BUFSIZE, fp)) > 0)
+	pdf_write(p, buf, n);
+    p->free(p, buf);
+}
+
+void
+pdf_puts(PDF *p, const char *s)
+{
+    pdf_write(p, s, strlen(s));
+}
+
+void
+pdf_putc(PDF *p, int c)
+{
+    char ch = (char) c;
+
+    if (p->outbuf_len < p->outbuf_capacity && !p->compressing)
+	p->outbuf[p->outbuf_len++] = (byte) c;
+    else
+	pdf_write(p, &ch, 1);
+}
+
+/* A minimal printf() for PDF output. Besides being faster than the C
+ * library version, this avoids any dependency on the current locale.
+ * Supported conversions:
+ *
+ *	%s	string
+ *	%c	character
+ *	%d %ld	integers, with optional field width and '0' flag
+ *	%f	float or double, formatted with pdf_ftoa()
+ *	%%	literal percent sign
+ */
+void
+pdf_printf(PDF *p, const char *fmt, ...)
+{
+    char	buf[FLOATBUFSIZE + 16], *cp, *end = buf + sizeof(buf);
+    const char	*start;
+    int		width, zeropad, islong;
+    long	l;
+    unsigned long ul;
+    va_list	ap;
+
+    va_start(ap, fmt);
+
+    while (*fmt) {
+	/* copy literal text up to the next conversion */
+	for (start = fmt; *fmt && *fmt != '%'; fmt++)
+	    ;
+	if (fmt != start)
+	    pdf_write(p, start, (size_t) (fmt - start));
+	if (*fmt == '\0')
+	    break;
+
+	fmt++;				/* skip '%' */
+	zeropad = (*fmt == '0');
+	for (width = 0; *fmt >= '0' && *fmt <= '9'; fmt++)
+	    width = 10 * width + *fmt - '0';
+	islong = (*fmt == 'l');
+	if (islong)
+	    fmt++;
+
+	switch (*fmt) {
+	    case 's':
+		pdf_puts(p, va_arg(ap, const char *));
+		break;
+
+	    case 'c':
+		pdf_putc(p, va_arg(ap, int));
+		break;
+
+	    case 'f':
+		pdf_write(p, buf, (size_t) pdf_ftoa(buf, va_arg(ap, double)));
+		break;
+
+	    case 'd':
+		l = islong ? va_arg(ap, long) : (long) va_arg(ap, int);
+		ul = (l < 0) ? (unsigned long) -l : (unsigned long) l;
+
+		cp = end;
+		do {
+		    *--cp = (char) ('0' + ul % 10);
+		    ul /= 10;
+		} while (ul != 0);
+
+		if (zeropad)
+		    while (end - cp < width - (l < 0) && cp > buf + 1)
+			*--cp = '0';
+		if (l < 0)
+		    *--cp = '-';
+		while (end - cp < width && cp > buf)
+		    *--cp = ' ';
+
+		pdf_write(p, cp, (size_t) (end - cp));
+		break;
+
+	    case '%':
+		pdf_putc(p, '%');
+		break;
+
+	    default:
+		va_end(ap);
+		pdf_error(p, PDF_SystemError,
+		    "Unsupported format '%%%c' in pdf_printf", *fmt);
+		return;
+	}
+
+	fmt++;
+    }
+
+    va_end(ap);
+}
+
+/* Current output position, used for object offsets and stream lengths */
+long
+pdf_tell(PDF *p)
+{
+    return p->out_offset + (long) p->outbuf_len;
+}
+
+void
+pdf_cleanup_stream(PDF *p)
+{
+    if (p->outbuf)
+	p->free(p, p->outbuf);
+
+    p->outbuf		= NULL;
+    p->outbuf_len	= 0;
+    p->outbuf_capacity	= 0;
+
+#ifdef HAVE_LIBZ
+    if (p->z_initialized) {
+	(void) deflateEnd(&p->z);
+	p->free(p, p->zbuf);
+    }
+
+    p->z_initialized	= pdf_false;
+    p->zbuf		= NULL;
+    p->zbuf_len		= 0;
+#endif
+    p->compressing	= pdf_false;
+}
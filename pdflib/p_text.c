@@ -1,222 +1,747 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* p_text.c
- *
- * PDFlib text routines
- *
- */
-
-#include <stdio.h>
-#include <string.h>
-
-#include "p_intern.h"
-#include "p_afmparse.h"
-
-/* Auxiliary routines */
-
-void
-pdf_begin_text(PDF *p)
-{
-    if (p->contents == c_text)
-	return;
-
-    p->procset	|= Text;
-    p->contents	= c_text;
-
-    (void) fputs( "BT\n", p->fp);
-}
-
-void
-pdf_end_text(PDF *p)
-{
-    if (p->contents != c_text)
-	return;
-
-    p->contents	= c_stream;
-
-    (void) fputs("ET\n", p->fp);
-}
-
-void
-pdf_quote_string(PDF *p, const char *text)
-{
-    const unsigned char *goal, *s;
-    size_t len;
-
-    len = pdf_strlen(text)-1;	/* subtract a null byte... */
-
-    if (pdf_is_unicode(text))	/* ...and possibly another one */
-	len--;
-
-    fputc('(', p->fp);
-    goal = (const unsigned char *) text + len;
-
-    for (s = (const unsigned char *) text; s < goal; s++) {
-		/* expand tabs */
-		if (*s == '\t') {
-			fputs("    ", p->fp);
-		} else {
-		    if (*s == '(' || *s == ')' || *s == '\\')
-			fputc('\\', p->fp);
-		    fputc(*s, p->fp);
-		}
-    }
-    fputc(')', p->fp);
-}
-
-/* Text state operators */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_leading(PDF *p, float l)
-{
-    char buf[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp, "%s TL\n", pdf_float(buf, l));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_text_rendering(PDF *p, int mode)
-{
-#define LAST_MODE	7
-	if (mode > LAST_MODE) {
-		pdf_error(p, PDF_NonfatalError,
-			"Bogus text rendering mode %d", mode);
-		return;
-	}
-		
-    pdf_begin_text(p);
-    (void) fprintf(p->fp, "%d Tr\n", mode);
-#undef LAST_MODE
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_text_rise(PDF *p, float rise)
-{
-    char buf[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp, "%s Ts\n", pdf_float(buf, rise));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_horiz_scaling(PDF *p, float scale)
-{
-    char buf[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp, "%s Tz\n", pdf_float(buf, scale));
-}
-
-/* Text positioning operators */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_text_matrix(PDF *p, float a, float b, float c, float d, float e, float f)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-    char buf3[FLOATBUFSIZE], buf4[FLOATBUFSIZE];
-    char buf5[FLOATBUFSIZE], buf6[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp,"%s %s %s %s %s %s Tm\n",
-		  pdf_float(buf1, a), pdf_float(buf2, b), pdf_float(buf3, c),
-		  pdf_float(buf4, d), pdf_float(buf5, e), pdf_float(buf6, f));
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_set_text_pos(PDF *p, float x, float y)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp,"1 0 0 1 %s %s Tm\n",
-    	pdf_float(buf1, x), pdf_float(buf2, y));
-}
-
-/* Text string operators */
-
-PDFLIB_API void PDFLIB_CALL
-PDF_show(PDF *p, const char *text)
-{
-    pdf_begin_text(p);
-    pdf_quote_string(p, text);
-    (void) fputs("Tj\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_continue_text(PDF *p, const char *text)
-{
-    pdf_begin_text(p);
-    pdf_quote_string(p, text);
-    (void) fputs("'\n", p->fp);
-}
-
-PDFLIB_API void PDFLIB_CALL
-PDF_show_xy(PDF *p, const char *text, float x, float y)
-{
-    char buf1[FLOATBUFSIZE], buf2[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-
-    (void) fprintf(p->fp,"1 0 0 1 %s %s Tm\n",
-    	pdf_float(buf1, x), pdf_float(buf2, y));
-    pdf_quote_string(p, text);
-    (void) fputs("Tj\n", p->fp);
-}
-
-/* character spacing for justified lines */
-PDFLIB_API void PDFLIB_CALL
-PDF_set_char_spacing(PDF *p, float spacing)
-{
-    char buf[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp,"%s Tc\n", pdf_float(buf, spacing));
-}
-
-/* word spacing for justified lines */
-PDFLIB_API void PDFLIB_CALL
-PDF_set_word_spacing(PDF *p, float spacing)
-{
-    char buf[FLOATBUFSIZE];
-
-    pdf_begin_text(p);
-    (void) fprintf(p->fp,"%s Tw\n", pdf_float(buf, spacing));
-}
-
-PDFLIB_API float PDFLIB_CALL
-PDF_stringwidth(PDF *p, const char *text, int font, float size)
-{
-    const char *cp;
-    float width = (float) 0.0;
-
-    /* Check parameters */
-    if (font < 0 || font >= p->fonts_number)
-	pdf_error(p, PDF_ValueError, "Bad font descriptor %d", font);
-	
-    if (size < 0)
-	pdf_error(p, PDF_ValueError, "Bad font size %f", size);
-
-    for (cp = text; *cp; cp++)
-	width += size * p->fonts[font].widths[(unsigned char) *cp]/1000;
-
-    return width;
-}
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_text.c
+ *
+ * PDFlib text routines
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "p_intern.h"
+#include "p_afmparse.h"
+
+/* Auxiliary routines */
+
+void
+pdf_begin_text(PDF *p)
+{
+    if (p->contents == c_text)
+	return;
+
+    p->procset	|= Text;
+    p->contents	= c_text;
+
+    /* BT resets the text matrix to the identity */
+    p->tm_known	= pdf_true;
+    p->tm_x	= 0;
+    p->tm_y	= 0;
+
+    pdf_puts(p,  "BT\n");
+}
+
+void
+pdf_end_text(PDF *p)
+{
+    if (p->contents != c_text)
+	return;
+
+    p->contents	= c_stream;
+
+    pdf_puts(p, "ET\n");
+}
+
+/* Characters which need special treatment in PDF strings are found a
+ * machine word at a time: PDF_HASBYTE(v, c) is nonzero if any byte of the
+ * word v equals c. ( and ) only differ in the lowest bit, so both are
+ * found by setting that bit in all bytes and looking for ).
+ */
+#define PDF_ONES		(~0UL / 255)
+#define PDF_HASZERO(v)		(((v) - PDF_ONES) & ~(v) & (PDF_ONES << 7))
+#define PDF_HASBYTE(v, c)	PDF_HASZERO((v) ^ (PDF_ONES * (c)))
+
+/* Return the first character in s up to goal which is a parenthesis,
+ * backslash, or equal to c, or goal if there is none
+ */
+static const unsigned char *
+pdf_find_special(const unsigned char *s, const unsigned char *goal, int c)
+{
+    unsigned long v;
+
+    while ((size_t) (goal - s) >= sizeof(unsigned long)) {
+	memcpy(&v, s, sizeof(unsigned long));
+	if (PDF_HASBYTE(v | PDF_ONES, ')') || PDF_HASBYTE(v, '\\') ||
+	    PDF_HASBYTE(v, c))
+	    break;
+	s += sizeof(unsigned long);
+    }
+
+    for (/* */ ; s < goal; s++)
+	if (*s == '(' || *s == ')' || *s == '\\' || *s == c)
+	    break;
+
+    return s;
+}
+
+/* Write the characters from s up to goal, quoted for a PDF string. Runs
+ * of characters which don't need quoting are copied as a block. Tabs are
+ * expanded in 8-bit text; Unicode text is copied unchanged except for
+ * carriage returns, which a PDF reader would convert to newlines.
+ */
+static void
+pdf_quote_block(PDF *p, const unsigned char *s, const unsigned char *goal,
+	pdf_bool unicode)
+{
+    const unsigned char *t;
+    char esc[2];
+
+    esc[0] = '\\';
+
+    for (/* */ ; s < goal; s = t + 1) {
+	t = pdf_find_special(s, goal, unicode ? '\r' : '\t');
+	if (t > s)
+	    pdf_write(p, s, (size_t) (t - s));
+	if (t == goal)
+	    break;
+
+	if (*t == '\t') {
+	    pdf_puts(p, "    ");		/* expand tabs */
+	} else {
+	    esc[1] = (char) (*t == '\r' ? 'r' : *t);
+	    pdf_write(p, esc, 2);
+	}
+    }
+}
+
+/* Write the characters from s up to goal, quoted for a PDF string */
+static void
+pdf_quote_chars(PDF *p, const unsigned char *s, const unsigned char *goal)
+{
+    pdf_quote_block(p, s, goal, pdf_false);
+}
+
+void
+pdf_quote_string(PDF *p, const char *text)
+{
+    size_t len;
+
+    len = pdf_strlen(text)-1;	/* subtract a null byte... */
+
+    if (pdf_is_unicode(text))	/* ...and possibly another one */
+	len--;
+
+    pdf_putc(p, '(');
+    pdf_quote_block(p, (const unsigned char *) text,
+		(const unsigned char *) text + len, pdf_is_unicode(text));
+    pdf_putc(p, ')');
+}
+
+/* Pair kerning */
+
+/* Return the font if text is to be kerned with it, or NULL. The kerning
+ * table of the font is built when it is needed for the first time.
+ * Unicode strings are never kerned; the caller must check this.
+ */
+static pdf_font *
+pdf_kerning_font(PDF *p, int font)
+{
+    pdf_font *f;
+
+    if (!p->kerning || font < 0 || font >= p->fonts_number)
+	return NULL;
+
+    f = &p->fonts[font];
+
+    if (f->kerning_size == 0)
+	pdf_make_kerning(p, f);
+
+    return f->kerning ? f : NULL;
+}
+
+/* Kerning amount for two adjacent characters, see pdf_make_kerning() */
+static int
+pdf_get_kerning(const pdf_font *font, int c1, int c2)
+{
+    unsigned int key = (unsigned int) (c1 << 8 | c2);
+    unsigned int mask = (unsigned int) font->kerning_size - 1;
+    unsigned int h;
+
+    for (h = PDF_KERN_HASH(key) & mask; font->kerning[h].amount != 0;
+	    h = (h + 1) & mask)
+	if (font->kerning[h].key == key)
+	    return font->kerning[h].amount;
+
+    return 0;
+}
+
+/* Show len characters of text with TJ, moving kerned characters by the
+ * kerning amount
+ */
+static void
+pdf_show_kerned(PDF *p, const pdf_font *font, const unsigned char *text,
+	size_t len)
+{
+    const unsigned char *s, *start, *end;
+    int kern;
+
+    start = text;
+    end = text + len;
+
+    pdf_putc(p, '[');
+    for (s = start; s < end; s++) {
+	if (s == text || (kern = pdf_get_kerning(font, s[-1], s[0])) == 0)
+	    continue;
+
+	pdf_putc(p, '(');
+	pdf_quote_chars(p, start, s);
+	pdf_printf(p, ")%d", -kern);
+	start = s;
+    }
+    pdf_putc(p, '(');
+    pdf_quote_chars(p, start, s);
+    pdf_puts(p, ")]TJ\n");
+}
+
+/* Show len characters of text, kerned with font unless it is NULL */
+static void
+pdf_show_chars(PDF *p, const pdf_font *kern, const unsigned char *text,
+	size_t len)
+{
+    if (kern != NULL) {
+	pdf_show_kerned(p, kern, text, len);
+    } else {
+	pdf_putc(p, '(');
+	pdf_quote_chars(p, text, text + len);
+	pdf_puts(p, ")Tj\n");
+    }
+}
+
+/* Show len characters of text at the start of the next line */
+static void
+pdf_next_line_chars(PDF *p, const pdf_font *kern, const unsigned char *text,
+	size_t len)
+{
+    /* ' can't take an array, so kerned text needs T* and TJ */
+    if (kern != NULL) {
+	pdf_puts(p, "T*\n");
+	pdf_show_kerned(p, kern, text, len);
+    } else {
+	pdf_putc(p, '(');
+	pdf_quote_chars(p, text, text + len);
+	pdf_puts(p, ")'\n");
+    }
+
+    /* ' moves the line matrix down by the leading */
+    p->tm_y -= pdf_fround(pdf_gs(p)->leading);
+}
+
+/* Show text in the current font, with kerning if requested */
+static void
+pdf_show_text(PDF *p, const char *text)
+{
+    pdf_font *font;
+
+    if (!pdf_is_unicode(text) &&
+	(font = pdf_kerning_font(p, p->current_font)) != NULL) {
+	pdf_show_kerned(p, font, (const unsigned char *) text, strlen(text));
+    } else {
+	pdf_quote_string(p, text);
+	pdf_puts(p, "Tj\n");
+    }
+}
+
+/* Text state operators */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_leading(PDF *p, float l)
+{
+    if (p->track_state && pdf_gs(p)->leading == l)
+	return;
+    pdf_gs(p)->leading = l;
+
+    pdf_begin_text(p);
+    pdf_printf(p, "%f TL\n", l);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_text_rendering(PDF *p, int mode)
+{
+#define LAST_MODE	7
+	if (mode > LAST_MODE) {
+		pdf_error(p, PDF_NonfatalError,
+			"Bogus text rendering mode %d", mode);
+		return;
+	}
+		
+    if (p->track_state && pdf_gs(p)->textrendering == mode)
+	return;
+    pdf_gs(p)->textrendering = mode;
+
+    pdf_begin_text(p);
+    pdf_printf(p, "%d Tr\n", mode);
+#undef LAST_MODE
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_text_rise(PDF *p, float rise)
+{
+    if (p->track_state && pdf_gs(p)->textrise == rise)
+	return;
+    pdf_gs(p)->textrise = rise;
+
+    pdf_begin_text(p);
+    pdf_printf(p, "%f Ts\n", rise);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_horiz_scaling(PDF *p, float scale)
+{
+    if (p->track_state && pdf_gs(p)->horizscaling == scale)
+	return;
+    pdf_gs(p)->horizscaling = scale;
+
+    pdf_begin_text(p);
+    pdf_printf(p, "%f Tz\n", scale);
+}
+
+/* Text positioning operators */
+
+/* Move to the start of a new line at (x, y). If relative is true we use
+ * the shorter Td operator relative to the current text line matrix if
+ * it is a plain translation. Td is needed even for a zero offset, since
+ * it resets the text matrix which the last string has advanced. The
+ * offset is computed from the position which the viewer will actually
+ * see, so rounding errors don't add up.
+ */
+static void
+pdf_move_text(PDF *p, float x, float y, pdf_bool relative)
+{
+    double dx, dy;
+
+    pdf_begin_text(p);
+
+    if (relative && p->tm_known) {
+	dx = pdf_fround(x - p->tm_x);
+	dy = pdf_fround(y - p->tm_y);
+	pdf_printf(p, "%f %f Td\n", dx, dy);
+	p->tm_x += dx;
+	p->tm_y += dy;
+    } else {
+	pdf_printf(p, "1 0 0 1 %f %f Tm\n", x, y);
+	p->tm_known = pdf_true;
+	p->tm_x = pdf_fround(x);
+	p->tm_y = pdf_fround(y);
+    }
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_text_matrix(PDF *p, float a, float b, float c, float d, float e, float f)
+{
+    pdf_begin_text(p);
+    pdf_printf(p, "%f %f %f %f %f %f Tm\n", a, b, c, d, e, f);
+
+    p->tm_known = (a == 1 && b == 0 && c == 0 && d == 1);
+    p->tm_x = pdf_fround(e);
+    p->tm_y = pdf_fround(f);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_set_text_pos(PDF *p, float x, float y)
+{
+    pdf_move_text(p, x, y, p->track_state);
+}
+
+/* Text string operators */
+
+PDFLIB_API void PDFLIB_CALL
+PDF_show(PDF *p, const char *text)
+{
+    pdf_begin_text(p);
+    pdf_show_text(p, text);
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_continue_text(PDF *p, const char *text)
+{
+    pdf_begin_text(p);
+
+    if (pdf_is_unicode(text)) {
+	pdf_quote_string(p, text);
+	pdf_puts(p, "'\n");
+	p->tm_y -= pdf_fround(pdf_gs(p)->leading);
+    } else {
+	pdf_next_line_chars(p, pdf_kerning_font(p, p->current_font),
+	    (const unsigned char *) text, strlen(text));
+    }
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_show_xy(PDF *p, const char *text, float x, float y)
+{
+    pdf_move_text(p, x, y, p->track_state);
+    pdf_show_text(p, text);
+}
+
+/* Show n strings at the positions (x[i], y[i]) in one text block, which
+ * is much more compact than PDF_show_xy() for each of them since the
+ * strings are placed with Td relative to each other. If fonts is not
+ * NULL string i is shown in font fonts[i] at the current font size.
+ */
+PDFLIB_API void PDFLIB_CALL
+PDF_show_many(PDF *p, const char **texts, const float *x, const float *y,
+	const int *fonts, int n)
+{
+    int i;
+
+    if (n < 0 || (n > 0 && (texts == NULL || x == NULL || y == NULL)))
+	pdf_error(p, PDF_ValueError, "Bad arrays for PDF_show_many");
+
+    if (fonts != NULL && p->current_font < 0)
+	pdf_error(p, PDF_RuntimeError, "No font size set for PDF_show_many");
+
+    for (i = 0; i < n; i++) {
+	if (texts[i] == NULL)
+	    pdf_error(p, PDF_ValueError, "Null text for PDF_show_many %d", i);
+
+	if (fonts != NULL && (pdf_gs(p)->font != fonts[i] ||
+	    pdf_gs(p)->fontsize != p->fontsize))
+	    pdf_setfont(p, fonts[i], p->fontsize);
+
+	pdf_move_text(p, x[i], y[i], pdf_true);
+	pdf_show_text(p, texts[i]);
+    }
+}
+
+/* character spacing for justified lines */
+PDFLIB_API void PDFLIB_CALL
+PDF_set_char_spacing(PDF *p, float spacing)
+{
+    if (p->track_state && pdf_gs(p)->charspacing == spacing)
+	return;
+    pdf_gs(p)->charspacing = spacing;
+
+    pdf_begin_text(p);
+    pdf_printf(p, "%f Tc\n", spacing);
+}
+
+/* word spacing for justified lines */
+PDFLIB_API void PDFLIB_CALL
+PDF_set_word_spacing(PDF *p, float spacing)
+{
+    if (p->track_state && pdf_gs(p)->wordspacing == spacing)
+	return;
+    pdf_gs(p)->wordspacing = spacing;
+
+    pdf_begin_text(p);
+    pdf_printf(p, "%f Tw\n", spacing);
+}
+
+/* Width of len characters of text in 1/1000 text space units, including
+ * the kerning amounts if kern is not NULL. The widths are summed up in a
+ * separate loop without any dependencies, which compilers can unroll or
+ * vectorize.
+ */
+static long
+pdf_text_width(const int *widths, const pdf_font *kern,
+	const unsigned char *text, size_t len)
+{
+    long width = 0;
+    size_t i;
+
+    for (i = 0; i < len; i++)
+	width += widths[text[i]];
+
+    if (kern != NULL)
+	for (i = 1; i < len; i++)
+	    width += pdf_get_kerning(kern, text[i - 1], text[i]);
+
+    return width;
+}
+
+/* Check the parameters of the string width functions, and return the
+ * font for kerning or NULL
+ */
+static pdf_font *
+pdf_check_width_params(PDF *p, int font, float size)
+{
+    if (font < 0 || font >= p->fonts_number)
+	pdf_error(p, PDF_ValueError, "Bad font descriptor %d", font);
+	
+    if (size < 0)
+	pdf_error(p, PDF_ValueError, "Bad font size %f", size);
+
+    return pdf_kerning_font(p, font);
+}
+
+PDFLIB_API float PDFLIB_CALL
+PDF_stringwidth(PDF *p, const char *text, int font, float size)
+{
+    pdf_font *kern;
+
+    kern = pdf_check_width_params(p, font, size);
+
+    if (pdf_is_unicode(text))
+	kern = NULL;
+
+    return size * pdf_text_width(p->fonts[font].widths, kern,
+		(const unsigned char *) text, strlen(text)) / 1000;
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_stringwidths(PDF *p, int font, float size, const char **texts, int n,
+	float *widths)
+{
+    pdf_font *kern;
+    int i;
+
+    kern = pdf_check_width_params(p, font, size);
+
+    if (n < 0 || (n > 0 && (texts == NULL || widths == NULL)))
+	pdf_error(p, PDF_ValueError, "Bad string array for string widths");
+
+    for (i = 0; i < n; i++) {
+	if (texts[i] == NULL)
+	    pdf_error(p, PDF_ValueError, "Null text for string width %d", i);
+
+	widths[i] = size * pdf_text_width(p->fonts[font].widths,
+			pdf_is_unicode(texts[i]) ? NULL : kern,
+			(const unsigned char *) texts[i], strlen(texts[i])) / 1000;
+    }
+}
+
+PDFLIB_API void PDFLIB_CALL
+PDF_stringwidths2(PDF *p, int font, float size, const char *buffer,
+	const int *offsets, const int *lengths, int n, float *widths)
+{
+    const unsigned char *text;
+    pdf_font *kern;
+    int i;
+
+    kern = pdf_check_width_params(p, font, size);
+
+    if (n < 0 || (n > 0 && (buffer == NULL || offsets == NULL ||
+	lengths == NULL || widths == NULL)))
+	pdf_error(p, PDF_ValueError, "Bad string array for string widths");
+
+    for (i = 0; i < n; i++) {
+	if (offsets[i] < 0 || lengths[i] < 0)
+	    pdf_error(p, PDF_ValueError,
+		"Bad offset or length for string width %d", i);
+
+	text = (const unsigned char *) buffer + offsets[i];
+	widths[i] = size * pdf_text_width(p->fonts[font].widths,
+			lengths[i] >= 2 && pdf_is_unicode(text) ? NULL : kern,
+			text, (size_t) lengths[i]) / 1000;
+    }
+}
+
+/* Text boxes */
+
+typedef enum {
+    box_left, box_right, box_center, box_justify, box_fulljustify
+} pdf_box_mode;
+
+/* Layout state of a text line: width in 1/1000 text space units without
+ * character and word spacing, number of characters and spaces, and the
+ * end of the line
+ */
+typedef struct {
+    long		units;
+    int			chars;
+    int			spaces;
+    const unsigned char	*end;
+} pdf_box_line;
+
+/* Find the longest line starting at s which fits into width, and return
+ * the start of the next line. Lines are broken at spaces; a word which
+ * doesn't fit on a line of its own is broken between characters. Spaces
+ * at the end of the line are not part of it.
+ */
+static const unsigned char *
+pdf_break_line(const int *widths, const pdf_font *kern, float scale,
+	float cs, float ws, float width, const unsigned char *s,
+	const unsigned char *end, pdf_box_line *line)
+{
+    pdf_box_line cur, brk;
+    const unsigned char *t;
+    long cu;
+
+    cur.units = 0;
+    cur.chars = cur.spaces = 0;
+    cur.end = s;
+    *line = cur;
+    brk.end = NULL;
+
+    for (t = s; t < end && *t != '\n'; t++) {
+	cu = widths[*t];
+	if (kern != NULL && t > s)
+	    cu += pdf_get_kerning(kern, t[-1], t[0]);
+
+	if (*t == ' ') {
+	    if (t > s && t[-1] != ' ')
+		brk = *line;		/* end of the previous word */
+	    cur.units += cu;
+	    cur.chars++;
+	    cur.spaces++;
+	    continue;
+	}
+
+	if (t > s && (cur.units + cu) * scale + (cur.chars + 1) * cs +
+		cur.spaces * ws > width) {
+	    if (brk.end != NULL) {	/* break after the previous word */
+		*line = brk;
+		for (t = brk.end; t < end && *t == ' '; t++)
+		    /* */ ;
+		return t;
+	    }
+	    *line = cur;		/* break within the word */
+	    line->end = t;
+	    return t;
+	}
+
+	cur.units += cu;
+	cur.chars++;
+	cur.end = t + 1;
+	*line = cur;
+    }
+
+    return t < end ? t + 1 : t;		/* skip the newline */
+}
+
+PDFLIB_API int PDFLIB_CALL
+PDF_show_boxed(PDF *p, const char *text, float x, float y, float width,
+	float height, const char *hmode, const char *feature)
+{
+    const unsigned char *s, *end, *next;
+    const int *widths;
+    pdf_box_mode mode = box_left;
+    pdf_box_line line;
+    pdf_font *kern;
+    pdf_bool blind = pdf_false, paragraph_end;
+    float scale, hs, cs, ws, lw, xl, baseline;
+
+    if (text == NULL || hmode == NULL)
+	pdf_error(p, PDF_ValueError, "Null argument for PDF_show_boxed");
+
+    if (p->current_font < 0)
+	pdf_error(p, PDF_RuntimeError, "No font set for PDF_show_boxed");
+
+    if (pdf_is_unicode(text))
+	pdf_error(p, PDF_ValueError,
+	    "Unicode text not supported in PDF_show_boxed");
+
+    if (width < 0 || height < 0)
+	pdf_error(p, PDF_ValueError, "Bad text box size %f x %f",
+	    width, height);
+
+    if (!strcmp(hmode, "left"))
+	mode = box_left;
+    else if (!strcmp(hmode, "right"))
+	mode = box_right;
+    else if (!strcmp(hmode, "center"))
+	mode = box_center;
+    else if (!strcmp(hmode, "justify"))
+	mode = box_justify;
+    else if (!strcmp(hmode, "fulljustify"))
+	mode = box_fulljustify;
+    else
+	pdf_error(p, PDF_ValueError, "Unknown alignment '%s'", hmode);
+
+    if (feature == NULL || *feature == '\0')
+	blind = pdf_false;
+    else if (!strcmp(feature, "blind"))
+	blind = pdf_true;
+    else
+	pdf_error(p, PDF_ValueError, "Unknown text box feature '%s'", feature);
+
+    s = (const unsigned char *) text;
+    end = s + strlen(text);
+
+    widths = p->fonts[p->current_font].widths;
+    kern = pdf_kerning_font(p, p->current_font);
+
+    /* character and word spacing are unscaled text space units, all
+     * widths get horizontal scaling applied
+     */
+    hs = pdf_gs(p)->horizscaling / 100;
+    scale = p->fontsize / 1000 * hs;
+    cs = pdf_gs(p)->charspacing * hs;
+    ws = pdf_gs(p)->wordspacing;
+
+    /* a single line aligned at (x, y) */
+    if (width == 0 && height == 0) {
+	if (mode == box_justify || mode == box_fulljustify)
+	    pdf_error(p, PDF_ValueError,
+		"Can't justify text without a text box");
+
+	line.units = pdf_text_width(widths, kern, s, (size_t) (end - s));
+	line.chars = (int) (end - s);
+	for (line.spaces = 0, next = s; next < end; next++)
+	    if (*next == ' ')
+		line.spaces++;
+	lw = line.units * scale + line.chars * cs + line.spaces * ws * hs;
+
+	if (!blind) {
+	    xl = mode == box_right ? x - lw :
+		 mode == box_center ? x - lw / 2 : x;
+	    pdf_move_text(p, xl, y, p->track_state);
+	    pdf_show_chars(p, kern, s, (size_t) (end - s));
+	}
+	return 0;
+    }
+
+    /* the first baseline is one font size below the top of the box */
+    for (baseline = y + height - p->fontsize;
+	    s < end && baseline >= y; baseline -= pdf_gs(p)->leading) {
+	next = pdf_break_line(widths, kern, scale, cs, ws * hs, width,
+		    s, end, &line);
+	paragraph_end = (next == end || next[-1] == '\n');
+
+	if (!blind && line.chars > 0) {
+	    lw = line.units * scale + line.chars * cs + line.spaces * ws * hs;
+	    xl = x;
+
+	    if (mode == box_right) {
+		xl = x + width - lw;
+	    } else if (mode == box_center) {
+		xl = x + (width - lw) / 2;
+	    } else if (mode == box_justify || mode == box_fulljustify) {
+		if (line.spaces > 0 &&
+		    (!paragraph_end || mode == box_fulljustify))
+		    PDF_set_word_spacing(p,
+			ws + (width - lw) / (line.spaces * hs));
+		else
+		    PDF_set_word_spacing(p, ws);
+	    }
+
+	    /* a line right below the previous one doesn't need Td */
+	    pdf_begin_text(p);
+	    if (p->track_state && p->tm_known &&
+		pdf_fround(xl - p->tm_x) == 0 &&
+		pdf_fround(baseline - p->tm_y) ==
+		    -pdf_fround(pdf_gs(p)->leading)) {
+		pdf_next_line_chars(p, kern, s, (size_t) (line.end - s));
+	    } else {
+		pdf_move_text(p, xl, baseline, p->track_state);
+		pdf_show_chars(p, kern, s, (size_t) (line.end - s));
+	    }
+	}
+
+	s = next;
+    }
+
+    if (!blind && (mode == box_justify || mode == box_fulljustify))
+	PDF_set_word_spacing(p, ws);
+
+    /* the number of characters which didn't fit into the box */
+    return (int) (end - s);
+}
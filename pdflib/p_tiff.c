@@ -1,197 +1,730 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* p_tiff.c
- *
- * TIFF processing for PDFlib
- *
- */
-
-#include "p_intern.h"
-
-#ifdef HAVE_LIBTIFF
-
-#include <tiffio.h>
-
-static void
-pdf_data_source_TIFF_init(PDF *p, PDF_data_source *src)
-{
-  pdf_image	*image;
-
-  image = (pdf_image *) src->private_data;
-  image->image_info.tiff.cur_line = 0;
-
-  src->buffer_length = image->components * image->width;
-  src->buffer_start = (byte *)
-  	p->malloc(p, src->buffer_length, "PDF_data_source_TIFF_init");
-}
-
-static int
-pdf_data_source_TIFF_fill(PDF *p, PDF_data_source *src)
-{
-  pdf_image	*image;
-  int		col;
-  byte		*dest;
-  uint32	*s;
-
-  image = (pdf_image *) src->private_data;
-
-  if (image->image_info.tiff.cur_line++ == image->height)
-    return pdf_false;
-
-  src->next_byte = src->buffer_start;
-  src->bytes_available = src->buffer_length;
-
-  dest = src->buffer_start;
-  s = image->image_info.tiff.raster + 
-  	(image->height - image->image_info.tiff.cur_line) * image->width;
-  
-  switch (image->components) {
-      case 1:
-		  for (col = 0; col < image->width; col++, s++) {
-			*dest++ = (byte) TIFFGetR(*s);
-		  }
-		  break;
-
-      case 3:
-		  for (col = 0; col < image->width; col++, s++) {
-			*dest++ = (byte) TIFFGetR(*s);
-			*dest++ = (byte) TIFFGetG(*s);
-			*dest++ = (byte) TIFFGetB(*s);
-		  }
-		  break;
-
-      default:
-		pdf_error(p, PDF_IOError,
-			"Unknown color space in TIFF image %s (%d components)", 
-			image->filename, image->components);
-  }
-
-  return pdf_true;
-}
-
-static void
-pdf_data_source_TIFF_terminate(PDF *p, PDF_data_source *src)
-{
-  p->free(p, (void *) src->buffer_start);
-}
-
-PDFLIB_API int PDFLIB_CALL
-PDF_open_TIFF(PDF *p, const char *filename)
-{
-    pdf_image *image;
-    int32 w, h;
-    uint16 bpc;
-    tsample_t components;
-    size_t npixels;
-    uint16	*rmap, *gmap, *bmap;
-    int im;
-
-    for (im = 0; im < p->images_capacity; im++)
-	if (p->images[im].in_use == 0)		/* found free slot */
-	    break;
-
-    if (im == p->images_capacity) 
-	pdf_grow_images(p);
-
-    image = &p->images[im];
-
-    /* Suppress all warnings and error messages */
-    (void) TIFFSetErrorHandler(NULL);
-    (void) TIFFSetWarningHandler(NULL);
-
-    image->image_info.tiff.tif = TIFFOpen(filename, READMODE);
-
-    if (!image->image_info.tiff.tif)
-	return -1;
-
-    TIFFGetField(image->image_info.tiff.tif, TIFFTAG_IMAGEWIDTH, &w);
-    TIFFGetField(image->image_info.tiff.tif, TIFFTAG_IMAGELENGTH, &h);
-    TIFFGetFieldDefaulted(image->image_info.tiff.tif, TIFFTAG_BITSPERSAMPLE, &bpc);
-    TIFFGetFieldDefaulted(image->image_info.tiff.tif, TIFFTAG_SAMPLESPERPIXEL, &components);
-
-    image->width		= w;
-    image->height		= h;
-    /* we use 8 bit to retrieve the image data in all cases */
-    image->bpc			= 8;
-    image->components		= components;
-    image->compression		= none;
-    image->BitPixel		= 1 << image->bpc;
-    image->indexed		= pdf_false;
-    image->reference		= pdf_ref_direct;
-
-    switch (image->components) {
-	case 1:
-		if (TIFFGetField(image->image_info.tiff.tif, TIFFTAG_COLORMAP, &rmap, &gmap, &bmap)) {
-			/* if it is a palette image we have to adapt these accordingly */
-			image->colorspace	= DeviceRGB;
-			image->components	= 3;
-		} else
-			/* plain old grayscale image */
-			image->colorspace	= DeviceGray;
-	    break;
-	case 3:
-	    image->colorspace	= DeviceRGB;
-	    break;
-	case 4:
-	    image->colorspace	= DeviceCMYK;
-	    break;
-	default:
-	    TIFFClose(image->image_info.tiff.tif);
-	    return -1;
-    }
-
-    image->src.init		= pdf_data_source_TIFF_init;
-    image->src.fill		= pdf_data_source_TIFF_fill;
-    image->src.terminate	= pdf_data_source_TIFF_terminate;
-    image->src.private_data	= (void *) image;
-
-    npixels = w * h;
-    image->image_info.tiff.raster =
-    	(uint32*) _TIFFmalloc((tsize_t) (npixels * sizeof (uint32)));
-
-    if (image->image_info.tiff.raster == NULL ||
-	!TIFFReadRGBAImage(image->image_info.tiff.tif,
-		(uint32) w, (uint32) h, image->image_info.tiff.raster, 1)) {
-	TIFFClose(image->image_info.tiff.tif);
-	return -1;
-    }
-
-    image->in_use = 1;			/* mark slot as used */
-    image->filename		= pdf_strdup(p, filename);
-
-    pdf_put_image(p, im);
-
-    _TIFFfree(image->image_info.tiff.raster);
-    TIFFClose(image->image_info.tiff.tif);
-
-    return im;
-}
-
-#else	/* not HAVE_LIBTIFF */
-
-/* Define dummies if we can't use TIFFlib */
-PDFLIB_API int PDFLIB_CALL
-PDF_open_TIFF(PDF *p, const char *filename)
-{
-    return -1;
-}
-
-#endif	/* HAVE_LIBTIFF */
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_tiff.c
+ *
+ * TIFF processing for PDFlib
+ *
+ */
+
+#include <string.h>
+
+#include "p_intern.h"
+
+#ifdef HAVE_LIBTIFF
+
+#include <tiffio.h>
+
+/* TIFF images are read one band of lines at a time: some scanlines of a
+ * strip, or one row of tiles. Gray, RGB, CMYK and palette images with 1, 2,
+ * 4 or 8 bits per sample and interleaved samples go into the PDF as they
+ * are, libtiff only decompresses them. Bilevel images thus stay at 1 bit
+ * per pixel, and palette images become /Indexed. All other images are
+ * converted to RGB or gray with libtiff's RGBA routines, one strip or tile
+ * at a time. Either way we never hold more than a strip or a row of tiles
+ * in memory.
+ *
+ * Images stored in a single strip with CCITT, LZW, Flate or JPEG
+ * compression aren't decompressed at all: the strip goes into the PDF
+ * with the matching filter and decode parameters. Several strips can't
+ * be joined into one stream, since each of them is coded on its own.
+ */
+
+#define TIFF_BANDSIZE	65536	/* bytes of scanlines read at once */
+
+/* Pages of multi-page TIFF files are opened through the directory offsets
+ * of all pages seen so far. The last file used stays open while it has
+ * pages which haven't been read, so reading page n reads at most the
+ * directories between the last known page and page n, and an N page file
+ * costs N directory reads altogether instead of a scan from the start for
+ * every page.
+ */
+struct pdf_tiff_file_s {
+    char	*filename;
+    time_t	mtime;		/* modification time of the file */
+    TIFF	*tif;		/* NULL after the last page has been read */
+    int		current;	/* page tif is positioned on, or 0 */
+    toff_t	*offsets;	/* directory offsets of pages 1 to count */
+    int		count;
+    int		capacity;	/* currently allocated size */
+    pdf_bool	complete;	/* no pages after the known ones */
+};
+
+#define TIFF_PAGES_CHUNKSIZE	16
+
+void
+pdf_cleanup_tiff(PDF *p)
+{
+    pdf_tiff_file *tf = p->tiff_file;
+
+    if (tf == NULL)
+	return;
+
+    if (tf->tif)
+	TIFFClose(tf->tif);
+    p->free(p, tf->offsets);
+    p->free(p, tf->filename);
+    p->free(p, tf);
+    p->tiff_file = NULL;
+}
+
+/* Position the TIFF file on a page, counting from 1. Returns NULL if the
+ * file or the page doesn't exist.
+ */
+static TIFF *
+pdf_TIFF_page(PDF *p, const char *filename, int page)
+{
+    pdf_tiff_file *tf = p->tiff_file;
+    time_t mtime = pdf_file_mtime(filename);
+
+    /* forget the offsets of a different or modified file */
+    if (tf != NULL && (strcmp(tf->filename, filename) || tf->mtime != mtime)) {
+	pdf_cleanup_tiff(p);
+	tf = NULL;
+    }
+
+    if (tf == NULL) {
+	tf = (pdf_tiff_file *)
+		p->malloc(p, sizeof(pdf_tiff_file), "pdf_TIFF_page");
+	tf->filename	= pdf_strdup(p, filename);
+	tf->mtime	= mtime;
+	tf->tif		= NULL;
+	tf->current	= 0;
+	tf->count	= 0;
+	tf->capacity	= TIFF_PAGES_CHUNKSIZE;
+	tf->complete	= pdf_false;
+	tf->offsets	= (toff_t *) p->malloc(p,
+			    sizeof(toff_t) * tf->capacity, "pdf_TIFF_page");
+	p->tiff_file = tf;
+    }
+
+    if (page < 1 || (tf->complete && page > tf->count))
+	return NULL;
+
+    if (tf->tif == NULL) {
+	if ((tf->tif = TIFFOpen(filename, READMODE)) == NULL) {
+	    pdf_cleanup_tiff(p);
+	    return NULL;
+	}
+	tf->current = 1;
+	if (tf->count == 0)
+	    tf->offsets[tf->count++] = TIFFCurrentDirOffset(tf->tif);
+    }
+
+    /* a page we already know about */
+    if (page <= tf->count) {
+	if (tf->current != page) {
+	    tf->current = 0;
+	    if (!TIFFSetSubDirectory(tf->tif, tf->offsets[page - 1]))
+		return NULL;
+	    tf->current = page;
+	}
+	return tf->tif;
+    }
+
+    /* read the directories following the last known page */
+    if (tf->current != tf->count) {
+	tf->current = 0;
+	if (!TIFFSetSubDirectory(tf->tif, tf->offsets[tf->count - 1]))
+	    return NULL;
+	tf->current = tf->count;
+    }
+
+    while (tf->count < page) {
+	if (!TIFFReadDirectory(tf->tif)) {
+	    tf->complete = pdf_true;
+	    tf->current = 0;
+	    return NULL;
+	}
+
+	if (tf->count == tf->capacity) {
+	    tf->capacity *= 2;
+	    tf->offsets = (toff_t *) p->realloc(p, tf->offsets,
+			    sizeof(toff_t) * tf->capacity, "pdf_TIFF_page");
+	}
+	tf->offsets[tf->count++] = TIFFCurrentDirOffset(tf->tif);
+	tf->current = tf->count;
+    }
+
+    return tf->tif;
+}
+
+/* Convert n RGBA pixels to gray or RGB samples */
+static void
+pdf_TIFF_rgba_line(byte *dest, uint32 *s, int n, int components)
+{
+    if (components == 1) {
+	for (; n > 0; n--, s++)
+	    *dest++ = (byte) TIFFGetR(*s);
+    } else {
+	for (; n > 0; n--, s++) {
+	    *dest++ = (byte) TIFFGetR(*s);
+	    *dest++ = (byte) TIFFGetG(*s);
+	    *dest++ = (byte) TIFFGetB(*s);
+	}
+    }
+}
+
+/* Read rows image lines starting at cur_line into dest */
+static int
+pdf_read_TIFF_band(pdf_image *image, byte *dest, int rows)
+{
+    PDF_tiff_info *tiff = &image->image_info.tiff;
+    TIFF	*tif = tiff->tif;
+    int		bits = image->bpc * image->components;
+    int		x, y, n;
+    size_t	tile_row;
+
+    /* images organized in strips */
+    if (tiff->tile_width == 0) {
+	if (tiff->rgba) {
+	    /* the RGBA strip is upside down */
+	    if (!TIFFReadRGBAStrip(tif, (uint32) tiff->cur_line, tiff->raster))
+		return pdf_false;
+	    for (y = 0; y < rows; y++)
+		pdf_TIFF_rgba_line(dest + y * tiff->line_size,
+		    tiff->raster + (rows - 1 - y) * image->width,
+		    image->width, image->components);
+	} else {
+	    for (y = 0; y < rows; y++)
+		if (TIFFReadScanline(tif, dest + y * tiff->line_size,
+			(uint32) (tiff->cur_line + y), 0) == -1)
+		    return pdf_false;
+	}
+	return pdf_true;
+    }
+
+    /* tiled images: assemble a row of tiles */
+    tile_row = (size_t) TIFFTileRowSize(tif);
+
+    for (x = 0; x < image->width; x += tiff->tile_width) {
+	n = image->width - x;
+	if (n > tiff->tile_width)
+	    n = tiff->tile_width;
+
+	if (tiff->rgba) {
+	    /* the RGBA tile is upside down, and always full size */
+	    if (!TIFFReadRGBATile(tif, (uint32) x, (uint32) tiff->cur_line,
+		    tiff->raster))
+		return pdf_false;
+	    for (y = 0; y < rows; y++)
+		pdf_TIFF_rgba_line(dest + y * tiff->line_size +
+			x * image->components,
+		    tiff->raster + (tiff->tile_height - 1 - y) * tiff->tile_width,
+		    n, image->components);
+	} else {
+	    if (TIFFReadTile(tif, tiff->tile, (uint32) x,
+		    (uint32) tiff->cur_line, 0, 0) == -1)
+		return pdf_false;
+	    for (y = 0; y < rows; y++)
+		memcpy(dest + y * tiff->line_size + x * bits / 8,
+		    tiff->tile + y * tile_row, (size_t) (n * bits + 7) / 8);
+	}
+    }
+
+    return pdf_true;
+}
+
+static void
+pdf_data_source_TIFF_init(PDF *p, PDF_data_source *src)
+{
+  pdf_image	*image;
+  PDF_tiff_info	*tiff;
+
+  image = (pdf_image *) src->private_data;
+  tiff = &image->image_info.tiff;
+  tiff->cur_line = 0;
+
+  src->buffer_length = tiff->line_size * tiff->band_height;
+  src->buffer_start = (byte *)
+  	p->malloc(p, src->buffer_length, "PDF_data_source_TIFF_init");
+
+  if (tiff->rgba)
+    tiff->raster = (uint32 *) p->malloc(p, sizeof(uint32) * (tiff->tile_width ?
+	(size_t) tiff->tile_width * tiff->tile_height :
+	(size_t) image->width * tiff->band_height), "PDF_data_source_TIFF_init");
+  else if (tiff->tile_width)
+    tiff->tile = (byte *) p->malloc(p, (size_t) TIFFTileSize(tiff->tif),
+	"PDF_data_source_TIFF_init");
+}
+
+static int
+pdf_data_source_TIFF_fill(PDF *p, PDF_data_source *src)
+{
+  pdf_image	*image;
+  PDF_tiff_info	*tiff;
+  byte		*cp;
+  int		rows;
+
+  image = (pdf_image *) src->private_data;
+  tiff = &image->image_info.tiff;
+
+  if (tiff->cur_line >= image->height)
+    return pdf_false;
+
+  rows = image->height - tiff->cur_line;
+  if (rows > tiff->band_height)
+    rows = tiff->band_height;
+
+  if (!pdf_read_TIFF_band(image, src->buffer_start, rows))
+    pdf_error(p, PDF_IOError, "Couldn't read TIFF image %s", image->filename);
+
+  src->next_byte = src->buffer_start;
+  src->bytes_available = tiff->line_size * rows;
+  tiff->cur_line += rows;
+
+  if (tiff->invert)
+    for (cp = src->buffer_start; cp < src->buffer_start +
+	  src->bytes_available; cp++)
+      *cp = (byte) ~*cp;
+
+  return pdf_true;
+}
+
+static void
+pdf_data_source_TIFF_terminate(PDF *p, PDF_data_source *src)
+{
+  pdf_image	*image;
+
+  image = (pdf_image *) src->private_data;
+
+  p->free(p, (void *) src->buffer_start);
+  if (image->image_info.tiff.raster)
+    p->free(p, (void *) image->image_info.tiff.raster);
+  if (image->image_info.tiff.tile)
+    p->free(p, (void *) image->image_info.tiff.tile);
+
+  image->image_info.tiff.raster = NULL;
+  image->image_info.tiff.tile = NULL;
+}
+
+/* Hand out the compressed strip in one piece */
+static void
+pdf_data_source_TIFF_raw_init(PDF *p, PDF_data_source *src)
+{
+  src->next_byte = NULL;
+}
+
+static int
+pdf_data_source_TIFF_raw_fill(PDF *p, PDF_data_source *src)
+{
+  pdf_image	*image;
+
+  if (src->next_byte != NULL)
+    return pdf_false;
+
+  image = (pdf_image *) src->private_data;
+  src->next_byte = image->image_info.tiff.raw;
+  src->bytes_available = image->image_info.tiff.raw_size;
+
+  return pdf_true;
+}
+
+static void
+pdf_data_source_TIFF_raw_terminate(PDF *p, PDF_data_source *src)
+{
+}
+
+/* Check whether PDF can take the samples as they are, and set up the
+ * color space for them
+ */
+static int
+pdf_TIFF_direct(pdf_image *image, pdf_colormap colormap)
+{
+    TIFF	*tif = image->image_info.tiff.tif;
+    uint16	bpc, spp, photometric, planar, orientation, format, inkset;
+    uint16	*rmap, *gmap, *bmap;
+    int		i, n, shift;
+
+    TIFFGetFieldDefaulted(tif, TIFFTAG_BITSPERSAMPLE, &bpc);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &spp);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_PLANARCONFIG, &planar);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_ORIENTATION, &orientation);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLEFORMAT, &format);
+
+    if (!TIFFGetField(tif, TIFFTAG_PHOTOMETRIC, &photometric) ||
+	(bpc != 1 && bpc != 2 && bpc != 4 && bpc != 8) ||
+	(planar != PLANARCONFIG_CONTIG && spp != 1) ||
+	orientation != ORIENTATION_TOPLEFT || format != SAMPLEFORMAT_UINT)
+	return pdf_false;
+
+    image->bpc		= bpc;
+    image->components	= spp;
+
+    switch (photometric) {
+	case PHOTOMETRIC_MINISWHITE:
+	    image->image_info.tiff.invert = pdf_true;
+	    /* fallthrough */
+
+	case PHOTOMETRIC_MINISBLACK:
+	    image->colorspace = DeviceGray;
+	    return spp == 1;
+
+	case PHOTOMETRIC_RGB:
+	    image->colorspace = DeviceRGB;
+	    return spp == 3;
+
+	case PHOTOMETRIC_SEPARATED:
+	    TIFFGetFieldDefaulted(tif, TIFFTAG_INKSET, &inkset);
+	    image->colorspace = DeviceCMYK;
+	    return spp == 4 && inkset == INKSET_CMYK;
+
+	case PHOTOMETRIC_PALETTE:
+	    if (spp != 1 ||
+		!TIFFGetField(tif, TIFFTAG_COLORMAP, &rmap, &gmap, &bmap))
+		return pdf_false;
+
+	    /* some writers store 8 bit colormaps */
+	    n = 1 << bpc;
+	    for (shift = 0, i = 0; i < n; i++)
+		if (rmap[i] > 255 || gmap[i] > 255 || bmap[i] > 255)
+		    shift = 8;
+
+	    for (i = 0; i < n; i++) {
+		colormap[i][0] = (byte) (rmap[i] >> shift);
+		colormap[i][1] = (byte) (gmap[i] >> shift);
+		colormap[i][2] = (byte) (bmap[i] >> shift);
+	    }
+
+	    image->colorspace	= DeviceRGB;
+	    image->indexed	= pdf_true;
+	    return pdf_true;
+
+	default:
+	    return pdf_false;
+    }
+}
+
+/* Check whether the image is a single strip which a PDF filter can
+ * decompress, and if so read the compressed data and set up the filter
+ * and its decode parameters. pdf_TIFF_direct() must have been called.
+ * The image is left alone unless the data could be read.
+ */
+static int
+pdf_TIFF_raw(PDF *p, pdf_image *image)
+{
+    PDF_tiff_info *tiff = &image->image_info.tiff;
+    TIFF	*tif = tiff->tif;
+    uint16	compression, fillorder, predictor, photometric, spp;
+    uint16	planar, orientation;
+    uint32	options, count;
+    byte	*tables, *data;
+    tsize_t	size;
+    char	params[128];
+    pdf_compression filter;
+    pdf_colorspace colorspace = image->colorspace;
+
+    if (TIFFIsTiled(tif) || TIFFNumberOfStrips(tif) != 1)
+	return pdf_false;
+
+    TIFFGetFieldDefaulted(tif, TIFFTAG_COMPRESSION, &compression);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_FILLORDER, &fillorder);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_SAMPLESPERPIXEL, &spp);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_PLANARCONFIG, &planar);
+    TIFFGetFieldDefaulted(tif, TIFFTAG_ORIENTATION, &orientation);
+
+    if (fillorder != FILLORDER_MSB2LSB ||
+	!TIFFGetField(tif, TIFFTAG_PHOTOMETRIC, &photometric))
+	return pdf_false;
+
+    params[0] = '\0';
+    options = 0;	/* the options tags have no default */
+
+    switch (compression) {
+	case COMPRESSION_CCITTFAX3:
+	case COMPRESSION_CCITTFAX4:
+	    if (tiff->rgba || image->bpc != 1 || image->indexed)
+		return pdf_false;
+
+	    if (compression == COMPRESSION_CCITTFAX3) {
+		TIFFGetField(tif, TIFFTAG_GROUP3OPTIONS, &options);
+		if (options & (GROUP3OPT_UNCOMPRESSED | GROUP3OPT_FILLBITS))
+		    return pdf_false;
+		if (options & GROUP3OPT_2DENCODING)
+		    strcat(params, "/K 1 ");
+	    } else {
+		TIFFGetField(tif, TIFFTAG_GROUP4OPTIONS, &options);
+		if (options & GROUP4OPT_UNCOMPRESSED)
+		    return pdf_false;
+		strcat(params, "/K -1 ");
+	    }
+
+	    /* the CCITT filter does the min-is-white inversion itself */
+	    if (!tiff->invert)
+		strcat(params, "/BlackIs1 true ");
+	    filter = ccitt;
+	    break;
+
+	case COMPRESSION_LZW:
+	case COMPRESSION_ADOBE_DEFLATE:
+	case COMPRESSION_DEFLATE:
+	    if (tiff->rgba || tiff->invert)
+		return pdf_false;
+
+	    TIFFGetFieldDefaulted(tif, TIFFTAG_PREDICTOR, &predictor);
+	    if (predictor == 2 && image->bpc == 8)
+		sprintf(params, "/Predictor 2 /Colors %d /Columns %d ",
+		    image->components, image->width);
+	    else if (predictor != 1)
+		return pdf_false;
+
+	    if (compression == COMPRESSION_LZW) {
+		strcat(params, "/EarlyChange 1 ");
+		filter = lzw;
+	    } else
+		filter = flate;
+	    break;
+
+	case COMPRESSION_JPEG:
+	    if ((spp != 1 && planar != PLANARCONFIG_CONTIG) ||
+		orientation != ORIENTATION_TOPLEFT)
+		return pdf_false;
+
+	    if (photometric == PHOTOMETRIC_MINISBLACK && spp == 1) {
+		colorspace = DeviceGray;
+	    } else if (photometric == PHOTOMETRIC_YCBCR && spp == 3) {
+		colorspace = DeviceRGB;
+	    } else if (photometric == PHOTOMETRIC_RGB && spp == 3) {
+		/* no YCbCr conversion in the JPEG data */
+		strcat(params, "/ColorTransform 0 ");
+		colorspace = DeviceRGB;
+	    } else
+		return pdf_false;
+
+	    filter = dct;
+	    break;
+
+	default:
+	    return pdf_false;
+    }
+
+    size = TIFFRawStripSize(tif, 0);
+    if (size <= 0)
+	return pdf_false;
+
+    data = (byte *) p->malloc(p, (size_t) size, "pdf_TIFF_raw");
+    if (TIFFReadRawStrip(tif, 0, data, size) != size ||
+	/* we can't handle old-style LZW codes */
+	(compression == COMPRESSION_LZW && data[0] != 0x80)) {
+	p->free(p, data);
+	return pdf_false;
+    }
+
+    /* the JPEG data brings its own color conversion and bit depth */
+    if (filter == dct) {
+	image->colorspace	= colorspace;
+	image->bpc		= 8;
+	image->components	= spp;
+	image->indexed		= pdf_false;
+	tiff->rgba		= pdf_false;
+    }
+    image->compression = filter;
+
+    /* Tables shared by all strips form the first part of the JPEG stream:
+     * join them and the strip, dropping the EOI and SOI markers in between.
+     */
+    if (compression == COMPRESSION_JPEG &&
+	TIFFGetField(tif, TIFFTAG_JPEGTABLES, &count, &tables) &&
+	count > 4 && size > 2 && data[0] == 0xFF && data[1] == 0xD8) {
+	tiff->raw = (byte *) p->malloc(p, (size_t) (count - 2 + size - 2),
+			"pdf_TIFF_raw");
+	memcpy(tiff->raw, tables, (size_t) (count - 2));
+	memcpy(tiff->raw + count - 2, data + 2, (size_t) (size - 2));
+	tiff->raw_size = (size_t) (count - 2 + size - 2);
+	p->free(p, data);
+    } else {
+	tiff->raw = data;
+	tiff->raw_size = (size_t) size;
+    }
+
+    if (params[0] != '\0')
+	image->params = pdf_strdup(p, params);
+
+    return pdf_true;
+}
+
+/* Set up reading the image in bands of decompressed lines */
+static int
+pdf_TIFF_bands(pdf_image *image)
+{
+    PDF_tiff_info *tiff = &image->image_info.tiff;
+    uint32 tw, th, rowsperstrip;
+    uint16 spp, photometric;
+    char emsg[1024];
+
+    if (tiff->rgba) {
+	/* we use 8 bit gray or RGB for everything else */
+	if (!TIFFRGBAImageOK(tiff->tif, emsg))
+	    return pdf_false;
+
+	TIFFGetFieldDefaulted(tiff->tif, TIFFTAG_SAMPLESPERPIXEL, &spp);
+	TIFFGetFieldDefaulted(tiff->tif, TIFFTAG_PHOTOMETRIC, &photometric);
+
+	image->bpc		= 8;
+	image->indexed		= pdf_false;
+	tiff->invert		= pdf_false;
+
+	if (spp == 1 && photometric != PHOTOMETRIC_PALETTE) {
+	    image->components	= 1;
+	    image->colorspace	= DeviceGray;
+	} else {
+	    image->components	= 3;
+	    image->colorspace	= DeviceRGB;
+	}
+    }
+
+    if (TIFFIsTiled(tiff->tif)) {
+	TIFFGetField(tiff->tif, TIFFTAG_TILEWIDTH, &tw);
+	TIFFGetField(tiff->tif, TIFFTAG_TILELENGTH, &th);
+	tiff->tile_width	= (int) tw;
+	tiff->tile_height	= (int) th;
+	tiff->band_height	= (int) th;
+    } else {
+	tiff->tile_width	= 0;
+	tiff->tile_height	= 0;
+
+	/* RGBA conversion works on whole strips */
+	TIFFGetFieldDefaulted(tiff->tif, TIFFTAG_ROWSPERSTRIP, &rowsperstrip);
+	tiff->band_height = (int) (rowsperstrip < (uint32) image->height ?
+				rowsperstrip : (uint32) image->height);
+    }
+
+    if (tiff->rgba) {
+	tiff->line_size = (size_t) image->width * image->components;
+    } else {
+	tiff->line_size = (size_t) TIFFScanlineSize(tiff->tif);
+
+	/* scanlines can be read in smaller bands than a strip */
+	if (tiff->tile_width == 0) {
+	    tiff->band_height = (int) (TIFF_BANDSIZE / tiff->line_size);
+	    if (tiff->band_height < 1)
+		tiff->band_height = 1;
+	    if (tiff->band_height > image->height)
+		tiff->band_height = image->height;
+	}
+    }
+
+    image->src.init		= pdf_data_source_TIFF_init;
+    image->src.fill		= pdf_data_source_TIFF_fill;
+    image->src.terminate	= pdf_data_source_TIFF_terminate;
+
+    return pdf_true;
+}
+
+PDFLIB_API int PDFLIB_CALL
+PDF_open_TIFF(PDF *p, const char *filename)
+{
+    return PDF_open_TIFF_page(p, filename, 1);
+}
+
+PDFLIB_API int PDFLIB_CALL
+PDF_open_TIFF_page(PDF *p, const char *filename, int page)
+{
+    pdf_image *image;
+    PDF_tiff_info *tiff;
+    pdf_colormap colormap;
+    uint32 w, h;
+    int im;
+
+    im = pdf_get_image_slot(p);
+    image = &p->images[im];
+    tiff = &image->image_info.tiff;
+
+    /* Suppress all warnings and error messages */
+    (void) TIFFSetErrorHandler(NULL);
+    (void) TIFFSetWarningHandler(NULL);
+
+    tiff->tif = pdf_TIFF_page(p, filename, page);
+
+    if (!tiff->tif)
+	return -1;
+
+    TIFFGetField(tiff->tif, TIFFTAG_IMAGEWIDTH, &w);
+    TIFFGetField(tiff->tif, TIFFTAG_IMAGELENGTH, &h);
+
+    image->width		= (int) w;
+    image->height		= (int) h;
+    image->compression		= none;
+    image->indexed		= pdf_false;
+    image->reference		= pdf_ref_direct;
+    image->colormap		= &colormap;
+
+    tiff->raster		= NULL;
+    tiff->tile			= NULL;
+    tiff->raw			= NULL;
+    tiff->invert		= pdf_false;
+    tiff->rgba			= !pdf_TIFF_direct(image, colormap);
+
+    if (image->width <= 0 || image->height <= 0)
+	return -1;
+
+    if (pdf_TIFF_raw(p, image)) {
+	image->src.init		= pdf_data_source_TIFF_raw_init;
+	image->src.fill		= pdf_data_source_TIFF_raw_fill;
+	image->src.terminate	= pdf_data_source_TIFF_raw_terminate;
+    } else if (!pdf_TIFF_bands(image))
+	return -1;
+
+    image->BitPixel		= 1 << image->bpc;
+    image->src.private_data	= (void *) image;
+
+    pdf_use_image_slot(p, im);
+    image->filename		= pdf_strdup(p, filename);
+
+    pdf_put_image(p, im);
+
+    /* keep the file open for the next page, if any */
+    if (TIFFLastDirectory(tiff->tif)) {
+	p->tiff_file->complete = pdf_true;
+	p->tiff_file->current = 0;
+	p->tiff_file->tif = NULL;
+	TIFFClose(tiff->tif);
+    }
+
+    tiff->tif			= NULL;
+    if (tiff->raw)
+	p->free(p, (void *) tiff->raw);
+    tiff->raw			= NULL;
+    image->colormap		= NULL;
+
+    return im;
+}
+
+#else	/* not HAVE_LIBTIFF */
+
+/* Define dummies if we can't use TIFFlib */
+void
+pdf_cleanup_tiff(PDF *p)
+{
+}
+
+PDFLIB_API int PDFLIB_CALL
+PDF_open_TIFF(PDF *p, const char *filename)
+{
+    return -1;
+}
+
+PDFLIB_API int PDFLIB_CALL
+PDF_open_TIFF_page(PDF *p, const char *filename, int page)
+{
+    return -1;
+}
+
+#endif	/* HAVE_LIBTIFF */
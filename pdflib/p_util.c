@@ -1,447 +1,958 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* p_util.c
- *
- * PDFlib utility routines
- *
- */
-
-#include <math.h>
-#include <string.h>
-#include <stdlib.h>
-#include <stdio.h>
-
-#include "p_intern.h"
-
-/* Format floating point numbers in a PDF compatible way.
- * This must be used for all floating output since PDF doesn't
- * allow %g exponential format, and %f produces too many characters
- * in most cases. PDF spec says: "use four or five decimal places".
- */
-
-/* Acrobat viewers change absolute values < 1/65536 to zero */
-#define SMALLREAL	0.000015
-
-/* Acrobat viewers have an upper limit on real numbers */
-#define BIGREAL		32767
-
-const char *
-pdf_float(char *buf, float f)
-{
-    if (fabs(f) < SMALLREAL)
-	return "0";			/* force very small numbers to zero   */
-
-    sprintf(buf, "%.4g", f);		/* try %g first and then check output */
-
-    if (strchr(buf, 'e')) {		/* this format is not PDF compatible  */
-	if (fabs(f) < 1)
-	    sprintf(buf, "%1.5f", f);	/* 5 decimal places for small numbers */
-	else if (fabs(f) <= BIGREAL)
-	    sprintf(buf, "%1.2f", f);	/* 2 decimal places for medium numbers*/
-	else
-	    sprintf(buf, "%1.0f", f);	/* skip decimal places for big numbers*/
-    }
-
-    return buf;
-}
-
-/* Unicode-related stuff */
-
-/* strlen() for unicode strings, which are terminated by two zero bytes.
- * wstrlen() returns the number of bytes in the Unicode string,
- * not including the two terminating null bytes.
- */
-static size_t
-wstrlen(const char *s)
-{
-    size_t len;
-
-    for(len = 0; 
-	(unsigned char) (s[len++]) != 0 ||
-	(unsigned char) (s[len++]) != 0; /* */ ) {
-	/* */
-    }
-
-    return len-2;
-}
-
-/* This function returns the length in bytes for C and Unicode strings.
- * Note that unlike strlen() it returns the length _including_ the 
- * terminator, which may be one or two null bytes.
- */
-size_t
-pdf_strlen(const char *text)
-{
-    if (pdf_is_unicode(text))
-	return wstrlen(text) + 2;
-    else
-	return strlen(text) + 1;
-}
-
-/* Allocate a PDFlib-local buffer and copy the string including
- * the terminating sentinel. If the string starts with the Unicode BOM
- * it is considered a Unicode string, and must be terminated by
- * two null bytes. Otherwise it is considered a plain C string and
- * must be terminated by a single null byte.
- * The caller is responsible for freeing the buffer.
- */
-char *
-pdf_strdup(PDF *p, const char *text)
-{
-    char *buf;
-    size_t len;
-
-    if (text == NULL)
-	pdf_error(p, PDF_SystemError, "NULL string in pdf_strdup");
-	
-    if (pdf_is_unicode(text))
-	len = wstrlen(text) + 2;
-    else
-	len = strlen(text) + 1;
-
-    buf = (char *) p->malloc(p, len, "pdf_strdup");
-    memcpy(buf, text, len);
-
-    return buf;
-}
-
-/* ----------------- Resource handling ----------------------- */
-char *
-pdf_find_resource(PDF *p, const char *category, const char *resourcename)
-{
-    pdf_category *cat;
-    pdf_res *res;
-    
-    /* Resources may have been added individually with PDF_set_parameter().
-     * If so, we search them; if not, we have to load the resource file.
-     */
-    if (p->resources == NULL && !p->resourcefile_loaded)
-	pdf_init_resources(p);
-
-    for (cat = p->resources; cat != (pdf_category *) NULL; cat = cat->next) {
-	if (!strcmp(cat->category, category)) {
-	    for (res = cat->kids; res != (pdf_res *)NULL; res=res->next) {
-		if (!strcmp(res->name, resourcename))
-		    return res->filename;
-	    }
-	    if (p->resourcefile_loaded)	/* all hope is lost */
-		return NULL;
-	}
-    }
-
-    /* Up to now we may have searched the individually loaded resources,
-     * but not the resource file. Since we haven't found the resource,
-     * we now (very lazily) load the resource file and try again.
-     */
-    if (!p->resourcefile_loaded) {
-	pdf_init_resources(p);
-	return pdf_find_resource(p, category, resourcename);
-    }
-
-    pdf_error(p, PDF_SystemError, "Resource category '%s' not found", category);
-    
-    /* Satisfy the compiler */
-    return NULL;
-}
-
-/* The UPR file handling routines are based on the publicly available
- * utility makepsres from Adobe Systems.
- */
-static void
-StripComments(char *buf)
-{
-    register char *ch = buf;
-
-    while (pdf_true) {
-	while (*ch != '%' && *ch != '\0')
-	    ch++;
-	if (*ch == '\0')
-	    break;
-	if (ch == buf || *(ch-1) != '\\') {
-	    *ch = '\0';
-	    break;
-	}
-	ch++;
-    }
-
-    /* ch points to '\0' right now */
-
-    if (ch == buf)
-	return;
-    ch--;
-
-    while (ch > buf && (*ch == ' ' || *ch == '\t' || *ch == '\n')) {
-	*ch = '\0';
-	ch--;
-    }
-
-    if (ch == buf && (*ch == ' ' || *ch == '\t' || *ch == '\n'))
-	*ch = '\0';
-}
-
-/* Caller must free returned line */
-
-#define BUFSIZE 1024
-
-static char *
-GetWholeLine(PDF *p, FILE *fp)
-{
-    char *line;
-    char buf[BUFSIZE];
-    size_t len, oldlen;
-
-    while (pdf_true) {
-	if (fgets(buf, BUFSIZE, fp) == NULL)
-	    return NULL;
-	StripComments(buf);	/* Strip comments and blank lines */
-	if (buf[0] != '\0')
-	    break;
-    }
-
-    StripComments(buf);
-    
-    len = strlen(buf); 
-    line = (char *) p->malloc(p, len+1, "GetWholeLine in UPR parser");
-    strcpy(line, buf);
-
-    if (line[len-1] == '\\') {	/* Continued... */
-	line[len-1] = '\0';
-	oldlen = len-1;
-	while (pdf_true) {
-	    if (fgets(buf, BUFSIZE, fp) == NULL)
-		return line;
-
-	    StripComments(buf);
-	    if (buf[0] == '\0') return line;
-
-	    len = strlen(buf);
-	    line = (char *) p->realloc(p, line, oldlen+len+1,
-			     "GetWholeLine in UPR parser");
-	    strcat(line, buf);
-
-	    oldlen += len;
-	    if (line[oldlen-1] != '\\')
-		break;
-	    line[oldlen-1] = '\0';
-	    oldlen--;
-	}
-    }
-    return line;
-}
-
-void
-pdf_add_resource(PDF *p, const char *category, const char *resource,
-		const char *filename, const char *prefix)
-{
-    pdf_category *cat, *lastcat = NULL;
-    pdf_res *res, *lastres = NULL;
-
-    /* All other (unknown) categories raise an error */
-    if (strcmp("FontOutline", category) &&
-	strcmp("FontAFM", category) &&
-	strcmp("FontTT", category) &&
-	strcmp("FontPFM", category)) {
-	    pdf_error(p, PDF_ValueError, "Unknown resource category");
-	    return;
-    }
-
-    /* make sure the resource file is loaded before adding user-supplied
-     * resources.
-     */
-    /* Nope: Evgeny wants to dynamically add resources without ever
-     * installing a static resource configuration file...
-     */
-    /*
-    pdf_init_resources(p);
-    */
-
-    /* find start of this category's resource list, if the category exists */
-    for (cat = p->resources; cat != (pdf_category *) NULL; cat = cat->next) {
-	lastcat = cat;
-	if (!strcmp(cat->category, category))
-	    break;
-    }
-
-    if (cat == NULL) {
-	cat = (pdf_category *) p->malloc(p, 
-			sizeof(pdf_category), "pdf_add_resource");
-	cat->category = pdf_strdup(p, category);
-	cat->kids = NULL;
-	cat->next = NULL;
-
-	if (lastcat) {
-	    lastcat->next = cat;
-	}else {
-	    p->resources = cat;
-	}
-    }
-
-    if (prefix == NULL) {
-	prefix = "";
-	if (filename[0] == '.' && filename[1] == '/') filename+=2;
-    } else {
-	prefix++; /* Skip over leading / */
-	if (prefix[0] == '.' && prefix[1] == '/') prefix += 2;
-    }
-
-    /* Go to the end of the resource list */
-    for (res = cat->kids; res != (pdf_res *) NULL; res = res->next)
-	lastres = res;
-
-    res = (pdf_res *) p->malloc(p, sizeof(pdf_res), "pdf_add_resource");
-
-    if (lastres)
-	lastres->next = res;
-    else
-	cat->kids = res;
-
-    res->next = NULL;
-    res->name = pdf_strdup(p, resource);
-    res->filename = (char *) p->malloc(p, strlen(filename) + strlen(prefix)+2,
-		"pdf_add_resource");
-
-    if (prefix != NULL && prefix[0] != '\0') {
-	strcpy (res->filename, prefix);
-	strcat (res->filename, PATHSEP);
-	strcat (res->filename, filename);
-    } else
-	strcpy (res->filename, filename);
-}
-
-void
-pdf_cleanup_resources(PDF *p)
-{
-    pdf_category *cat, *lastcat;
-    pdf_res *res, *lastres;
-
-    for (cat = p->resources; cat != (pdf_category *) NULL; /* */) {
-	for (res = cat->kids; res != (pdf_res *) NULL; /* */) {
-	    lastres = res;
-	    res = lastres->next;
-	    p->free(p, lastres->name);
-	    p->free(p, lastres->filename);
-	    p->free(p, lastres);
-	}
-	lastcat = cat;
-	cat = lastcat->next;
-	p->free(p, lastcat->category);
-	p->free(p, lastcat);
-    }
-}
-
-void
-pdf_init_resources(PDF *p)
-{
-    char	*uprfilename = NULL;
-    char	*resourceFile;
-    FILE	*fp;
-    char	buf[BUFSIZE];
-    char	*line;
-    char	*category;
-    char	*prefix = NULL;
-
-    if (p->resourcefile_loaded)
-	return;
-    else
-	p->resourcefile_loaded = pdf_true;
-
-#ifndef MAC
-    uprfilename = getenv(RESOURCEFILE);		/* user-supplied res file */
-#endif
-    if (uprfilename == NULL)
-	uprfilename = p->resourcefilename;	/* client-supplied res file */
-
-    if (uprfilename == NULL)			/* default resource file */
-	uprfilename = pdf_strdup(p, DEFAULTRESOURCEFILE);
-
-    if ((fp = fopen(uprfilename, "r")) == NULL)
-	pdf_error(p, PDF_IOError, "Resource configuration file '%s' not found",
-		uprfilename);
-
-    while (pdf_true) {		/* Skip over list of categories */
-	if (fgets(buf, BUFSIZE, fp) == NULL) {
-	    fclose(fp);
-	    return;
-	}
-	if (buf[0] == '.')
-	    break;
-    }
-
-    while (pdf_true) {	/* process categories */
-	line = GetWholeLine(p, fp);
-
-	if (line == NULL)
-	    break;
-      
-	if (line[0] == '/') {		/* Handle optional directory prefix */
-	    prefix = line;
-	    continue;
-	}
-
-	category = line;
-
-	while (pdf_true) {	/* process lines for this category */
-
-	    line = GetWholeLine(p, fp);
-	    if (line == NULL) {
-		if (prefix != NULL)
-		    p->free(p, prefix);
-		p->free(p, category);
-		fclose(fp);
-		return;
-	    }
-
-	    if (line[0] == '.') {
-		p->free(p, category);
-		p->free(p, line);
-		break;
-	    }
-
-	    resourceFile = line;
-	    while (pdf_true) {
-		if ((resourceFile = strchr(resourceFile, '=')) != NULL) {
-		    if (resourceFile != line && *(resourceFile-1) != '\\') {
-			*resourceFile++ = '\0';
-
-			if (*resourceFile == '=') {
-			    resourceFile++;		/* skip '=' character */
-			    pdf_add_resource(p, category, line, 
-				    resourceFile, NULL);
-			}else {
-			    pdf_add_resource(p, category, line, 
-				    resourceFile, prefix);
-			}
-
-			break;
-		    }
-		    resourceFile++;
-		} else
-		    break;		/* bogus resource line */
-	    }
-
-	    p->free(p, line);
-	}	/* process lines for this category */
-    }		/* process categories */
-
-    if (prefix != NULL)
-	p->free(p, prefix);
-    fclose(fp);
-}
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* p_util.c
+ *
+ * PDFlib utility routines
+ *
+ */
+
+#include <math.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifndef MAC
+#include <sys/types.h>
+#include <sys/stat.h>
+#endif
+
+#include "p_intern.h"
+
+/* Format floating point numbers in a PDF compatible way.
+ * This must be used for all floating output since PDF doesn't
+ * allow %g exponential format, and %f produces too many characters
+ * in most cases. PDF spec says: "use four or five decimal places".
+ *
+ * We don't use sprintf() since it is slow, and depends on the current
+ * locale which may specify a decimal comma instead of a decimal point.
+ * Instead, the number is rounded to a fixed number of decimal places and
+ * converted with integer arithmetic. Trailing zeros are dropped.
+ */
+
+/* Acrobat viewers change absolute values < 1/65536 to zero */
+#define SMALLREAL	0.000015
+
+/* Acrobat viewers have an upper limit on real numbers */
+#define BIGREAL		32767
+
+/* Larger numbers are clamped to the implementation limit for integers,
+ * which keeps them within FLOATBUFSIZE characters
+ */
+#define BIGINT		2147483647.0
+
+/* The decimal digits of 00 to 99 */
+static const char pdf_digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233"
+    "34353637383940414243444546474849505152535455565758596061626364656667"
+    "6869707172737475767778798081828384858687888990919293949596979899";
+
+/* Write the two decimal digits of n < 100 to cp */
+#define PDF_PUT2(cp, n)	\
+    ((cp)[0] = pdf_digit_pairs[2 * (n)], (cp)[1] = pdf_digit_pairs[2 * (n) + 1])
+
+/* Convert a non-negative integer to decimal digits, right-aligned in buf
+ * which must be large enough. Returns a pointer to the first digit.
+ */
+static char *
+pdf_utoa(char *end, unsigned long n)
+{
+    /* two digits per division */
+    while (n >= 100) {
+	end -= 2;
+	PDF_PUT2(end, n % 100);
+	n /= 100;
+    }
+
+    if (n >= 10) {
+	end -= 2;
+	PDF_PUT2(end, n);
+    } else
+	*--end = (char) ('0' + n);
+
+    return end;
+}
+
+/* Number of decimal places written for the non-negative number f */
+static unsigned long
+pdf_float_scale(double f, int *decimals)
+{
+    if (f < 1) {			/* 5 decimal places for small numbers */
+	*decimals = 5;
+	return 100000L;
+    } else if (f < 1000) {		/* 4 decimal places for normal numbers*/
+	*decimals = 4;
+	return 10000L;
+    } else if (f <= BIGREAL) {		/* 2 decimal places for medium numbers*/
+	*decimals = 2;
+	return 100L;
+    } else {				/* skip decimal places for big numbers*/
+	*decimals = 0;
+	return 1L;
+    }
+}
+
+/* The value which a PDF consumer sees after we have written f */
+double
+pdf_fround(double f)
+{
+    double	a = fabs(f);
+    unsigned long scale;
+    int		decimals;
+
+    if (!(f - f == 0) || a < SMALLREAL)		/* NaN or infinity */
+	return 0;
+
+    if (a >= BIGINT)
+	return f < 0 ? -BIGINT : BIGINT;
+
+    scale = pdf_float_scale(a, &decimals);
+    a = (double) (unsigned long) (a * scale + 0.5) / scale;
+
+    return f < 0 ? -a : a;
+}
+
+/* Write f to buf (at least FLOATBUFSIZE bytes) and return the length */
+int
+pdf_ftoa(char *buf, double f)
+{
+    char		digits[FLOATBUFSIZE], *cp = buf, *dp;
+    unsigned long	scale, ipart, fpart;
+    int			decimals;
+
+    if (!(f - f == 0))			/* NaN or infinity */
+	f = 0;
+
+    if (f < 0) {
+	if (f > -SMALLREAL)
+	    f = 0;
+	else {
+	    *cp++ = '-';
+	    f = -f;
+	}
+    }
+
+    if (f < SMALLREAL) {		/* force very small numbers to zero */
+	buf[0] = '0';
+	buf[1] = '\0';
+	return 1;
+    }
+
+    /* numbers too large for the integer conversion (never reasonable) */
+    if (f > BIGINT)
+	f = BIGINT;
+
+    scale = pdf_float_scale(f, &decimals);
+
+    /* f * scale fits into 32 bits in all cases. The divisions by
+     * constants are much cheaper than a division by scale.
+     */
+    fpart = (unsigned long) (f * scale + 0.5);
+    switch (decimals) {
+	case 5:
+	    ipart = fpart / 100000L;
+	    break;
+	case 4:
+	    ipart = fpart / 10000L;
+	    break;
+	case 2:
+	    ipart = fpart / 100L;
+	    break;
+	default:
+	    ipart = fpart;
+	    break;
+    }
+    fpart -= ipart * scale;
+
+    /* most numbers in page descriptions have at most three digits */
+    if (ipart < 10) {
+	*cp++ = (char) ('0' + ipart);
+    } else if (ipart < 100) {
+	PDF_PUT2(cp, ipart);
+	cp += 2;
+    } else if (ipart < 1000) {
+	*cp++ = (char) ('0' + ipart / 100);
+	PDF_PUT2(cp, ipart % 100);
+	cp += 2;
+    } else {
+	dp = pdf_utoa(digits + FLOATBUFSIZE, ipart);
+	while (dp < digits + FLOATBUFSIZE)
+	    *cp++ = *dp++;
+    }
+
+    if (fpart != 0) {
+	*cp++ = '.';
+
+	/* all decimal places including leading zeros... */
+	switch (decimals) {
+	    case 5:
+		*cp++ = (char) ('0' + fpart / 10000);
+		fpart %= 10000;
+		/* fall through */
+	    case 4:
+		PDF_PUT2(cp, fpart / 100);
+		PDF_PUT2(cp + 2, fpart % 100);
+		cp += 4;
+		break;
+	    case 2:
+		PDF_PUT2(cp, fpart);
+		cp += 2;
+		break;
+	}
+
+	/* ...and drop the trailing zeros */
+	while (cp[-1] == '0')
+	    cp--;
+    }
+
+    *cp = '\0';
+
+    return (int) (cp - buf);
+}
+
+const char *
+pdf_float(char *buf, float f)
+{
+    (void) pdf_ftoa(buf, (double) f);
+    return buf;
+}
+
+/* Unicode-related stuff */
+
+/* strlen() for unicode strings, which are terminated by two zero bytes.
+ * wstrlen() returns the number of bytes in the Unicode string,
+ * not including the two terminating null bytes. The string is scanned
+ * in units of two bytes, so characters with a zero low byte followed by
+ * a character with a zero high byte don't end it.
+ */
+static size_t
+wstrlen(const char *s)
+{
+    size_t len;
+
+    for (len = 0; s[len] != 0 || s[len + 1] != 0; len += 2)
+	/* */ ;
+
+    return len;
+}
+
+/* This function returns the length in bytes for C and Unicode strings.
+ * Note that unlike strlen() it returns the length _including_ the 
+ * terminator, which may be one or two null bytes.
+ */
+size_t
+pdf_strlen(const char *text)
+{
+    if (pdf_is_unicode(text))
+	return wstrlen(text) + 2;
+    else
+	return strlen(text) + 1;
+}
+
+/* Allocate a PDFlib-local buffer and copy the string including
+ * the terminating sentinel. If the string starts with the Unicode BOM
+ * it is considered a Unicode string, and must be terminated by
+ * two null bytes. Otherwise it is considered a plain C string and
+ * must be terminated by a single null byte.
+ * The caller is responsible for freeing the buffer.
+ */
+char *
+pdf_strdup(PDF *p, const char *text)
+{
+    char *buf;
+    size_t len;
+
+    if (text == NULL)
+	pdf_error(p, PDF_SystemError, "NULL string in pdf_strdup");
+	
+    if (pdf_is_unicode(text))
+	len = wstrlen(text) + 2;
+    else
+	len = strlen(text) + 1;
+
+    buf = (char *) p->malloc(p, len, "pdf_strdup");
+    memcpy(buf, text, len);
+
+    return buf;
+}
+
+/* String hash function for PDFlib's lookup tables. Tables must have a
+ * power-of-2 size and use the low-order bits, which don't depend on
+ * the size of unsigned long. The built-in font index in p_metrics.h
+ * was computed with this function, so don't change it.
+ */
+unsigned long
+pdf_hash_string(const char *s)
+{
+    unsigned long h = 0;
+
+    while (*s)
+	h = 31 * h + (unsigned char) *s++;
+
+    return h;
+}
+
+/* ----------------- Resource handling ----------------------- */
+
+/* The resource file is parsed into an immutable table with a hash index.
+ * Between PDF_boot() and PDF_shutdown() the tables are kept in a
+ * process-wide cache keyed by file name, and shared by all PDF objects
+ * which use the default allocator. A table is reloaded if the file's
+ * modification time changed. Resources added with PDF_set_parameter()
+ * are kept in a per-document list which takes precedence over the file.
+ */
+
+static const char *pdf_res_categories[] = {
+    "FontAFM", "FontPFM", "FontOutline", "FontTT", "FontPack"
+};
+
+#define RES_CATEGORIES	(int) (sizeof(pdf_res_categories) / sizeof(char *))
+
+typedef struct {
+    int		category;		/* index into pdf_res_categories */
+    char	*name;			/* resource name */
+    char	*filename;		/* file name including prefix */
+    int		next;			/* next entry in hash chain or -1 */
+} pdf_upr_entry;
+
+struct pdf_upr_s {
+    pdf_upr	*next;			/* next file in the cache */
+    char	*filename;		/* name of the resource file */
+    time_t	mtime;			/* modification time of the file */
+    int		refcount;		/* number of PDF objects using this */
+    pdf_bool	cached;			/* this table is in the cache */
+    pdf_bool	shared;			/* has been in the cache */
+    pdf_bool	has_category[RES_CATEGORIES];
+    pdf_upr_entry *entries;
+    int		entries_number;
+    int		entries_capacity;
+    int		*hash;			/* first entry in hash bucket or -1 */
+    int		hash_size;		/* number of buckets, power of 2 */
+};
+
+static pdf_upr	*pdf_upr_cache_list = NULL;
+static pdf_bool	pdf_upr_cache_active = pdf_false;
+
+static int
+pdf_res_category(PDF *p, const char *category)
+{
+    int i;
+
+    for (i = 0; i < RES_CATEGORIES; i++)
+	if (!strcmp(pdf_res_categories[i], category))
+	    return i;
+
+    /* All other (unknown) categories raise an error */
+    pdf_error(p, PDF_ValueError, "Unknown resource category");
+    return -1;
+}
+
+/* Build the file name of a resource from the UPR directory prefix */
+static char *
+pdf_res_filename(PDF *p, const char *filename, const char *prefix)
+{
+    char *result;
+
+    if (prefix == NULL) {
+	prefix = "";
+	if (filename[0] == '.' && filename[1] == '/') filename+=2;
+    } else {
+	prefix++; /* Skip over leading / */
+	if (prefix[0] == '.' && prefix[1] == '/') prefix += 2;
+    }
+
+    result = (char *) p->malloc(p, strlen(filename) + strlen(prefix)+2,
+		"pdf_res_filename");
+
+    if (prefix[0] != '\0') {
+	strcpy (result, prefix);
+	strcat (result, PATHSEP);
+	strcat (result, filename);
+    } else
+	strcpy (result, filename);
+
+    return result;
+}
+
+static int
+pdf_upr_bucket(pdf_upr *upr, int category, const char *name)
+{
+    return (int) ((pdf_hash_string(name) + (unsigned long) category)
+		& (unsigned long) (upr->hash_size - 1));
+}
+
+static pdf_upr_entry *
+pdf_upr_lookup(pdf_upr *upr, int category, const char *name)
+{
+    pdf_upr_entry *entry;
+    int i;
+
+    if (upr->hash_size == 0)
+	return NULL;
+
+    for (i = upr->hash[pdf_upr_bucket(upr, category, name)]; i != -1;
+	    i = entry->next) {
+	entry = &upr->entries[i];
+	if (entry->category == category && !strcmp(entry->name, name))
+	    return entry;
+    }
+
+    return NULL;
+}
+
+/* Look up a resource in several categories. Resources which have been
+ * added individually with PDF_set_parameter() take precedence over the
+ * resource file; within each, earlier categories win. It is an error if
+ * none of the categories is known at all. On success, *which receives
+ * the index of the category where the resource was found. The search
+ * starts at category 'first'; the ones before it only count as known.
+ */
+char *
+pdf_find_resources(PDF *p, const char **categories, int n, int first,
+	const char *resourcename, int *which)
+{
+    pdf_category *cat;
+    pdf_res *res;
+    pdf_upr_entry *entry;
+    pdf_bool found_category = pdf_false;
+    int i, catno;
+    
+    /* Resources may have been added individually with PDF_set_parameter().
+     * If so, we search them first.
+     */
+    for (i = 0; i < n; i++) {
+	for (cat = p->resources; cat != (pdf_category *) NULL; cat = cat->next) {
+	    if (!strcmp(cat->category, categories[i])) {
+		for (res = cat->kids; i >= first && res != (pdf_res *)NULL;
+			res = res->next) {
+		    if (!strcmp(res->name, resourcename)) {
+			*which = i;
+			return res->filename;
+		    }
+		}
+		found_category = pdf_true;
+	    }
+	}
+    }
+
+    /* Since we haven't found the resource, we now (very lazily) load the
+     * resource file.
+     */
+    if (!p->resourcefile_loaded)
+	pdf_init_resources(p);
+
+    for (i = 0; i < n && p->upr != NULL; i++) {
+	catno = pdf_res_category(p, categories[i]);
+
+	if (i >= first &&
+	    (entry = pdf_upr_lookup(p->upr, catno, resourcename)) != NULL) {
+	    *which = i;
+	    return entry->filename;
+	}
+
+	if (p->upr->has_category[catno])
+	    found_category = pdf_true;
+    }
+
+    if (found_category)		/* all hope is lost */
+	return NULL;
+
+    pdf_error(p, PDF_SystemError, "Resource category '%s' not found",
+	categories[n - 1]);
+    
+    /* Satisfy the compiler */
+    return NULL;
+}
+
+char *
+pdf_find_resource(PDF *p, const char *category, const char *resourcename)
+{
+    int which;
+
+    return pdf_find_resources(p, &category, 1, 0, resourcename, &which);
+}
+
+/* The UPR file handling routines are based on the publicly available
+ * utility makepsres from Adobe Systems.
+ */
+static void
+StripComments(char *buf)
+{
+    register char *ch = buf;
+
+    while (pdf_true) {
+	while (*ch != '%' && *ch != '\0')
+	    ch++;
+	if (*ch == '\0')
+	    break;
+	if (ch == buf || *(ch-1) != '\\') {
+	    *ch = '\0';
+	    break;
+	}
+	ch++;
+    }
+
+    /* ch points to '\0' right now */
+
+    if (ch == buf)
+	return;
+    ch--;
+
+    while (ch > buf && (*ch == ' ' || *ch == '\t' || *ch == '\n')) {
+	*ch = '\0';
+	ch--;
+    }
+
+    if (ch == buf && (*ch == ' ' || *ch == '\t' || *ch == '\n'))
+	*ch = '\0';
+}
+
+/* Caller must free returned line */
+
+#define BUFSIZE 1024
+
+static char *
+GetWholeLine(PDF *p, FILE *fp)
+{
+    char *line;
+    char buf[BUFSIZE];
+    size_t len, oldlen;
+
+    while (pdf_true) {
+	if (fgets(buf, BUFSIZE, fp) == NULL)
+	    return NULL;
+	StripComments(buf);	/* Strip comments and blank lines */
+	if (buf[0] != '\0')
+	    break;
+    }
+
+    StripComments(buf);
+    
+    len = strlen(buf); 
+    line = (char *) p->malloc(p, len+1, "GetWholeLine in UPR parser");
+    strcpy(line, buf);
+
+    if (line[len-1] == '\\') {	/* Continued... */
+	line[len-1] = '\0';
+	oldlen = len-1;
+	while (pdf_true) {
+	    if (fgets(buf, BUFSIZE, fp) == NULL)
+		return line;
+
+	    StripComments(buf);
+	    if (buf[0] == '\0') return line;
+
+	    len = strlen(buf);
+	    line = (char *) p->realloc(p, line, oldlen+len+1,
+			     "GetWholeLine in UPR parser");
+	    strcat(line, buf);
+
+	    oldlen += len;
+	    if (line[oldlen-1] != '\\')
+		break;
+	    line[oldlen-1] = '\0';
+	    oldlen--;
+	}
+    }
+    return line;
+}
+
+static void
+pdf_upr_add(PDF *p, pdf_upr *upr, const char *category, const char *resource,
+		const char *filename, const char *prefix)
+{
+    pdf_upr_entry *entry;
+    int catno;
+
+    catno = pdf_res_category(p, category);
+
+    if (upr->entries_number == upr->entries_capacity) {
+	upr->entries_capacity *= 2;
+	upr->entries = (pdf_upr_entry *) p->realloc(p, upr->entries,
+		sizeof(pdf_upr_entry) * upr->entries_capacity, "pdf_upr_add");
+    }
+
+    entry = &upr->entries[upr->entries_number++];
+    entry->category = catno;
+    entry->name = pdf_strdup(p, resource);
+    entry->filename = pdf_res_filename(p, filename, prefix);
+    upr->has_category[catno] = pdf_true;
+}
+
+/* Build the hash index. Earlier entries take precedence, so they are
+ * inserted last.
+ */
+static void
+pdf_upr_index(PDF *p, pdf_upr *upr)
+{
+    int i, bucket;
+
+    for (upr->hash_size = 16; upr->hash_size < 2 * upr->entries_number; )
+	upr->hash_size *= 2;
+
+    upr->hash = (int *) p->malloc(p, sizeof(int) * upr->hash_size,
+		"pdf_upr_index");
+
+    for (i = 0; i < upr->hash_size; i++)
+	upr->hash[i] = -1;
+
+    for (i = upr->entries_number - 1; i >= 0; i--) {
+	bucket = pdf_upr_bucket(upr, upr->entries[i].category,
+			upr->entries[i].name);
+	upr->entries[i].next = upr->hash[bucket];
+	upr->hash[bucket] = i;
+    }
+}
+
+/* p may be NULL for tables from the cache */
+static void
+pdf_free_upr(PDF *p, pdf_upr *upr)
+{
+    void (*freeproc)(PDF *p, void *mem);
+    int i;
+
+    freeproc = p ? p->free : pdf_free;
+
+    for (i = 0; i < upr->entries_number; i++) {
+	freeproc(p, upr->entries[i].name);
+	freeproc(p, upr->entries[i].filename);
+    }
+
+    freeproc(p, upr->entries);
+    if (upr->hash)
+	freeproc(p, upr->hash);
+    freeproc(p, upr->filename);
+    freeproc(p, upr);
+}
+
+/* Only tables which have been in the cache can be used by other PDF
+ * objects, so private tables are released without taking the lock.
+ */
+static void
+pdf_release_upr(PDF *p, pdf_upr *upr)
+{
+    pdf_bool unused;
+
+    if (!upr->shared) {
+	pdf_free_upr(p, upr);
+	return;
+    }
+
+    pdf_lock();
+    unused = (--upr->refcount == 0 && !upr->cached);
+    pdf_unlock();
+
+    if (unused)
+	pdf_free_upr(p, upr);
+}
+
+void
+pdf_init_upr_cache(void)
+{
+    pdf_lock();
+    pdf_upr_cache_active = pdf_true;
+    pdf_unlock();
+}
+
+/* Tables which are still in use are freed when they are released */
+void
+pdf_cleanup_upr_cache(void)
+{
+    pdf_upr *upr, *next;
+
+    pdf_lock();
+    if (!pdf_upr_cache_active) {
+	pdf_unlock();
+	return;
+    }
+    pdf_upr_cache_active = pdf_false;
+
+    for (upr = pdf_upr_cache_list; upr != NULL; upr = next) {
+	next = upr->next;
+	upr->cached = pdf_false;
+	if (upr->refcount == 0)
+	    pdf_free_upr(NULL, upr);
+    }
+    pdf_upr_cache_list = NULL;
+    pdf_unlock();
+}
+
+void
+pdf_add_resource(PDF *p, const char *category, const char *resource,
+		const char *filename, const char *prefix)
+{
+    pdf_category *cat, *lastcat = NULL;
+    pdf_res *res, *lastres = NULL;
+
+    (void) pdf_res_category(p, category);	/* check category */
+
+    /* find start of this category's resource list, if the category exists */
+    for (cat = p->resources; cat != (pdf_category *) NULL; cat = cat->next) {
+	lastcat = cat;
+	if (!strcmp(cat->category, category))
+	    break;
+    }
+
+    if (cat == NULL) {
+	cat = (pdf_category *) p->malloc(p, 
+			sizeof(pdf_category), "pdf_add_resource");
+	cat->category = pdf_strdup(p, category);
+	cat->kids = NULL;
+	cat->next = NULL;
+
+	if (lastcat) {
+	    lastcat->next = cat;
+	}else {
+	    p->resources = cat;
+	}
+    }
+
+    /* Go to the end of the resource list */
+    for (res = cat->kids; res != (pdf_res *) NULL; res = res->next)
+	lastres = res;
+
+    res = (pdf_res *) p->malloc(p, sizeof(pdf_res), "pdf_add_resource");
+
+    if (lastres)
+	lastres->next = res;
+    else
+	cat->kids = res;
+
+    res->next = NULL;
+    res->name = pdf_strdup(p, resource);
+    res->filename = pdf_res_filename(p, filename, prefix);
+}
+
+void
+pdf_cleanup_resources(PDF *p)
+{
+    pdf_category *cat, *lastcat;
+    pdf_res *res, *lastres;
+
+    for (cat = p->resources; cat != (pdf_category *) NULL; /* */) {
+	for (res = cat->kids; res != (pdf_res *) NULL; /* */) {
+	    lastres = res;
+	    res = lastres->next;
+	    p->free(p, lastres->name);
+	    p->free(p, lastres->filename);
+	    p->free(p, lastres);
+	}
+	lastcat = cat;
+	cat = lastcat->next;
+	p->free(p, lastcat->category);
+	p->free(p, lastcat);
+    }
+
+    if (p->upr != NULL) {
+	pdf_release_upr(p, p->upr);
+	p->upr = NULL;
+    }
+}
+
+/* Return the modification time of a file, or -1 if it doesn't exist.
+ * On the Mac we don't check for changes of the file.
+ */
+time_t
+pdf_file_mtime(const char *filename)
+{
+#ifdef MAC
+    (void) filename;
+    return (time_t) 0;
+#else
+    struct stat	st;
+
+    if (stat(filename, &st) != 0)
+	return (time_t) -1;
+
+    return st.st_mtime;
+#endif
+}
+
+/* Parse a UPR file into p->upr */
+static void
+pdf_load_upr(PDF *p, FILE *fp)
+{
+    char	*resourceFile;
+    char	buf[BUFSIZE];
+    char	*line;
+    char	*category;
+    char	*prefix = NULL;
+
+    while (pdf_true) {		/* Skip over list of categories */
+	if (fgets(buf, BUFSIZE, fp) == NULL)
+	    return;
+	if (buf[0] == '.')
+	    break;
+    }
+
+    while (pdf_true) {	/* process categories */
+	line = GetWholeLine(p, fp);
+
+	if (line == NULL)
+	    break;
+      
+	if (line[0] == '/') {		/* Handle optional directory prefix */
+	    prefix = line;
+	    continue;
+	}
+
+	category = line;
+
+	while (pdf_true) {	/* process lines for this category */
+
+	    line = GetWholeLine(p, fp);
+	    if (line == NULL) {
+		if (prefix != NULL)
+		    p->free(p, prefix);
+		p->free(p, category);
+		return;
+	    }
+
+	    if (line[0] == '.') {
+		p->free(p, category);
+		p->free(p, line);
+		break;
+	    }
+
+	    resourceFile = line;
+	    while (pdf_true) {
+		if ((resourceFile = strchr(resourceFile, '=')) != NULL) {
+		    if (resourceFile != line && *(resourceFile-1) != '\\') {
+			*resourceFile++ = '\0';
+
+			if (*resourceFile == '=') {
+			    resourceFile++;		/* skip '=' character */
+			    pdf_upr_add(p, p->upr, category, line, 
+				    resourceFile, NULL);
+			}else {
+			    pdf_upr_add(p, p->upr, category, line, 
+				    resourceFile, prefix);
+			}
+
+			break;
+		    }
+		    resourceFile++;
+		} else
+		    break;		/* bogus resource line */
+	    }
+
+	    p->free(p, line);
+	}	/* process lines for this category */
+    }		/* process categories */
+
+    if (prefix != NULL)
+	p->free(p, prefix);
+}
+
+void
+pdf_init_resources(PDF *p)
+{
+    char	*uprfilename = NULL;
+    FILE	*fp;
+    pdf_upr	*upr;
+    pdf_bool	share;
+    time_t	mtime;
+
+    if (p->resourcefile_loaded)
+	return;
+    else
+	p->resourcefile_loaded = pdf_true;
+
+    if (p->upr != NULL) {	/* left over from a previous document */
+	pdf_release_upr(p, p->upr);
+	p->upr = NULL;
+    }
+
+#ifndef MAC
+    uprfilename = getenv(RESOURCEFILE);		/* user-supplied res file */
+#endif
+    if (uprfilename == NULL)
+	uprfilename = p->resourcefilename;	/* client-supplied res file */
+
+    if (uprfilename == NULL)			/* default resource file */
+	uprfilename = DEFAULTRESOURCEFILE;
+
+    if ((mtime = pdf_file_mtime(uprfilename)) == (time_t) -1)
+	pdf_error(p, PDF_IOError, "Resource configuration file '%s' not found",
+		uprfilename);
+
+    share = pdf_upr_cache_active && pdf_default_allocator(p);
+
+    /* Look for an up-to-date copy in the cache */
+    if (share) {
+	pdf_lock();
+	for (upr = pdf_upr_cache_list; upr != NULL; upr = upr->next)
+	    if (!strcmp(upr->filename, uprfilename) &&
+		upr->mtime == mtime) {
+		upr->refcount++;
+		p->upr = upr;
+		break;
+	    }
+	pdf_unlock();
+
+	if (p->upr != NULL)
+	    return;
+    }
+
+    if ((fp = fopen(uprfilename, "r")) == NULL)
+	pdf_error(p, PDF_IOError, "Resource configuration file '%s' not found",
+		uprfilename);
+
+    /* Hook up the table before parsing so it gets freed on errors */
+    upr = (pdf_upr *) p->calloc(p, sizeof(pdf_upr), "pdf_init_resources");
+    upr->filename = pdf_strdup(p, uprfilename);
+    upr->mtime = mtime;
+    upr->refcount = 1;
+    upr->entries_capacity = 64;
+    upr->entries = (pdf_upr_entry *) p->malloc(p,
+	    sizeof(pdf_upr_entry) * upr->entries_capacity, "pdf_init_resources");
+    p->upr = upr;
+
+    pdf_load_upr(p, fp);
+    fclose(fp);
+
+    pdf_upr_index(p, upr);
+
+    if (!share)
+	return;
+
+    /* Replace outdated copies of this file in the cache with ours */
+    pdf_lock();
+    if (pdf_upr_cache_active) {
+	pdf_upr **link = &pdf_upr_cache_list, *old;
+
+	while ((old = *link) != NULL) {
+	    if (!strcmp(old->filename, uprfilename)) {
+		*link = old->next;
+		old->cached = pdf_false;
+		if (old->refcount == 0)
+		    pdf_free_upr(NULL, old);
+	    } else
+		link = &old->next;
+	}
+
+	upr->cached = pdf_true;
+	upr->shared = pdf_true;
+	upr->next = pdf_upr_cache_list;
+	pdf_upr_cache_list = upr;
+    }
+    pdf_unlock();
+}
@@ -1,166 +1,174 @@
-# Microsoft Developer Studio Project File - Name="pdflib" - Package Owner=<4>
-# Microsoft Developer Studio Generated Build File, Format Version 6.00
-# ** DO NOT EDIT **
-
-# TARGTYPE "Win32 (x86) Dynamic-Link Library" 0x0102
-
-CFG=pdflib - Win32 Release
-!MESSAGE This is not a valid makefile. To build this project using NMAKE,
-!MESSAGE use the Export Makefile command and run
-!MESSAGE 
-!MESSAGE NMAKE /f "pdflib.mak".
-!MESSAGE 
-!MESSAGE You can specify a configuration when running NMAKE
-!MESSAGE by defining the macro CFG on the command line. For example:
-!MESSAGE 
-!MESSAGE NMAKE /f "pdflib.mak" CFG="pdflib - Win32 Release"
-!MESSAGE 
-!MESSAGE Possible choices for configuration are:
-!MESSAGE 
-!MESSAGE "pdflib - Win32 Release" (based on "Win32 (x86) Dynamic-Link Library")
-!MESSAGE 
-
-# Begin Project
-# PROP AllowPerConfigDependencies 0
-# PROP Scc_ProjName ""
-# PROP Scc_LocalPath ""
-CPP=cl.exe
-MTL=midl.exe
-RSC=rc.exe
-# PROP BASE Use_MFC 0
-# PROP BASE Use_Debug_Libraries 1
-# PROP BASE Output_Dir "pdflib___Win32_Release"
-# PROP BASE Intermediate_Dir "pdflib___Win32_Release"
-# PROP BASE Ignore_Export_Lib 0
-# PROP BASE Target_Dir ""
-# PROP Use_MFC 0
-# PROP Use_Debug_Libraries 1
-# PROP Output_Dir ""
-# PROP Intermediate_Dir "Release"
-# PROP Ignore_Export_Lib 0
-# PROP Target_Dir ""
-# ADD BASE CPP /nologo /MTd /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_WINDOWS" /D "_MBCS" /D "_USRDLL" /D "PDFLIB_EXPORTS" /YX /FD /GZ /c
-# ADD CPP /nologo /MT /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_WINDOWS" /D "_MBCS" /D "_USRDLL" /D "PDFLIB_EXPORTS" /YX /FD /GZ /c
-# ADD BASE MTL /nologo /D "_DEBUG" /mktyplib203 /win32
-# ADD MTL /nologo /D "_DEBUG" /mktyplib203 /win32
-# ADD BASE RSC /l 0x407 /d "_DEBUG"
-# ADD RSC /l 0x407 /d "_DEBUG"
-BSC32=bscmake.exe
-# ADD BASE BSC32 /nologo
-# ADD BSC32 /nologo
-LINK32=link.exe
-# ADD BASE LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /version:2.01 /dll /debug /machine:I386 /pdbtype:sept
-# ADD LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /version:2.01 /dll /debug /machine:I386 /pdbtype:sept
-# Begin Target
-
-# Name "pdflib - Win32 Release"
-# Begin Group "Source Files"
-
-# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
-# Begin Source File
-
-SOURCE=.\p_afmparse.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_annots.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_basic.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_ccitt.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_color.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_draw.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_filter.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_font.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_gif.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_gstate.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_hyper.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_image.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_jpeg.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_text.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_tiff.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_util.c
-# End Source File
-# End Group
-# Begin Group "Header Files"
-
-# PROP Default_Filter "h;hpp;hxx;hm;inl"
-# Begin Source File
-
-SOURCE=.\ansi_e.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\macrom_e.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_afmparse.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_config.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_intern.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_metrics.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\pdfdoc_e.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\pdflib.h
-# End Source File
-# End Group
-# Begin Group "Resource Files"
-
-# PROP Default_Filter "ico;cur;bmp;dlg;rc2;rct;bin;rgs;gif;jpg;jpeg;jpe"
-# End Group
-# End Target
-# End Project
+# Microsoft Developer Studio Project File - Name="pdflib" - Package Owner=<4>
+# Microsoft Developer Studio Generated Build File, Format Version 6.00
+# ** DO NOT EDIT **
+
+# TARGTYPE "Win32 (x86) Dynamic-Link Library" 0x0102
+
+CFG=pdflib - Win32 Release
+!MESSAGE This is not a valid makefile. To build this project using NMAKE,
+!MESSAGE use the Export Makefile command and run
+!MESSAGE 
+!MESSAGE NMAKE /f "pdflib.mak".
+!MESSAGE 
+!MESSAGE You can specify a configuration when running NMAKE
+!MESSAGE by defining the macro CFG on the command line. For example:
+!MESSAGE 
+!MESSAGE NMAKE /f "pdflib.mak" CFG="pdflib - Win32 Release"
+!MESSAGE 
+!MESSAGE Possible choices for configuration are:
+!MESSAGE 
+!MESSAGE "pdflib - Win32 Release" (based on "Win32 (x86) Dynamic-Link Library")
+!MESSAGE 
+
+# Begin Project
+# PROP AllowPerConfigDependencies 0
+# PROP Scc_ProjName ""
+# PROP Scc_LocalPath ""
+CPP=cl.exe
+MTL=midl.exe
+RSC=rc.exe
+# PROP BASE Use_MFC 0
+# PROP BASE Use_Debug_Libraries 1
+# PROP BASE Output_Dir "pdflib___Win32_Release"
+# PROP BASE Intermediate_Dir "pdflib___Win32_Release"
+# PROP BASE Ignore_Export_Lib 0
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 0
+# PROP Use_Debug_Libraries 1
+# PROP Output_Dir ""
+# PROP Intermediate_Dir "Release"
+# PROP Ignore_Export_Lib 0
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /MTd /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_WINDOWS" /D "_MBCS" /D "_USRDLL" /D "PDFLIB_EXPORTS" /YX /FD /GZ /c
+# ADD CPP /nologo /MT /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_WINDOWS" /D "_MBCS" /D "_USRDLL" /D "PDFLIB_EXPORTS" /YX /FD /GZ /c
+# ADD BASE MTL /nologo /D "_DEBUG" /mktyplib203 /win32
+# ADD MTL /nologo /D "_DEBUG" /mktyplib203 /win32
+# ADD BASE RSC /l 0x407 /d "_DEBUG"
+# ADD RSC /l 0x407 /d "_DEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LINK32=link.exe
+# ADD BASE LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /version:2.01 /dll /debug /machine:I386 /pdbtype:sept
+# ADD LINK32 kernel32.lib user32.lib gdi32.lib winspool.lib comdlg32.lib advapi32.lib shell32.lib ole32.lib oleaut32.lib uuid.lib odbc32.lib odbccp32.lib /nologo /version:2.01 /dll /debug /machine:I386 /pdbtype:sept
+# Begin Target
+
+# Name "pdflib - Win32 Release"
+# Begin Group "Source Files"
+
+# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
+# Begin Source File
+
+SOURCE=.\p_afmparse.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_annots.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_basic.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_ccitt.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_color.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_draw.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_filter.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_font.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_fontpack.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_gif.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_gstate.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_hyper.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_image.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_jpeg.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_stream.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_text.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_tiff.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_util.c
+# End Source File
+# End Group
+# Begin Group "Header Files"
+
+# PROP Default_Filter "h;hpp;hxx;hm;inl"
+# Begin Source File
+
+SOURCE=.\ansi_e.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\macrom_e.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_afmparse.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_config.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_intern.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_metrics.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\pdfdoc_e.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\pdflib.h
+# End Source File
+# End Group
+# Begin Group "Resource Files"
+
+# PROP Default_Filter "ico;cur;bmp;dlg;rc2;rct;bin;rgs;gif;jpg;jpeg;jpe"
+# End Group
+# End Target
+# End Project
@@ -1,227 +1,909 @@
-/*---------------------------------------------------------------------------*
- |        PDFlib - A library for dynamically generating PDF files            |
- +---------------------------------------------------------------------------+
- |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
- +---------------------------------------------------------------------------+
- |    This software is not in the public domain.  It is subject to the       |
- |    "Aladdin Free Public License".  See the file license.txt for details.  |
- |    This license grants you the right to use and redistribute PDFlib       |
- |    under certain conditions. Among other things, the license requires     |
- |    that the copyright notice and this notice be preserved on all copies.  |
- |    This requirement extends to ports to other programming languages.      |
- |                                                                           |
- |    In short, you are allowed to develop and use PDFlib-based software     |
- |    as long as you don't sell it. Commercial use of PDFlib requires a      |
- |    commercial license which can be obtained from the author of PDFlib.    |
- |    Contact information can be found in the accompanying PDFlib manual.    |
- |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
- |    however, will receive warranty and support statements in writing.      |
- *---------------------------------------------------------------------------*/
-
-/* pdflib.i
- *
- * PDFlib interface file for SWIG
- *
- */
-
-#if	defined(SWIGJAVA)
-%title "PDFlib scripting API reference for Java (currently incomplete)"
-#elif	defined(SWIGPERL)
-%title "PDFlib scripting API reference for Perl"
-#elif	defined(SWIGPYTHON)
-%title "PDFlib scripting API reference for Python"
-#elif	defined(SWIGTCL)
-%title "PDFlib scripting API reference for Tcl"
-#endif
-
-%module pdflib
-%style before, noinfo
-
-/* Fetch SWIG's exception handling mechanism */
-%include exception.i
-
-%text %{
-This is only a brief summary of the PDFlib API interface.
-For a more complete description of the functions see the PDFlib API
-reference manual.
-
-Most functions do not return any value. For those functions which do
-return a value, the meaning of the returned value is explained in the
-function description below.
-
-\\
-%}
-
-/* The JNI currently doesn't support initialization routines - we handle
- this ourselves with a static method in the Java pragma further below.
- */
-#if !defined(SWIGJAVA)
-%init %{
-	/* Boot the PDFlib core */
-	PDF_boot();
-%}
-#endif
-
-#ifdef SWIGTCL
-/* to get Tcl_Interp *interp handled correctly */
-%import typemaps.i
-
-/* THE PDFLIB_VERSIONSTRING macro will be substituted in the wrapper file */
-%init %{
-	/* Tell Tcl which package we are going to define */
-	Tcl_PkgProvide(interp, "pdflib", PDFLIB_VERSIONSTRING);
-%}
-#endif
-
-/* The version number of the shared library will be patched by make */
-%pragma(java) module = "
-    // The initialization code for loading the PDFlib shared library.
-    // The library name will be transformed into something platform-
-    // specific by the VM, e.g. libpdf_java2.0.so or pdf_java2.0.dll.
-    static {
-	try {
-	    System.loadLibrary(\"pdf_java2.01\");
-	} catch (UnsatisfiedLinkError e) {
-	    System.err.println(
-	    \"Cannot load the PDFlib shared library for Java.\n\" +
-	    \"Make sure that LD_LIBRARY_PATH (Unix) or PATH (Win32)\n\" +
-	    \"contain the current directory\n\" + e);
-	    System.exit(1);
-	}
-	PDF_boot();
-    }
-";
-
-/* The following block will be copied verbatim to the wrapper files. */
-%{
-#include <setjmp.h>
-
-/* The following sick stuff is an attempt to make recent Perl versions
- * work with recent SWIG versions compiled with recent MS VC++ versions.
- */
-#ifdef _MSC_VER
-    #undef setjmp
-    #define setjmp _setjmp
-    #undef longjmp
-#endif
-
-#include "pdflib.h"
-
-/* Map PDFlib errors to SWIG exceptions */
-static const int pdf_swig_exceptions[] = {
-    0,
-    SWIG_MemoryError,	/* PDF_MemoryError    1 */
-    SWIG_IOError,	/* PDF_IOError        2 */
-    SWIG_RuntimeError,	/* PDF_RuntimeError   3 */
-    SWIG_IndexError,	/* PDF_IndexError     4 */
-    SWIG_TypeError,	/* PDF_TypeError      5 */
-    SWIG_DivisionByZero,/* PDF_DivisionByZero 6 */
-    SWIG_OverflowError,	/* PDF_OverflowError  7 */
-    SWIG_SyntaxError,	/* PDF_SyntaxError    8 */
-    SWIG_ValueError,	/* PDF_ValueError     9 */
-    SWIG_SystemError,	/* PDF_SystemError   10 */
-    SWIG_UnknownError,	/* PDF_NonfatalError 11 */ /* PDFlib-special */
-    SWIG_UnknownError,	/* PDF_UnknownError  12 */
-};
-
-/* SWIG exception handling is currently not thread-safe! */
-static jmp_buf		exception_buffer;
-static int		exception_status;
-static char		error_message[256];
-
-/* Exception handling for SWIG. Note that these are not used for the C API */
-#define try		if ((exception_status = setjmp(exception_buffer)) == 0)
-#define catch(error)	else if (exception_status == error)
-#define throw(error)	longjmp(exception_buffer, error)
-#define finally		else
-
-/* PDFlib error handler for the SWIG libraries */
-
-static void
-pdf_swig_errorhandler(PDF *p, int type, const char* shortmsg)
-{
-    sprintf(error_message, "PDFlib: %s\n", shortmsg);
-
-    /* Issue a warning message and continue for non-fatal errors */
-    if (type == PDF_NonfatalError) {
-	fprintf(stderr, error_message);
-	return;
-    }
-	
-    /* Clean up PDFlib internals and delete p in all other cases */
-    if (p != NULL)
-	PDF_delete(p);
-
-    /* ...and throw an exception */
-    throw(type);
-}
-
-/* Force the SWIG error handler for all clients */
-#define PDF_new() PDF_new2(pdf_swig_errorhandler, NULL, NULL, NULL, NULL)
-%}
-
-#ifdef SWIGJAVA
-%{
-/* Map PDFlib errors to Java exceptions */
-static const char *pdf_java_exceptions[] = {
-NULL,
-"java/lang/OutOfMemoryError",		/* PDF_MemoryError    1 */
-"java/io/IOException",			/* PDF_IOError        2 */
-"java/lang/IllegalArgumentException",	/* PDF_RuntimeError   3 */
-"java/lang/IndexOutOfBoundsException",	/* PDF_IndexError     4 */
-"java/lang/ClassCastException",		/* PDF_TypeError      5 */
-"java/lang/ArithmeticException",	/* PDF_DivisionByZero 6 */
-"java/lang/ArithmeticException",	/* PDF_OverflowError  7 */
-"java/lang/RuntimeException",		/* PDF_SyntaxError    8 */
-"java/lang/IllegalArgumentException",	/* PDF_ValueError     9 */
-"java/lang/InternalError",		/* PDF_SystemError   10 */
-"java/lang/UnknownError",		/* PDF_NonfatalError 11 */
-"java/lang/UnknownError",		/* PDF_UnknownError  12 */
-};
-
-/* This should come from SWIG but SWIG's experimental Java support
- * currently doesn't cover exceptions.
- */
-
-#define SWIG_exception(type, msg) (*jenv)->ThrowNew(jenv, \
-        (*jenv)->FindClass(jenv, pdf_java_exceptions[type]), msg);
-
-%}
-
-#endif	/* SWIGJAVA */
-
-/* This error handler which will be used for all languages.
- * The construction is somewhat uglier than the usual try...catch...catch,
- * but this will save us ca. 2000 (!) lines of code in the generated
- * wrapper files since all wrapped functions will be affected by
- * code bloat from the exception handling mechanism.
- */
-%except {
-    try { $function }
-    else {
-	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
-    }
-}
-
-%{
-/* export the PDFlib routines to the shared library */
-#ifdef __MWERKS__
-#pragma export on
-#endif
-
-%}
-
-/* This #include will actually be carried out by SWIG. */
-%include "pdflib.h"
-
-#ifdef SWIGPERL
-%echo %{
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-Don't forget to change the following line in pdflib_pl.c:
-    SWIGEXPORT(void,boot_pdflib)(CPerl *, CV *cv);
-to:
-    SWIGEXPORT(void,boot_pdflib)(CV *cv, CPerlObj *pPerl);
-This is only necessary for using PDFlib with ActivePerl on Win32.
-!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
-%}
-#endif /* SWIGPERL */
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* pdflib.i
+ *
+ * PDFlib interface file for SWIG
+ *
+ */
+
+#if	defined(SWIGJAVA)
+%title "PDFlib scripting API reference for Java (currently incomplete)"
+#elif	defined(SWIGPERL)
+%title "PDFlib scripting API reference for Perl"
+#elif	defined(SWIGPYTHON)
+%title "PDFlib scripting API reference for Python"
+#elif	defined(SWIGTCL)
+%title "PDFlib scripting API reference for Tcl"
+#endif
+
+%module pdflib
+%style before, noinfo
+
+/* Fetch SWIG's exception handling mechanism */
+%include exception.i
+
+%text %{
+This is only a brief summary of the PDFlib API interface.
+For a more complete description of the functions see the PDFlib API
+reference manual.
+
+Most functions do not return any value. For those functions which do
+return a value, the meaning of the returned value is explained in the
+function description below.
+
+\\
+%}
+
+/* The JNI currently doesn't support initialization routines - we handle
+ this ourselves with a static method in the Java pragma further below.
+ */
+#if !defined(SWIGJAVA)
+%init %{
+	/* Boot the PDFlib core */
+	PDF_boot();
+%}
+#endif
+
+#ifdef SWIGTCL
+/* to get Tcl_Interp *interp handled correctly */
+%import typemaps.i
+
+/* THE PDFLIB_VERSIONSTRING macro will be substituted in the wrapper file */
+%init %{
+	/* Tell Tcl which package we are going to define */
+	Tcl_PkgProvide(interp, "pdflib", PDFLIB_VERSIONSTRING);
+%}
+#endif
+
+/* The version number of the shared library will be patched by make */
+%pragma(java) module = "
+    // The initialization code for loading the PDFlib shared library.
+    // The library name will be transformed into something platform-
+    // specific by the VM, e.g. libpdf_java2.0.so or pdf_java2.0.dll.
+    static {
+	try {
+	    System.loadLibrary(\"pdf_java2.01\");
+	} catch (UnsatisfiedLinkError e) {
+	    System.err.println(
+	    \"Cannot load the PDFlib shared library for Java.\n\" +
+	    \"Make sure that LD_LIBRARY_PATH (Unix) or PATH (Win32)\n\" +
+	    \"contain the current directory\n\" + e);
+	    System.exit(1);
+	}
+	PDF_boot();
+    }
+
+  public final static native void PDF_show_many(long jarg0, String [] jarg1, float [] jarg2, float [] jarg3, int [] jarg4);
+  public final static native void PDF_polyline(long jarg0, float [] jarg1);
+  public final static native void PDF_polygon(long jarg0, float [] jarg1);
+  public final static native void PDF_rects(long jarg0, float [] jarg1);
+";
+
+/* The following block will be copied verbatim to the wrapper files. */
+%{
+#include <setjmp.h>
+
+/* The following sick stuff is an attempt to make recent Perl versions
+ * work with recent SWIG versions compiled with recent MS VC++ versions.
+ */
+#ifdef _MSC_VER
+    #undef setjmp
+    #define setjmp _setjmp
+    #undef longjmp
+#endif
+
+#include "pdflib.h"
+
+/* Map PDFlib errors to SWIG exceptions */
+static const int pdf_swig_exceptions[] = {
+    0,
+    SWIG_MemoryError,	/* PDF_MemoryError    1 */
+    SWIG_IOError,	/* PDF_IOError        2 */
+    SWIG_RuntimeError,	/* PDF_RuntimeError   3 */
+    SWIG_IndexError,	/* PDF_IndexError     4 */
+    SWIG_TypeError,	/* PDF_TypeError      5 */
+    SWIG_DivisionByZero,/* PDF_DivisionByZero 6 */
+    SWIG_OverflowError,	/* PDF_OverflowError  7 */
+    SWIG_SyntaxError,	/* PDF_SyntaxError    8 */
+    SWIG_ValueError,	/* PDF_ValueError     9 */
+    SWIG_SystemError,	/* PDF_SystemError   10 */
+    SWIG_UnknownError,	/* PDF_NonfatalError 11 */ /* PDFlib-special */
+    SWIG_UnknownError,	/* PDF_UnknownError  12 */
+};
+
+/* SWIG exception handling is currently not thread-safe! */
+static jmp_buf		exception_buffer;
+static int		exception_status;
+static char		error_message[256];
+
+/* Exception handling for SWIG. Note that these are not used for the C API */
+#define try		if ((exception_status = setjmp(exception_buffer)) == 0)
+#define catch(error)	else if (exception_status == error)
+#define throw(error)	longjmp(exception_buffer, error)
+#define finally		else
+
+/* PDFlib error handler for the SWIG libraries */
+
+static void
+pdf_swig_errorhandler(PDF *p, int type, const char* shortmsg)
+{
+    sprintf(error_message, "PDFlib: %s\n", shortmsg);
+
+    /* Issue a warning message and continue for non-fatal errors */
+    if (type == PDF_NonfatalError) {
+	fprintf(stderr, error_message);
+	return;
+    }
+	
+    /* Clean up PDFlib internals and delete p in all other cases */
+    if (p != NULL)
+	PDF_delete(p);
+
+    /* ...and throw an exception */
+    throw(type);
+}
+
+/* Force the SWIG error handler for all clients */
+#define PDF_new() PDF_new2(pdf_swig_errorhandler, NULL, NULL, NULL, NULL)
+%}
+
+#ifdef SWIGJAVA
+%{
+/* Map PDFlib errors to Java exceptions */
+static const char *pdf_java_exceptions[] = {
+NULL,
+"java/lang/OutOfMemoryError",		/* PDF_MemoryError    1 */
+"java/io/IOException",			/* PDF_IOError        2 */
+"java/lang/IllegalArgumentException",	/* PDF_RuntimeError   3 */
+"java/lang/IndexOutOfBoundsException",	/* PDF_IndexError     4 */
+"java/lang/ClassCastException",		/* PDF_TypeError      5 */
+"java/lang/ArithmeticException",	/* PDF_DivisionByZero 6 */
+"java/lang/ArithmeticException",	/* PDF_OverflowError  7 */
+"java/lang/RuntimeException",		/* PDF_SyntaxError    8 */
+"java/lang/IllegalArgumentException",	/* PDF_ValueError     9 */
+"java/lang/InternalError",		/* PDF_SystemError   10 */
+"java/lang/UnknownError",		/* PDF_NonfatalError 11 */
+"java/lang/UnknownError",		/* PDF_UnknownError  12 */
+};
+
+/* This should come from SWIG but SWIG's experimental Java support
+ * currently doesn't cover exceptions.
+ */
+
+#define SWIG_exception(type, msg) (*jenv)->ThrowNew(jenv, \
+        (*jenv)->FindClass(jenv, pdf_java_exceptions[type]), msg);
+
+%}
+
+#endif	/* SWIGJAVA */
+
+/* This error handler which will be used for all languages.
+ * The construction is somewhat uglier than the usual try...catch...catch,
+ * but this will save us ca. 2000 (!) lines of code in the generated
+ * wrapper files since all wrapped functions will be affected by
+ * code bloat from the exception handling mechanism.
+ */
+%except {
+    try { $function }
+    else {
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}
+
+%{
+/* export the PDFlib routines to the shared library */
+#ifdef __MWERKS__
+#pragma export on
+#endif
+
+%}
+
+/* This #include will actually be carried out by SWIG. */
+%include "pdflib.h"
+
+#ifdef SWIGPYTHON
+/* PDF_stringwidths() is not visible to SWIG since it uses arrays */
+%{
+/* PDF_stringwidths(p, font, size, texts) takes a list or tuple of
+ * strings and returns a list of their widths, so that layout code needs
+ * only one call for many strings.
+ */
+static PyObject *_wrap_PDF_stringwidths(PyObject *self, PyObject *args) {
+    PyObject * _resultobj;
+    PyObject * _obj3;
+    PyObject * _item;
+    PDF * _arg0;
+    int  _arg1;
+    float  _arg2;
+    char * _argc0 = 0;
+    const char ** _texts;
+    float * _widths;
+    int  _n, _i;
+
+    self = self;
+    if(!PyArg_ParseTuple(args,"sifO:PDF_stringwidths",&_argc0,&_arg1,&_arg2,&_obj3)) 
+        return NULL;
+    if (_argc0) {
+        if (SWIG_GetPtr(_argc0,(void **) &_arg0,"_PDF_p")) {
+            PyErr_SetString(PyExc_TypeError,"Type error in argument 1 of PDF_stringwidths. Expected _PDF_p.");
+        return NULL;
+        }
+    }
+    if (!PyList_Check(_obj3) && !PyTuple_Check(_obj3)) {
+        PyErr_SetString(PyExc_TypeError,"Type error in argument 4 of PDF_stringwidths. Expected a list of strings.");
+        return NULL;
+    }
+    _n = PySequence_Length(_obj3);
+    _texts = (const char **) malloc((_n + 1) * sizeof(char *));
+    _widths = (float *) malloc((_n + 1) * sizeof(float));
+    if (_texts == NULL || _widths == NULL) {
+        free((void *) _texts);
+        free(_widths);
+        return PyErr_NoMemory();
+    }
+    /* the strings are kept alive by the list or tuple */
+    for (_i = 0; _i < _n; _i++) {
+        _item = PySequence_GetItem(_obj3,_i);
+        if (_item == NULL || !PyString_Check(_item)) {
+            Py_XDECREF(_item);
+            free((void *) _texts);
+            free(_widths);
+            PyErr_SetString(PyExc_TypeError,"Type error in argument 4 of PDF_stringwidths. Expected a list of strings.");
+            return NULL;
+        }
+        _texts[_i] = PyString_AsString(_item);
+        Py_DECREF(_item);
+    }
+{
+    try {     PDF_stringwidths(_arg0,_arg1,_arg2,_texts,_n,_widths);
+ }
+    else {
+	free((void *) _texts);
+	free(_widths);
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}    _resultobj = PyList_New(_n);
+    for (_i = 0; _resultobj != NULL && _i < _n; _i++)
+        PyList_SetItem(_resultobj,_i,PyFloat_FromDouble((double) _widths[_i]));
+    free((void *) _texts);
+    free(_widths);
+    return _resultobj;
+}
+%}
+
+%native(PDF_stringwidths) _wrap_PDF_stringwidths;
+
+/* PDF_show_many() is not visible to SWIG since it uses arrays */
+%{
+/* PDF_show_many(p, texts, x, y [, fonts]) takes lists or tuples of
+ * strings and coordinates, and optionally of font handles, and places
+ * all strings with one call.
+ */
+static int _pdf_py_list(PyObject *obj, int n) {
+    return (PyList_Check(obj) || PyTuple_Check(obj)) &&
+        (n < 0 || PySequence_Length(obj) == n);
+}
+
+static PyObject *_wrap_PDF_show_many(PyObject *self, PyObject *args) {
+    PyObject * _resultobj;
+    PyObject * _obj1, * _obj2, * _obj3, * _obj4 = 0;
+    PyObject * _item;
+    PDF * _arg0;
+    char * _argc0 = 0;
+    const char ** _texts;
+    float * _x, * _y;
+    int * _fonts = 0;
+    double  _d;
+    int  _n, _i;
+
+    self = self;
+    if(!PyArg_ParseTuple(args,"sOOO|O:PDF_show_many",&_argc0,&_obj1,&_obj2,&_obj3,&_obj4)) 
+        return NULL;
+    if (_argc0) {
+        if (SWIG_GetPtr(_argc0,(void **) &_arg0,"_PDF_p")) {
+            PyErr_SetString(PyExc_TypeError,"Type error in argument 1 of PDF_show_many. Expected _PDF_p.");
+        return NULL;
+        }
+    }
+    if (_obj4 == Py_None)
+        _obj4 = 0;
+    if (!_pdf_py_list(_obj1,-1)) {
+        PyErr_SetString(PyExc_TypeError,"Type error in argument 2 of PDF_show_many. Expected a list of strings.");
+        return NULL;
+    }
+    _n = PySequence_Length(_obj1);
+    if (!_pdf_py_list(_obj2,_n) || !_pdf_py_list(_obj3,_n) ||
+        (_obj4 && !_pdf_py_list(_obj4,_n))) {
+        PyErr_SetString(PyExc_TypeError,"Type error in PDF_show_many. Expected lists of equal length.");
+        return NULL;
+    }
+    _texts = (const char **) malloc((_n + 1) * sizeof(char *));
+    _x = (float *) malloc((_n + 1) * sizeof(float));
+    _y = (float *) malloc((_n + 1) * sizeof(float));
+    if (_obj4)
+        _fonts = (int *) malloc((_n + 1) * sizeof(int));
+    if (_texts == NULL || _x == NULL || _y == NULL || (_obj4 && _fonts == NULL)) {
+        free((void *) _texts); free(_x); free(_y); free(_fonts);
+        return PyErr_NoMemory();
+    }
+    /* the strings are kept alive by the list or tuple */
+    for (_i = 0; _i < _n; _i++) {
+        _item = PySequence_GetItem(_obj1,_i);
+        if (_item == NULL || !PyString_Check(_item)) {
+            Py_XDECREF(_item);
+            PyErr_SetString(PyExc_TypeError,"Type error in argument 2 of PDF_show_many. Expected a list of strings.");
+            break;
+        }
+        _texts[_i] = PyString_AsString(_item);
+        Py_DECREF(_item);
+        _item = PySequence_GetItem(_obj2,_i);
+        _d = _item ? PyFloat_AsDouble(_item) : -1;
+        Py_XDECREF(_item);
+        _x[_i] = (float) _d;
+        _item = PySequence_GetItem(_obj3,_i);
+        _d = _item ? PyFloat_AsDouble(_item) : -1;
+        Py_XDECREF(_item);
+        _y[_i] = (float) _d;
+        if (_fonts) {
+            _item = PySequence_GetItem(_obj4,_i);
+            _fonts[_i] = _item ? (int) PyInt_AsLong(_item) : -1;
+            Py_XDECREF(_item);
+        }
+        if (PyErr_Occurred())
+            break;
+    }
+    if (_i < _n) {
+        free((void *) _texts); free(_x); free(_y); free(_fonts);
+        return NULL;
+    }
+{
+    try {     PDF_show_many(_arg0,_texts,_x,_y,_fonts,_n);
+ }
+    else {
+	free((void *) _texts); free(_x); free(_y); free(_fonts);
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}    free((void *) _texts); free(_x); free(_y); free(_fonts);
+    Py_INCREF(Py_None);
+    _resultobj = Py_None;
+    return _resultobj;
+}
+%}
+
+%native(PDF_show_many) _wrap_PDF_show_many;
+
+/* PDF_polyline(), PDF_polygon() and PDF_rects() are not visible to SWIG
+ * since they use arrays
+ */
+%{
+/* PDF_polyline(p, xy), PDF_polygon(p, xy) and PDF_rects(p, xywh) take a
+ * flat list or tuple of coordinates, so that a whole path needs only
+ * one call.
+ */
+static PyObject *_pdf_py_path(PyObject *args, const char *fmt, const char *name, int dim, void (*fn)(PDF *, const float *, int)) {
+    PyObject * _resultobj;
+    PyObject * _obj1;
+    PyObject * _item;
+    PDF * _arg0;
+    char * _argc0 = 0;
+    float * _v;
+    int  _n, _i;
+
+    if(!PyArg_ParseTuple(args,(char *) fmt,&_argc0,&_obj1)) 
+        return NULL;
+    if (_argc0) {
+        if (SWIG_GetPtr(_argc0,(void **) &_arg0,"_PDF_p")) {
+            PyErr_Format(PyExc_TypeError,"Type error in argument 1 of %s. Expected _PDF_p.",name);
+        return NULL;
+        }
+    }
+    if (!_pdf_py_list(_obj1,-1) || PySequence_Length(_obj1) % dim != 0) {
+        PyErr_Format(PyExc_TypeError,"Type error in argument 2 of %s. Expected a list of numbers whose length is a multiple of %d.",name,dim);
+        return NULL;
+    }
+    _n = PySequence_Length(_obj1);
+    _v = (float *) malloc((_n + 1) * sizeof(float));
+    if (_v == NULL)
+        return PyErr_NoMemory();
+    for (_i = 0; _i < _n; _i++) {
+        _item = PySequence_GetItem(_obj1,_i);
+        _v[_i] = (float) (_item ? PyFloat_AsDouble(_item) : -1);
+        Py_XDECREF(_item);
+        if (PyErr_Occurred()) {
+            free(_v);
+            return NULL;
+        }
+    }
+{
+    try {     (*fn)(_arg0,_v,_n / dim);
+ }
+    else {
+	free(_v);
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}    free(_v);
+    Py_INCREF(Py_None);
+    _resultobj = Py_None;
+    return _resultobj;
+}
+
+static PyObject *_wrap_PDF_polyline(PyObject *self, PyObject *args) {
+    self = self;
+    return _pdf_py_path(args,"sO:PDF_polyline","PDF_polyline",2,PDF_polyline);
+}
+
+static PyObject *_wrap_PDF_polygon(PyObject *self, PyObject *args) {
+    self = self;
+    return _pdf_py_path(args,"sO:PDF_polygon","PDF_polygon",2,PDF_polygon);
+}
+
+static PyObject *_wrap_PDF_rects(PyObject *self, PyObject *args) {
+    self = self;
+    return _pdf_py_path(args,"sO:PDF_rects","PDF_rects",4,PDF_rects);
+}
+%}
+
+%native(PDF_polyline) _wrap_PDF_polyline;
+%native(PDF_polygon) _wrap_PDF_polygon;
+%native(PDF_rects) _wrap_PDF_rects;
+#endif /* SWIGPYTHON */
+
+#ifdef SWIGTCL
+/* PDF_show_many() is not visible to SWIG since it uses arrays */
+%{
+/* PDF_show_many p texts xs ys ?fonts? takes lists of strings and
+ * coordinates, and optionally of font handles, and places all strings
+ * with one call.
+ */
+#ifndef CONST84
+#define CONST84
+#endif
+static int _wrap_PDF_show_many(ClientData clientData, Tcl_Interp *interp, int argc, char *argv[]) {
+
+    PDF * _arg0;
+    CONST84 char ** _texts = 0, ** _xs = 0, ** _ys = 0, ** _fs = 0;
+    float * _x = 0, * _y = 0;
+    int * _fonts = 0;
+    double  _d;
+    int  _n, _nx, _ny, _nf = 0, _i, _result = TCL_ERROR;
+
+    clientData = clientData; argv = argv;
+    if ((argc < 5) || (argc > 6)) {
+        Tcl_SetResult(interp, "Wrong # args. PDF_show_many p texts xs ys ?fonts? ",TCL_STATIC);
+        return TCL_ERROR;
+    }
+    if (SWIG_GetPtr(argv[1],(void **) &_arg0,"_PDF_p")) {
+        Tcl_SetResult(interp, "Type error in argument 1 of PDF_show_many. Expected _PDF_p, received ", TCL_STATIC);
+        Tcl_AppendResult(interp, argv[1], (char *) NULL);
+        return TCL_ERROR;
+    }
+    if (Tcl_SplitList(interp, argv[2], &_n, &_texts) != TCL_OK ||
+        Tcl_SplitList(interp, argv[3], &_nx, &_xs) != TCL_OK ||
+        Tcl_SplitList(interp, argv[4], &_ny, &_ys) != TCL_OK ||
+        (argc == 6 && Tcl_SplitList(interp, argv[5], &_nf, &_fs) != TCL_OK))
+        goto done;
+    if (_nx != _n || _ny != _n || (_fs && _nf != _n)) {
+        Tcl_SetResult(interp, "Lists of different length in PDF_show_many", TCL_STATIC);
+        goto done;
+    }
+    _x = (float *) malloc((_n + 1) * sizeof(float));
+    _y = (float *) malloc((_n + 1) * sizeof(float));
+    if (_fs)
+        _fonts = (int *) malloc((_n + 1) * sizeof(int));
+    if (_x == NULL || _y == NULL || (_fs && _fonts == NULL)) {
+        Tcl_SetResult(interp, "Out of memory in PDF_show_many", TCL_STATIC);
+        goto done;
+    }
+    for (_i = 0; _i < _n; _i++) {
+        if (Tcl_GetDouble(interp, _xs[_i], &_d) != TCL_OK)
+            goto done;
+        _x[_i] = (float) _d;
+        if (Tcl_GetDouble(interp, _ys[_i], &_d) != TCL_OK)
+            goto done;
+        _y[_i] = (float) _d;
+        if (_fonts && Tcl_GetInt(interp, _fs[_i], &_fonts[_i]) != TCL_OK)
+            goto done;
+    }
+{
+    try {     PDF_show_many(_arg0,(const char **) _texts,_x,_y,_fonts,_n);
+ }
+    else {
+	Tcl_SetResult(interp,error_message,TCL_VOLATILE);
+	goto done;
+    }
+}    _result = TCL_OK;
+done:
+    if (_texts) Tcl_Free((char *) _texts);
+    if (_xs) Tcl_Free((char *) _xs);
+    if (_ys) Tcl_Free((char *) _ys);
+    if (_fs) Tcl_Free((char *) _fs);
+    free(_x); free(_y); free(_fonts);
+    return _result;
+}
+%}
+
+%native(PDF_show_many) _wrap_PDF_show_many;
+
+/* PDF_polyline(), PDF_polygon() and PDF_rects() are not visible to SWIG
+ * since they use arrays
+ */
+%{
+/* PDF_polyline p xy, PDF_polygon p xy and PDF_rects p xywh take a flat
+ * list of coordinates, so that a whole path needs only one command.
+ */
+static int _pdf_tcl_path(Tcl_Interp *interp, int argc, char *argv[], const char *name, int dim, void (*fn)(PDF *, const float *, int)) {
+
+    PDF * _arg0;
+    CONST84 char ** _vs = 0;
+    float * _v = 0;
+    double  _d;
+    int  _n, _i, _result = TCL_ERROR;
+
+    if (argc != 3) {
+        Tcl_AppendResult(interp, "Wrong # args. ", name, " p coords ", (char *) NULL);
+        return TCL_ERROR;
+    }
+    if (SWIG_GetPtr(argv[1],(void **) &_arg0,"_PDF_p")) {
+        Tcl_AppendResult(interp, "Type error in argument 1 of ", name, ". Expected _PDF_p, received ", argv[1], (char *) NULL);
+        return TCL_ERROR;
+    }
+    if (Tcl_SplitList(interp, argv[2], &_n, &_vs) != TCL_OK)
+        goto done;
+    if (_n % dim != 0) {
+        Tcl_AppendResult(interp, "Bad number of coordinates in ", name, (char *) NULL);
+        goto done;
+    }
+    _v = (float *) malloc((_n + 1) * sizeof(float));
+    if (_v == NULL) {
+        Tcl_AppendResult(interp, "Out of memory in ", name, (char *) NULL);
+        goto done;
+    }
+    for (_i = 0; _i < _n; _i++) {
+        if (Tcl_GetDouble(interp, _vs[_i], &_d) != TCL_OK)
+            goto done;
+        _v[_i] = (float) _d;
+    }
+{
+    try {     (*fn)(_arg0,_v,_n / dim);
+ }
+    else {
+	Tcl_SetResult(interp,error_message,TCL_VOLATILE);
+	goto done;
+    }
+}    _result = TCL_OK;
+done:
+    if (_vs) Tcl_Free((char *) _vs);
+    free(_v);
+    return _result;
+}
+
+static int _wrap_PDF_polyline(ClientData clientData, Tcl_Interp *interp, int argc, char *argv[]) {
+    clientData = clientData;
+    return _pdf_tcl_path(interp, argc, argv, "PDF_polyline", 2, PDF_polyline);
+}
+
+static int _wrap_PDF_polygon(ClientData clientData, Tcl_Interp *interp, int argc, char *argv[]) {
+    clientData = clientData;
+    return _pdf_tcl_path(interp, argc, argv, "PDF_polygon", 2, PDF_polygon);
+}
+
+static int _wrap_PDF_rects(ClientData clientData, Tcl_Interp *interp, int argc, char *argv[]) {
+    clientData = clientData;
+    return _pdf_tcl_path(interp, argc, argv, "PDF_rects", 4, PDF_rects);
+}
+%}
+
+%native(PDF_polyline) _wrap_PDF_polyline;
+%native(PDF_polygon) _wrap_PDF_polygon;
+%native(PDF_rects) _wrap_PDF_rects;
+#endif /* SWIGTCL */
+
+#ifdef SWIGPERL
+/* PDF_show_many() is not visible to SWIG since it uses arrays */
+%{
+/* PDF_show_many(p, \@texts, \@x, \@y [, \@fonts]) takes references to
+ * arrays of strings and coordinates, and optionally of font handles, and
+ * places all strings with one call.
+ */
+XS(_wrap_PDF_show_many) {
+
+    PDF * _arg0;
+    AV * _av[4];
+    SV ** _sv;
+    const char ** _texts;
+    float * _x, * _y;
+    int * _fonts = 0;
+    int  _n, _i, _j;
+    dXSARGS ;
+
+    cv = cv;
+    if ((items < 4) || (items > 5)) 
+        croak("Usage: PDF_show_many(p,texts,x,y[,fonts]);");
+    if (SWIG_GetPtr(ST(0),(void **) &_arg0,"PDFPtr")) {
+        croak("Type error in argument 1 of PDF_show_many. Expected PDFPtr.");
+        XSRETURN(1);
+    }
+    for (_j = 0; _j < 4; _j++) {
+        _av[_j] = 0;
+        if (_j == 3 && (items < 5 || !SvOK(ST(4))))
+            continue;			/* no fonts */
+        if (!SvROK(ST(_j + 1)) || SvTYPE(SvRV(ST(_j + 1))) != SVt_PVAV)
+            croak("Type error in argument %d of PDF_show_many. Expected an array reference.", _j + 2);
+        _av[_j] = (AV *) SvRV(ST(_j + 1));
+    }
+    _n = av_len(_av[0]) + 1;
+    for (_j = 1; _j < 4; _j++)
+        if (_av[_j] && av_len(_av[_j]) + 1 != _n)
+            croak("Arrays of different length in PDF_show_many.");
+    _texts = (const char **) malloc((_n + 1) * sizeof(char *));
+    _x = (float *) malloc((_n + 1) * sizeof(float));
+    _y = (float *) malloc((_n + 1) * sizeof(float));
+    if (_av[3])
+        _fonts = (int *) malloc((_n + 1) * sizeof(int));
+    if (_texts == NULL || _x == NULL || _y == NULL || (_av[3] && _fonts == NULL)) {
+        free((void *) _texts); free(_x); free(_y); free(_fonts);
+        croak("Out of memory in PDF_show_many.");
+    }
+    /* the strings are kept alive by the arrays */
+    for (_i = 0; _i < _n; _i++) {
+        _sv = av_fetch(_av[0], _i, 0);
+        _texts[_i] = _sv ? (char *) SvPV(*_sv,na) : "";
+        _sv = av_fetch(_av[1], _i, 0);
+        _x[_i] = _sv ? (float) SvNV(*_sv) : (float) 0;
+        _sv = av_fetch(_av[2], _i, 0);
+        _y[_i] = _sv ? (float) SvNV(*_sv) : (float) 0;
+        if (_fonts) {
+            _sv = av_fetch(_av[3], _i, 0);
+            _fonts[_i] = _sv ? (int) SvIV(*_sv) : -1;
+        }
+    }
+{
+    try {     PDF_show_many(_arg0,_texts,_x,_y,_fonts,_n);
+ }
+    else {
+	free((void *) _texts); free(_x); free(_y); free(_fonts);
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}    free((void *) _texts); free(_x); free(_y); free(_fonts);
+    XSRETURN(0);
+}
+%}
+
+%native(PDF_show_many) _wrap_PDF_show_many;
+
+/* PDF_polyline(), PDF_polygon() and PDF_rects() are not visible to SWIG
+ * since they use arrays
+ */
+%{
+/* PDF_polyline(p, \@xy), PDF_polygon(p, \@xy) and PDF_rects(p, \@xywh)
+ * take a reference to a flat array of coordinates, so that a whole path
+ * needs only one call.
+ */
+static void _pdf_pl_path(SV *sv0, SV *sv1, const char *name, int dim, void (*fn)(PDF *, const float *, int)) {
+
+    PDF * _arg0;
+    AV * _av;
+    SV ** _sv;
+    float * _v;
+    int  _n, _i;
+
+    if (SWIG_GetPtr(sv0,(void **) &_arg0,"PDFPtr"))
+        croak("Type error in argument 1 of %s. Expected PDFPtr.", name);
+    if (!SvROK(sv1) || SvTYPE(SvRV(sv1)) != SVt_PVAV)
+        croak("Type error in argument 2 of %s. Expected an array reference.", name);
+    _av = (AV *) SvRV(sv1);
+    _n = av_len(_av) + 1;
+    if (_n % dim != 0)
+        croak("Bad number of coordinates in %s.", name);
+    _v = (float *) malloc((_n + 1) * sizeof(float));
+    if (_v == NULL)
+        croak("Out of memory in %s.", name);
+    for (_i = 0; _i < _n; _i++) {
+        _sv = av_fetch(_av, _i, 0);
+        _v[_i] = _sv ? (float) SvNV(*_sv) : (float) 0;
+    }
+{
+    try {     (*fn)(_arg0,_v,_n / dim);
+ }
+    else {
+	free(_v);
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}    free(_v);
+}
+
+XS(_wrap_PDF_polyline) {
+    dXSARGS ;
+
+    cv = cv;
+    if (items != 2) 
+        croak("Usage: PDF_polyline(p,xy);");
+    _pdf_pl_path(ST(0), ST(1), "PDF_polyline", 2, PDF_polyline);
+    XSRETURN(0);
+}
+
+XS(_wrap_PDF_polygon) {
+    dXSARGS ;
+
+    cv = cv;
+    if (items != 2) 
+        croak("Usage: PDF_polygon(p,xy);");
+    _pdf_pl_path(ST(0), ST(1), "PDF_polygon", 2, PDF_polygon);
+    XSRETURN(0);
+}
+
+XS(_wrap_PDF_rects) {
+    dXSARGS ;
+
+    cv = cv;
+    if (items != 2) 
+        croak("Usage: PDF_rects(p,xywh);");
+    _pdf_pl_path(ST(0), ST(1), "PDF_rects", 4, PDF_rects);
+    XSRETURN(0);
+}
+%}
+
+%native(PDF_polyline) _wrap_PDF_polyline;
+%native(PDF_polygon) _wrap_PDF_polygon;
+%native(PDF_rects) _wrap_PDF_rects;
+#endif /* SWIGPERL */
+
+#ifdef SWIGJAVA
+/* PDF_show_many(), PDF_polyline(), PDF_polygon() and PDF_rects() are not
+ * visible to SWIG since they use arrays; the native methods are declared
+ * in the module pragma above.
+ */
+%{
+#include <string.h>
+
+/* PDF_show_many(p, texts, x, y, fonts) takes arrays of strings and
+ * coordinates, and optionally (null otherwise) of font handles, and
+ * places all strings with one call.
+ */
+JNIEXPORT void JNICALL Java_pdflib_PDF_1show_1many(JNIEnv *jenv, jclass jcls, jlong jarg0, jobjectArray jarg1, jfloatArray jarg2, jfloatArray jarg3, jintArray jarg4) {
+    PDF * _arg0;
+    char ** _texts;
+    float * _x, * _y;
+    int * _fonts = 0;
+    jfloat * _jf;
+    jint * _ji;
+    jstring _js;
+    const char * _utf;
+    jsize _n, _i;
+
+    _arg0 = *(PDF **)&jarg0;
+    _n = jarg1 ? (*jenv)->GetArrayLength(jenv, jarg1) : 0;
+    if (jarg1 == NULL || jarg2 == NULL || jarg3 == NULL ||
+        (*jenv)->GetArrayLength(jenv, jarg2) != _n ||
+        (*jenv)->GetArrayLength(jenv, jarg3) != _n ||
+        (jarg4 && (*jenv)->GetArrayLength(jenv, jarg4) != _n)) {
+        SWIG_exception(PDF_ValueError, "Arrays of different length in PDF_show_many");
+        return;
+    }
+    _texts = (char **) calloc(_n + 1, sizeof(char *));
+    _x = (float *) malloc((_n + 1) * sizeof(float));
+    _y = (float *) malloc((_n + 1) * sizeof(float));
+    if (jarg4)
+        _fonts = (int *) malloc((_n + 1) * sizeof(int));
+
+    /* copy the strings so that we need only one local reference at a time */
+    for (_i = 0; _texts && _i < _n; _i++) {
+        _js = (jstring) (*jenv)->GetObjectArrayElement(jenv, jarg1, _i);
+        _utf = _js ? (*jenv)->GetStringUTFChars(jenv, _js, 0) : NULL;
+        _texts[_i] = (char *) malloc(_utf ? strlen(_utf) + 1 : 1);
+        if (_texts[_i])
+            strcpy(_texts[_i], _utf ? _utf : "");
+        if (_utf)
+            (*jenv)->ReleaseStringUTFChars(jenv, _js, _utf);
+        if (_js)
+            (*jenv)->DeleteLocalRef(jenv, _js);
+    }
+    if (_x && _y && (!jarg4 || _fonts)) {
+        _jf = (*jenv)->GetFloatArrayElements(jenv, jarg2, 0);
+        for (_i = 0; _i < _n; _i++)
+            _x[_i] = (float) _jf[_i];
+        (*jenv)->ReleaseFloatArrayElements(jenv, jarg2, _jf, JNI_ABORT);
+        _jf = (*jenv)->GetFloatArrayElements(jenv, jarg3, 0);
+        for (_i = 0; _i < _n; _i++)
+            _y[_i] = (float) _jf[_i];
+        (*jenv)->ReleaseFloatArrayElements(jenv, jarg3, _jf, JNI_ABORT);
+        if (jarg4) {
+            _ji = (*jenv)->GetIntArrayElements(jenv, jarg4, 0);
+            for (_i = 0; _i < _n; _i++)
+                _fonts[_i] = (int) _ji[_i];
+            (*jenv)->ReleaseIntArrayElements(jenv, jarg4, _ji, JNI_ABORT);
+        }
+    }
+    for (_i = 0; _texts && _i < _n && _texts[_i]; _i++)
+        /* */ ;
+    if (_texts == NULL || _i < _n || _x == NULL || _y == NULL || (jarg4 && _fonts == NULL)) {
+        SWIG_exception(PDF_MemoryError, "Out of memory in PDF_show_many");
+    } else {
+{
+    try {     PDF_show_many(_arg0,(const char **) _texts,_x,_y,_fonts,_n);
+ }
+    else {
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}
+    }
+    for (_i = 0; _texts && _i < _n; _i++)
+        free(_texts[_i]);
+    free(_texts); free(_x); free(_y); free(_fonts);
+}
+%}
+
+%{
+/* PDF_polyline(p, xy), PDF_polygon(p, xy) and PDF_rects(p, xywh) take
+ * a flat array of coordinates, which is handed to PDFlib without
+ * copying where the VM permits.
+ */
+static void _pdf_java_path(JNIEnv *jenv, jlong jarg0, jfloatArray jarg1, const char *name, int dim, void (*fn)(PDF *, const float *, int)) {
+    PDF * _arg0;
+    jfloat * _jf;
+    jsize _n;
+    char _msg[64];
+
+    _arg0 = *(PDF **)&jarg0;
+    _n = jarg1 ? (*jenv)->GetArrayLength(jenv, jarg1) : 0;
+    if (jarg1 == NULL || _n % dim != 0) {
+        sprintf(_msg, "Bad number of coordinates in %s", name);
+        SWIG_exception(PDF_ValueError, _msg);
+        return;
+    }
+    _jf = (*jenv)->GetFloatArrayElements(jenv, jarg1, 0);
+    if (_jf == NULL)
+        return;		/* OutOfMemoryError already thrown */
+{
+    try {     (*fn)(_arg0,(const float *) _jf,(int) (_n / dim));
+ }
+    else {
+	SWIG_exception(pdf_swig_exceptions[exception_status], error_message);
+    }
+}
+    (*jenv)->ReleaseFloatArrayElements(jenv, jarg1, _jf, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL Java_pdflib_PDF_1polyline(JNIEnv *jenv, jclass jcls, jlong jarg0, jfloatArray jarg1) {
+    _pdf_java_path(jenv, jarg0, jarg1, "PDF_polyline", 2, PDF_polyline);
+}
+
+JNIEXPORT void JNICALL Java_pdflib_PDF_1polygon(JNIEnv *jenv, jclass jcls, jlong jarg0, jfloatArray jarg1) {
+    _pdf_java_path(jenv, jarg0, jarg1, "PDF_polygon", 2, PDF_polygon);
+}
+
+JNIEXPORT void JNICALL Java_pdflib_PDF_1rects(JNIEnv *jenv, jclass jcls, jlong jarg0, jfloatArray jarg1) {
+    _pdf_java_path(jenv, jarg0, jarg1, "PDF_rects", 4, PDF_rects);
+}
+%}
+#endif /* SWIGJAVA */
+
+#ifdef SWIGPERL
+%echo %{
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+Don't forget to change the following line in pdflib_pl.c:
+    SWIGEXPORT(void,boot_pdflib)(CPerl *, CV *cv);
+to:
+    SWIGEXPORT(void,boot_pdflib)(CV *cv, CPerlObj *pPerl);
+This is only necessary for using PDFlib with ActivePerl on Win32.
+!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+%}
+#endif /* SWIGPERL */
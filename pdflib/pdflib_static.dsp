@@ -1,189 +1,197 @@
-# Microsoft Developer Studio Project File - Name="pdflib_static" - Package Owner=<4>
-# Microsoft Developer Studio Generated Build File, Format Version 6.00
-# ** DO NOT EDIT **
-
-# TARGTYPE "Win32 (x86) Static Library" 0x0104
-
-CFG=pdflib_static - Win32 Debug
-!MESSAGE This is not a valid makefile. To build this project using NMAKE,
-!MESSAGE use the Export Makefile command and run
-!MESSAGE 
-!MESSAGE NMAKE /f "pdflib_static.mak".
-!MESSAGE 
-!MESSAGE You can specify a configuration when running NMAKE
-!MESSAGE by defining the macro CFG on the command line. For example:
-!MESSAGE 
-!MESSAGE NMAKE /f "pdflib_static.mak" CFG="pdflib_static - Win32 Debug"
-!MESSAGE 
-!MESSAGE Possible choices for configuration are:
-!MESSAGE 
-!MESSAGE "pdflib_static - Win32 Release" (based on "Win32 (x86) Static Library")
-!MESSAGE "pdflib_static - Win32 Debug" (based on "Win32 (x86) Static Library")
-!MESSAGE 
-
-# Begin Project
-# PROP AllowPerConfigDependencies 0
-# PROP Scc_ProjName ""
-# PROP Scc_LocalPath ""
-CPP=cl.exe
-RSC=rc.exe
-
-!IF  "$(CFG)" == "pdflib_static - Win32 Release"
-
-# PROP BASE Use_MFC 0
-# PROP BASE Use_Debug_Libraries 0
-# PROP BASE Output_Dir "Release"
-# PROP BASE Intermediate_Dir "Release"
-# PROP BASE Target_Dir ""
-# PROP Use_MFC 0
-# PROP Use_Debug_Libraries 0
-# PROP Output_Dir "static___Release"
-# PROP Intermediate_Dir "static___Release"
-# PROP Target_Dir ""
-# ADD BASE CPP /nologo /W3 /GX /O2 /D "WIN32" /D "NDEBUG" /D "_MBCS" /D "_LIB" /YX /FD /c
-# ADD CPP /nologo /MT /W3 /GX /D "WIN32" /D "NDEBUG" /D "_MBCS" /D "_LIB" /D "PDFLIB_STATIC" /YX /FD /c
-# SUBTRACT CPP /O<none>
-# ADD BASE RSC /l 0x407 /d "NDEBUG"
-# ADD RSC /l 0x407 /d "NDEBUG"
-BSC32=bscmake.exe
-# ADD BASE BSC32 /nologo
-# ADD BSC32 /nologo
-LIB32=link.exe -lib
-# ADD BASE LIB32 /nologo
-# ADD LIB32 /nologo /out:"pdflib_static.lib"
-
-!ELSEIF  "$(CFG)" == "pdflib_static - Win32 Debug"
-
-# PROP BASE Use_MFC 0
-# PROP BASE Use_Debug_Libraries 1
-# PROP BASE Output_Dir "pdflib_static___Win32_Debug"
-# PROP BASE Intermediate_Dir "pdflib_static___Win32_Debug"
-# PROP BASE Target_Dir ""
-# PROP Use_MFC 0
-# PROP Use_Debug_Libraries 1
-# PROP Output_Dir ""
-# PROP Intermediate_Dir "static___Debug"
-# PROP Target_Dir ""
-# ADD BASE CPP /nologo /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_MBCS" /D "_LIB" /YX /FD /GZ /c
-# ADD CPP /nologo /MTd /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_MBCS" /D "_LIB" /D "PDFLIB_STATIC" /YX /FD /GZ /c
-# ADD BASE RSC /l 0x407 /d "_DEBUG"
-# ADD RSC /l 0x407 /d "_DEBUG"
-BSC32=bscmake.exe
-# ADD BASE BSC32 /nologo
-# ADD BSC32 /nologo
-LIB32=link.exe -lib
-# ADD BASE LIB32 /nologo
-# ADD LIB32 /nologo
-
-!ENDIF 
-
-# Begin Target
-
-# Name "pdflib_static - Win32 Release"
-# Name "pdflib_static - Win32 Debug"
-# Begin Group "Source Files"
-
-# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
-# Begin Source File
-
-SOURCE=.\p_afmparse.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_annots.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_basic.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_ccitt.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_color.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_draw.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_filter.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_font.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_gif.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_gstate.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_hyper.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_image.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_jpeg.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_text.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_tiff.c
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_util.c
-# End Source File
-# End Group
-# Begin Group "Header Files"
-
-# PROP Default_Filter "h;hpp;hxx;hm;inl"
-# Begin Source File
-
-SOURCE=.\ansi_e.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\macrom_e.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_afmparse.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_config.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_intern.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\p_metrics.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\pdfdoc_e.h
-# End Source File
-# Begin Source File
-
-SOURCE=.\pdflib.h
-# End Source File
-# End Group
-# End Target
-# End Project
+# Microsoft Developer Studio Project File - Name="pdflib_static" - Package Owner=<4>
+# Microsoft Developer Studio Generated Build File, Format Version 6.00
+# ** DO NOT EDIT **
+
+# TARGTYPE "Win32 (x86) Static Library" 0x0104
+
+CFG=pdflib_static - Win32 Debug
+!MESSAGE This is not a valid makefile. To build this project using NMAKE,
+!MESSAGE use the Export Makefile command and run
+!MESSAGE 
+!MESSAGE NMAKE /f "pdflib_static.mak".
+!MESSAGE 
+!MESSAGE You can specify a configuration when running NMAKE
+!MESSAGE by defining the macro CFG on the command line. For example:
+!MESSAGE 
+!MESSAGE NMAKE /f "pdflib_static.mak" CFG="pdflib_static - Win32 Debug"
+!MESSAGE 
+!MESSAGE Possible choices for configuration are:
+!MESSAGE 
+!MESSAGE "pdflib_static - Win32 Release" (based on "Win32 (x86) Static Library")
+!MESSAGE "pdflib_static - Win32 Debug" (based on "Win32 (x86) Static Library")
+!MESSAGE 
+
+# Begin Project
+# PROP AllowPerConfigDependencies 0
+# PROP Scc_ProjName ""
+# PROP Scc_LocalPath ""
+CPP=cl.exe
+RSC=rc.exe
+
+!IF  "$(CFG)" == "pdflib_static - Win32 Release"
+
+# PROP BASE Use_MFC 0
+# PROP BASE Use_Debug_Libraries 0
+# PROP BASE Output_Dir "Release"
+# PROP BASE Intermediate_Dir "Release"
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 0
+# PROP Use_Debug_Libraries 0
+# PROP Output_Dir "static___Release"
+# PROP Intermediate_Dir "static___Release"
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /W3 /GX /O2 /D "WIN32" /D "NDEBUG" /D "_MBCS" /D "_LIB" /YX /FD /c
+# ADD CPP /nologo /MT /W3 /GX /D "WIN32" /D "NDEBUG" /D "_MBCS" /D "_LIB" /D "PDFLIB_STATIC" /YX /FD /c
+# SUBTRACT CPP /O<none>
+# ADD BASE RSC /l 0x407 /d "NDEBUG"
+# ADD RSC /l 0x407 /d "NDEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LIB32=link.exe -lib
+# ADD BASE LIB32 /nologo
+# ADD LIB32 /nologo /out:"pdflib_static.lib"
+
+!ELSEIF  "$(CFG)" == "pdflib_static - Win32 Debug"
+
+# PROP BASE Use_MFC 0
+# PROP BASE Use_Debug_Libraries 1
+# PROP BASE Output_Dir "pdflib_static___Win32_Debug"
+# PROP BASE Intermediate_Dir "pdflib_static___Win32_Debug"
+# PROP BASE Target_Dir ""
+# PROP Use_MFC 0
+# PROP Use_Debug_Libraries 1
+# PROP Output_Dir ""
+# PROP Intermediate_Dir "static___Debug"
+# PROP Target_Dir ""
+# ADD BASE CPP /nologo /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_MBCS" /D "_LIB" /YX /FD /GZ /c
+# ADD CPP /nologo /MTd /W3 /Gm /GX /ZI /Od /D "WIN32" /D "_DEBUG" /D "_MBCS" /D "_LIB" /D "PDFLIB_STATIC" /YX /FD /GZ /c
+# ADD BASE RSC /l 0x407 /d "_DEBUG"
+# ADD RSC /l 0x407 /d "_DEBUG"
+BSC32=bscmake.exe
+# ADD BASE BSC32 /nologo
+# ADD BSC32 /nologo
+LIB32=link.exe -lib
+# ADD BASE LIB32 /nologo
+# ADD LIB32 /nologo
+
+!ENDIF 
+
+# Begin Target
+
+# Name "pdflib_static - Win32 Release"
+# Name "pdflib_static - Win32 Debug"
+# Begin Group "Source Files"
+
+# PROP Default_Filter "cpp;c;cxx;rc;def;r;odl;idl;hpj;bat"
+# Begin Source File
+
+SOURCE=.\p_afmparse.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_annots.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_basic.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_ccitt.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_color.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_draw.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_filter.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_font.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_fontpack.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_gif.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_gstate.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_hyper.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_image.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_jpeg.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_stream.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_text.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_tiff.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_util.c
+# End Source File
+# End Group
+# Begin Group "Header Files"
+
+# PROP Default_Filter "h;hpp;hxx;hm;inl"
+# Begin Source File
+
+SOURCE=.\ansi_e.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\macrom_e.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_afmparse.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_config.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_intern.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\p_metrics.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\pdfdoc_e.h
+# End Source File
+# Begin Source File
+
+SOURCE=.\pdflib.h
+# End Source File
+# End Group
+# End Target
+# End Project
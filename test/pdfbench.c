@@ -0,0 +1,1099 @@
+/*---------------------------------------------------------------------------*
+ |        PDFlib - A library for dynamically generating PDF files            |
+ +---------------------------------------------------------------------------+
+ |        Copyright (c) 1997-1999 Thomas Merz. All rights reserved.          |
+ +---------------------------------------------------------------------------+
+ |    This software is not in the public domain.  It is subject to the       |
+ |    "Aladdin Free Public License".  See the file license.txt for details.  |
+ |    This license grants you the right to use and redistribute PDFlib       |
+ |    under certain conditions. Among other things, the license requires     |
+ |    that the copyright notice and this notice be preserved on all copies.  |
+ |    This requirement extends to ports to other programming languages.      |
+ |                                                                           |
+ |    In short, you are allowed to develop and use PDFlib-based software     |
+ |    as long as you don't sell it. Commercial use of PDFlib requires a      |
+ |    commercial license which can be obtained from the author of PDFlib.    |
+ |    Contact information can be found in the accompanying PDFlib manual.    |
+ |    PDFlib is distributed with no warranty of any kind. Commercial users,  |
+ |    however, will receive warranty and support statements in writing.      |
+ *---------------------------------------------------------------------------*/
+
+/* pdfbench.c
+ *
+ * Micro benchmarks for PDFlib. Output goes to a write procedure which
+ * discards the data, so only the time spent in PDFlib is measured.
+ *
+ * usage: pdfbench [iterations]
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <math.h>
+
+#include "pdflib.h"
+
+#ifdef HAVE_LIBTIFF
+#include <tiffio.h>
+#endif
+
+#define DEFAULT_ITERATIONS	1000000L
+
+static long iterations = DEFAULT_ITERATIONS;
+static long discarded;			/* bytes written by all benchmarks */
+
+static size_t
+discard(PDF *p, void *data, size_t size)
+{
+    (void) p;
+    (void) data;
+    discarded += (long) size;
+    return size;
+}
+
+static PDF *
+bench_open(void)
+{
+    PDF *p = PDF_new();
+
+    PDF_open_mem(p, discard);
+    PDF_set_parameter(p, "compress", "0");	/* measure PDFlib alone */
+    return p;
+}
+
+static void
+bench_close(PDF *p)
+{
+    PDF_close(p);
+    PDF_delete(p);
+}
+
+static void
+report(const char *name, long count, clock_t start)
+{
+    double secs = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%-32s %10ld ops %8.3f s %10.1f ns/op\n",
+	name, count, secs, count ? 1e9 * secs / count : 0.0);
+}
+
+/* Pseudo-random coordinates with a realistic mix of magnitudes */
+static float
+coord(long i)
+{
+    return (float) ((i * 7919L) % 59500L) / (float) 100.0;
+}
+
+/* ------------------------------------------------------------- */
+/* Number formatting: the way pdf_float() used to do it, for comparison */
+static void
+number_formatting(void)
+{
+    char	buf1[32], buf2[32], line[80];
+    clock_t	start;
+    float	x, y;
+    long	i;
+    PDF		*p;
+
+    start = clock();
+    for (i = 0; i < iterations; i++) {
+	x = coord(i);
+	y = coord(i + 1);
+	sprintf(buf1, "%.4g", x);
+	if (strchr(buf1, 'e'))
+	    sprintf(buf1, "%1.2f", x);
+	sprintf(buf2, "%.4g", y);
+	if (strchr(buf2, 'e'))
+	    sprintf(buf2, "%1.2f", y);
+	sprintf(line, "%s %s l\n", buf1, buf2);
+    }
+    report("sprintf (old pdf_float)", iterations, start);
+
+    p = bench_open();
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_moveto(p, 0, 0);
+
+    start = clock();
+    for (i = 0; i < iterations; i++)
+	PDF_lineto(p, coord(i), coord(i + 1));
+    report("PDF_lineto", iterations, start);
+
+    PDF_stroke(p);
+
+    start = clock();
+    for (i = 0; i < iterations; i++)
+	PDF_curveto(p, coord(i), coord(i + 1), coord(i + 2),
+		coord(i + 3), coord(i + 4), coord(i + 5));
+    report("PDF_curveto", iterations, start);
+
+    PDF_stroke(p);
+    PDF_end_page(p);
+    bench_close(p);
+}
+
+/* ------------------------------------------------------------- */
+/* Catalog style documents: many images, each placed on its own page */
+static void
+page_resources(void)
+{
+    static const char pixel[3] = { 0, 0, 0 };
+    clock_t	start;
+    long	i, count = iterations / 200;
+    int		image, font;
+    PDF		*p;
+
+    p = bench_open();
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	image = PDF_open_image(p, "raw", "memory", pixel, 3L, 1, 1, 3, 8, NULL);
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_setfont(p, font, 12);
+	PDF_show_xy(p, "Product", 50, 700);
+	PDF_place_image(p, image, 50, 50, 100);
+	PDF_end_page(p);
+	PDF_close_image(p, image);
+    }
+    report("page with new image", count, start);
+
+    /* images which stay open until the end of the document */
+    start = clock();
+    for (i = 0; i < count; i++)
+	(void) PDF_open_image(p, "raw", "memory", pixel, 3L, 1, 1, 3, 8, NULL);
+    report("PDF_open_image (kept open)", count, start);
+
+    bench_close(p);
+}
+
+/* ------------------------------------------------------------- */
+/* Font lookup: template engines call PDF_findfont() for each text run */
+static void
+font_lookup(void)
+{
+    static const char *names[] = {
+	"Courier", "Courier-Bold", "Courier-Oblique", "Courier-BoldOblique",
+	"Helvetica", "Helvetica-Bold", "Helvetica-Oblique",
+	"Helvetica-BoldOblique", "Times-Roman", "Times-Bold", "Times-Italic",
+	"Times-BoldItalic"
+    };
+#define NAMES	(sizeof(names) / sizeof(names[0]))
+    clock_t	start;
+    long	i;
+    PDF		*p;
+
+    p = bench_open();
+
+    start = clock();
+    for (i = 0; i < iterations; i++)
+	(void) PDF_findfont(p, names[i % NAMES], "default", 0);
+    report("PDF_findfont", iterations, start);
+
+    bench_close(p);
+#undef NAMES
+}
+
+/* ------------------------------------------------------------- */
+/* Server style: many small documents using the same AFM font */
+static void
+afm_documents(void)
+{
+    clock_t	start;
+    long	i, count = iterations / 1000;
+    int		pass;
+    PDF		*p;
+
+    for (pass = 0; pass < 2; pass++) {
+	if (pass == 1)
+	    PDF_shutdown();		/* disable the shared metrics cache */
+
+	start = clock();
+	for (i = 0; i < count; i++) {
+	    p = bench_open();
+	    PDF_set_parameter(p, "FontAFM",
+		"Times-Roman=../fonts/Times-Roman.afm");
+	    (void) PDF_findfont(p, "Times-Roman", "macroman", 0);
+	    PDF_begin_page(p, a4_width, a4_height);
+	    PDF_end_page(p);
+	    bench_close(p);
+	}
+	report(pass ? "AFM document (no cache)" : "AFM document (cached)",
+	    count, start);
+    }
+
+    PDF_boot();
+}
+
+/* ------------------------------------------------------------- */
+/* Parse every AFM file in the fonts directory, bypassing the cache */
+static const char *afm_fonts[] = {
+    "Courier", "Courier-Bold", "Courier-Oblique", "Courier-BoldOblique",
+    "Helvetica", "Helvetica-Bold", "Helvetica-Oblique",
+    "Helvetica-BoldOblique", "Times-Roman", "Times-Bold", "Times-Italic",
+    "Times-BoldItalic", "Symbol", "ZapfDingbats"
+};
+#define AFM_FONTS	(sizeof(afm_fonts) / sizeof(afm_fonts[0]))
+
+static void
+afm_parsing(void)
+{
+    clock_t	start;
+    long	i, count = iterations / 10000;
+    size_t	f;
+    char	buf[256];
+    PDF		*p;
+
+    PDF_shutdown();			/* parse each file every time */
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	p = bench_open();
+	for (f = 0; f < AFM_FONTS; f++) {
+	    sprintf(buf, "%s=../fonts/%s.afm", afm_fonts[f], afm_fonts[f]);
+	    PDF_set_parameter(p, "FontAFM", buf);
+	    if (PDF_findfont(p, afm_fonts[f], "builtin", 0) == -1) {
+		fprintf(stderr, "Couldn't load %s!\n", buf);
+		break;
+	    }
+	}
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_end_page(p);
+	bench_close(p);
+    }
+    report("AFM parse (per font file)", count * (long) AFM_FONTS, start);
+
+    PDF_boot();
+}
+
+/* ------------------------------------------------------------- */
+/* The same fonts from a metrics pack, made by "make bench" with
+ * compile_metrics; with and without the shared pack cache
+ */
+#define BENCH_PACK	"pdfbench.pmp"
+
+static void
+fontpack_documents(void)
+{
+    clock_t	start;
+    long	i, count = iterations / 10000;
+    size_t	f;
+    int		pass;
+    char	buf[256];
+    FILE	*fp;
+    PDF		*p;
+
+    if ((fp = fopen(BENCH_PACK, "rb")) == NULL) {
+	fprintf(stderr, "%s not found, skipping metrics pack test\n",
+	    BENCH_PACK);
+	return;
+    }
+    fclose(fp);
+
+    for (pass = 0; pass < 2; pass++) {
+	if (pass == 1)
+	    PDF_shutdown();		/* disable the shared pack cache */
+
+	start = clock();
+	for (i = 0; i < count; i++) {
+	    p = bench_open();
+	    for (f = 0; f < AFM_FONTS; f++) {
+		sprintf(buf, "%s=%s", afm_fonts[f], BENCH_PACK);
+		PDF_set_parameter(p, "FontPack", buf);
+		if (PDF_findfont(p, afm_fonts[f], "builtin", 0) == -1) {
+		    fprintf(stderr, "Couldn't load %s!\n", buf);
+		    break;
+		}
+	    }
+	    PDF_begin_page(p, a4_width, a4_height);
+	    PDF_end_page(p);
+	    bench_close(p);
+	}
+	report(pass ? "Metrics pack (per font, no cache)" :
+	    "Metrics pack (per font, cached)", count * (long) AFM_FONTS, start);
+    }
+
+    PDF_boot();
+}
+
+/* ------------------------------------------------------------- */
+/* Documents which look up a font in a large resource file */
+#define BENCH_UPR	"pdfbench.upr"
+
+static void
+upr_documents(void)
+{
+    clock_t	start;
+    long	i, count = iterations / 1000;
+    int		pass;
+    FILE	*fp;
+    PDF		*p;
+
+    if ((fp = fopen(BENCH_UPR, "w")) == NULL)
+	return;
+    fputs("PS-Resources-1.0\nFontAFM\nFontOutline\n.\n/../fonts\n", fp);
+    fputs("FontAFM\n", fp);
+    for (i = 0; i < 5000; i++)
+	fprintf(fp, "Font%ld=Font%ld.afm\n", i, i);
+    fputs("Times-Roman=Times-Roman.afm\n.\n", fp);
+    fclose(fp);
+
+    for (pass = 0; pass < 2; pass++) {
+	if (pass == 1)
+	    PDF_shutdown();		/* disable the shared caches */
+
+	start = clock();
+	for (i = 0; i < count; i++) {
+	    p = bench_open();
+	    PDF_set_parameter(p, "resourcefile", BENCH_UPR);
+	    if (PDF_findfont(p, "Times-Roman", "macroman", 0) == -1) {
+		fprintf(stderr, "Font not found via %s!\n", BENCH_UPR);
+		break;
+	    }
+	    PDF_begin_page(p, a4_width, a4_height);
+	    PDF_end_page(p);
+	    bench_close(p);
+	}
+	report(pass ? "UPR document (no cache)" : "UPR document (cached)",
+	    count, start);
+    }
+
+    PDF_boot();
+    remove(BENCH_UPR);
+}
+
+/* ------------------------------------------------------------- */
+/* Kerned string widths: the cost per character must not depend on the
+ * number of kerning pairs. The generated AFM font kerns all pairs of
+ * printable ASCII characters (9025 pairs); Times-Roman has 283 pairs.
+ */
+#define BENCH_AFM	"pdfbench.afm"
+#define KERN_TEXTLEN	1000
+
+static void
+kerning_lookup(void)
+{
+    clock_t	start;
+    long	i, count = iterations / 1000;
+    int		c1, c2, font, pass;
+    char	text[KERN_TEXTLEN + 1], name[64];
+    FILE	*fp;
+    PDF		*p;
+
+    if ((fp = fopen(BENCH_AFM, "w")) == NULL)
+	return;
+    fputs("StartFontMetrics 4.1\nFontName PDFbench-Kerned\n", fp);
+    fputs("EncodingScheme FontSpecific\nStartCharMetrics 95\n", fp);
+    for (c1 = 32; c1 < 127; c1++)
+	fprintf(fp, "C %d ; WX 500 ; N g%d ; B 0 0 500 700 ;\n", c1, c1);
+    fputs("EndCharMetrics\nStartKernData\nStartKernPairs 9025\n", fp);
+    for (c1 = 32; c1 < 127; c1++)
+	for (c2 = 32; c2 < 127; c2++)
+	    fprintf(fp, "KPX g%d g%d %d\n", c1, c2, -1 - (c1 + c2) % 50);
+    fputs("EndKernPairs\nEndKernData\nEndFontMetrics\n", fp);
+    fclose(fp);
+
+    /* text with a realistic mix of kerned and unkerned pairs */
+    for (i = 0; i < KERN_TEXTLEN; i++)
+	text[i] = "AVATAR WAVE To Ty Yo LT. P, We F."[i % 33];
+    text[KERN_TEXTLEN] = '\0';
+
+    p = bench_open();
+    PDF_set_parameter(p, "FontAFM", "PDFbench-Kerned=" BENCH_AFM);
+
+    for (pass = 0; pass < 3; pass++) {
+	if (pass == 2)
+	    font = PDF_findfont(p, "PDFbench-Kerned", "builtin", 0);
+	else
+	    font = PDF_findfont(p, "Times-Roman", "default", 0);
+	PDF_set_parameter(p, "kerning", pass ? "true" : "false");
+
+	start = clock();
+	for (i = 0; i < count; i++)
+	    (void) PDF_stringwidth(p, text, font, 12);
+	report(pass == 0 ? "stringwidth (per char)" :
+	    pass == 1 ? "kerned, 283 pairs (per char)" :
+	    "kerned, 9025 pairs (per char)", count * KERN_TEXTLEN, start);
+    }
+
+    font = PDF_findfont(p, "Times-Roman", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 12);
+    for (pass = 0; pass < 2; pass++) {
+	PDF_set_parameter(p, "kerning", pass ? "true" : "false");
+
+	start = clock();
+	for (i = 0; i < count; i++)
+	    PDF_show_xy(p, text, 50, 700);
+	sprintf(name, "PDF_show%s (per char)", pass ? " kerned" : "");
+	report(name, count * KERN_TEXTLEN, start);
+    }
+    PDF_end_page(p);
+
+    bench_close(p);
+    remove(BENCH_AFM);
+}
+
+/* ------------------------------------------------------------- */
+/* Layout engines measure every word: one call per word compared to one
+ * call for all words of a paragraph
+ */
+#define BATCH_WORDS	1000
+
+static void
+batch_widths(void)
+{
+    static const char *vocabulary[] = {
+	"The", "quick", "brown", "fox", "jumps", "over", "the", "lazy",
+	"dog,", "and", "layout", "engines", "measure", "every", "word."
+    };
+#define VOCABULARY	(sizeof(vocabulary) / sizeof(vocabulary[0]))
+    const char	*words[BATCH_WORDS];
+    char	buffer[BATCH_WORDS * 8];
+    int		offsets[BATCH_WORDS], lengths[BATCH_WORDS];
+    float	widths[BATCH_WORDS];
+    clock_t	start;
+    long	i, count = iterations / 1000;
+    int		w, font, pos = 0;
+    PDF		*p;
+
+    for (w = 0; w < BATCH_WORDS; w++) {
+	words[w] = vocabulary[w % VOCABULARY];
+	offsets[w] = pos;
+	lengths[w] = (int) strlen(words[w]);
+	memcpy(buffer + pos, words[w], (size_t) lengths[w]);
+	pos += lengths[w];
+    }
+
+    p = bench_open();
+    font = PDF_findfont(p, "Times-Roman", "default", 0);
+
+    start = clock();
+    for (i = 0; i < count; i++)
+	for (w = 0; w < BATCH_WORDS; w++)
+	    widths[w] = PDF_stringwidth(p, words[w], font, 12);
+    report("PDF_stringwidth (per word)", count * BATCH_WORDS, start);
+
+    start = clock();
+    for (i = 0; i < count; i++)
+	PDF_stringwidths(p, font, 12, words, BATCH_WORDS, widths);
+    report("PDF_stringwidths (per word)", count * BATCH_WORDS, start);
+
+    start = clock();
+    for (i = 0; i < count; i++)
+	PDF_stringwidths2(p, font, 12, buffer, offsets, lengths,
+	    BATCH_WORDS, widths);
+    report("PDF_stringwidths2 (per word)", count * BATCH_WORDS, start);
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_end_page(p);
+    bench_close(p);
+#undef VOCABULARY
+}
+
+/* Justify a paragraph of BATCH_WORDS words into a column, once with the
+ * word wrapping done by the caller and once with PDF_show_boxed()
+ */
+static void
+boxed_text(void)
+{
+    static const char *vocabulary[] = {
+	"The", "quick", "brown", "fox", "jumps", "over", "the", "lazy",
+	"dog,", "and", "layout", "engines", "measure", "every", "word."
+    };
+#define VOCABULARY	(sizeof(vocabulary) / sizeof(vocabulary[0]))
+    char	text[BATCH_WORDS * 8], line[256];
+    float	lw, ww, space;
+    clock_t	start;
+    long	i, count = iterations / 1000;
+    int		w, n, font, pos = 0, len = 0, spaces = 0;
+    PDF		*p;
+
+    for (w = 0; w < BATCH_WORDS; w++) {
+	if (w > 0)
+	    text[pos++] = ' ';
+	strcpy(text + pos, vocabulary[w % VOCABULARY]);
+	pos += (int) strlen(vocabulary[w % VOCABULARY]);
+    }
+
+    p = bench_open();
+    PDF_set_parameter(p, "statetracking", "true");
+    font = PDF_findfont(p, "Times-Roman", "default", 0);
+    space = PDF_stringwidth(p, " ", font, 10);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_setfont(p, font, 10);
+	PDF_set_text_pos(p, 50, 790);
+	lw = 0;
+	for (w = 0; w < BATCH_WORDS; w++) {
+	    ww = PDF_stringwidth(p, vocabulary[w % VOCABULARY], font, 10);
+	    if (len > 0 && lw + space + ww > 200) {
+		line[len] = '\0';
+		PDF_set_word_spacing(p, spaces ? (200 - lw) / spaces : 0);
+		PDF_continue_text(p, line);
+		len = spaces = 0;
+		lw = 0;
+	    }
+	    if (len > 0) {
+		line[len++] = ' ';
+		lw += space;
+		spaces++;
+	    }
+	    n = (int) strlen(vocabulary[w % VOCABULARY]);
+	    memcpy(line + len, vocabulary[w % VOCABULARY], (size_t) n);
+	    len += n;
+	    lw += ww;
+	}
+	line[len] = '\0';
+	PDF_set_word_spacing(p, 0);
+	PDF_continue_text(p, line);
+	len = spaces = 0;
+	PDF_end_page(p);
+    }
+    report("caller word wrap (per word)", count * BATCH_WORDS, start);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_setfont(p, font, 10);
+	PDF_show_boxed(p, text, 50, 50, 200, 750, "justify", "");
+	PDF_end_page(p);
+    }
+    report("PDF_show_boxed (per word)", count * BATCH_WORDS, start);
+
+    bench_close(p);
+#undef VOCABULARY
+}
+
+/* Show typical lines of statement text, a few of them with parentheses */
+static void
+string_quoting(void)
+{
+    static const char *lines[] = {
+	"Opening balance as of 1 October                     1,234.56",
+	"Transfer to savings account (standing order)          -250.00",
+	"Card payment SUPERMARKET 0815 BERLIN                   -43.17",
+	"Interest for the period 01.07. - 30.09.                 2.31",
+    };
+    clock_t	start;
+    long	i, count = iterations / 10;
+    size_t	bytes = 0;
+    int		font;
+    PDF		*p;
+
+    for (i = 0; i < 4; i++)
+	bytes += strlen(lines[i]);
+
+    p = bench_open();
+    font = PDF_findfont(p, "Courier", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 10);
+
+    start = clock();
+    for (i = 0; i < count; i++)
+	PDF_show(p, lines[i & 3]);
+    report("PDF_show statement (per byte)", (long) (count * bytes / 4),
+	start);
+
+    PDF_end_page(p);
+    bench_close(p);
+}
+
+/* A table of 10000 cells, once with PDF_show_xy() per cell and once with
+ * a single PDF_show_many() call
+ */
+#define TABLE_CELLS	10000
+
+static void
+table_cells(void)
+{
+    static const char	*texts[TABLE_CELLS];
+    static float	x[TABLE_CELLS], y[TABLE_CELLS];
+    static char		cells[TABLE_CELLS][12];
+    clock_t	start;
+    long	i, count = iterations / 100000;
+    long	size_xy, size_many;
+    int		c, font;
+    PDF		*p;
+
+    for (c = 0; c < TABLE_CELLS; c++) {
+	sprintf(cells[c], "%d.%02d", c * 37 % 10000, c % 100);
+	texts[c] = cells[c];
+	x[c] = (float) (20 + 60 * (c % 10));
+	y[c] = (float) (820 - (float) 0.8 * (c / 10));
+    }
+
+    p = bench_open();
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    size_xy = discarded;
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_setfont(p, font, 8);
+	for (c = 0; c < TABLE_CELLS; c++)
+	    PDF_show_xy(p, texts[c], x[c], y[c]);
+	PDF_end_page(p);
+    }
+    report("PDF_show_xy (per cell)", count * TABLE_CELLS, start);
+    bench_close(p);
+    size_xy = discarded - size_xy;
+
+    p = bench_open();
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    size_many = discarded;
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_setfont(p, font, 8);
+	PDF_show_many(p, texts, x, y, NULL, TABLE_CELLS);
+	PDF_end_page(p);
+    }
+    report("PDF_show_many (per cell)", count * TABLE_CELLS, start);
+    bench_close(p);
+    size_many = discarded - size_many;
+
+    printf("%-32s %10ld bytes per cell with PDF_show_xy, %ld with "
+	"PDF_show_many\n", "table output size",
+	size_xy / (count * TABLE_CELLS), size_many / (count * TABLE_CELLS));
+}
+
+/* A polyline of 10000 vertices, once with PDF_lineto() per vertex and once
+ * with a single PDF_polyline() call, and the same for rectangles
+ */
+#define PATH_VERTICES	10000
+
+static void
+batched_paths(void)
+{
+    static float	xy[2 * PATH_VERTICES], xywh[4 * PATH_VERTICES];
+    clock_t	start;
+    long	i, count = iterations / 100000;
+    int		v;
+    PDF		*p;
+
+    for (v = 0; v < PATH_VERTICES; v++) {
+	xy[2 * v] = (float) (20 + v * 0.0555);
+	xy[2 * v + 1] = (float) (420 + 300 * sin(v / 100.0));
+	xywh[4 * v] = (float) (20 + (v % 100) * 5.5);
+	xywh[4 * v + 1] = (float) (20 + (v / 100) * 8);
+	xywh[4 * v + 2] = (float) 4.25;
+	xywh[4 * v + 3] = (float) (6 + v % 3);
+    }
+
+    p = bench_open();
+    PDF_begin_page(p, a4_width, a4_height);
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_moveto(p, xy[0], xy[1]);
+	for (v = 1; v < PATH_VERTICES; v++)
+	    PDF_lineto(p, xy[2 * v], xy[2 * v + 1]);
+	PDF_stroke(p);
+    }
+    report("PDF_lineto (per vertex)", count * PATH_VERTICES, start);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_polyline(p, xy, PATH_VERTICES);
+	PDF_stroke(p);
+    }
+    report("PDF_polyline (per vertex)", count * PATH_VERTICES, start);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	for (v = 0; v < PATH_VERTICES; v++)
+	    PDF_rect(p, xywh[4 * v], xywh[4 * v + 1], xywh[4 * v + 2],
+		xywh[4 * v + 3]);
+	PDF_stroke(p);
+    }
+    report("PDF_rect (per rectangle)", count * PATH_VERTICES, start);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_rects(p, xywh, PATH_VERTICES);
+	PDF_stroke(p);
+    }
+    report("PDF_rects (per rectangle)", count * PATH_VERTICES, start);
+
+    PDF_end_page(p);
+    bench_close(p);
+}
+
+/* A time series of one million points across the page, plotted with and
+ * without decimation for a 600 dpi device
+ */
+#define PLOT_POINTS	1000000L
+
+static void
+plot_decimation(void)
+{
+    static float	xy[2 * PLOT_POINTS];
+    clock_t	start;
+    long	i, count = iterations / 1000000L + 1;
+    long	size_full, size_decimated;
+    PDF		*p;
+
+    for (i = 0; i < PLOT_POINTS; i++) {
+	xy[2 * i] = (float) (20 + 555.0 * i / PLOT_POINTS);
+	xy[2 * i + 1] = (float) (420 + 300 * sin(i / 20000.0) +
+					20 * ((i * 7919) % 101 - 50) / 50.0);
+    }
+
+    p = bench_open();
+    PDF_begin_page(p, a4_width, a4_height);
+    size_full = discarded;
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_polyline(p, xy, (int) PLOT_POINTS);
+	PDF_stroke(p);
+    }
+    report("PDF_polyline (per point)", count * PLOT_POINTS, start);
+    PDF_end_page(p);
+    bench_close(p);
+    size_full = discarded - size_full;
+
+    p = bench_open();
+    PDF_set_parameter(p, "pathresolution", "600");
+    PDF_begin_page(p, a4_width, a4_height);
+    size_decimated = discarded;
+    start = clock();
+    for (i = 0; i < count; i++) {
+	PDF_polyline(p, xy, (int) PLOT_POINTS);
+	PDF_stroke(p);
+    }
+    report("decimated polyline (per point)", count * PLOT_POINTS, start);
+    PDF_end_page(p);
+    bench_close(p);
+    size_decimated = discarded - size_decimated;
+
+    printf("%-32s %10ld bytes per plot, %ld with decimation\n",
+	"plot output size", size_full / count, size_decimated / count);
+}
+
+/* ------------------------------------------------------------- */
+/* Embed a large JPEG image in a disk file and via a write procedure.
+ * The image is the test JPEG padded with junk after its end marker, which
+ * PDFlib copies along like any other JPEG data.
+ */
+#define BENCH_JPEG	"pdfbench.jpg"
+#define BENCH_PDF	"pdfbench.pdf"
+#define JPEG_PADDING	(16L * 1024 * 1024)
+
+static void
+jpeg_passthrough(void)
+{
+    clock_t	start;
+    long	i, count = iterations / 100000L + 1;
+    char	buf[8192];
+    size_t	n;
+    FILE	*in, *out;
+    PDF		*p;
+
+    if ((in = fopen("nesrin.jpg", "rb")) == NULL) {
+	fprintf(stderr, "nesrin.jpg not found, skipping JPEG test\n");
+	return;
+    }
+    out = fopen(BENCH_JPEG, "wb");
+    while ((n = fread(buf, 1, sizeof(buf), in)) > 0)
+	fwrite(buf, 1, n, out);
+    memset(buf, 0x55, sizeof(buf));
+    for (i = 0; i < JPEG_PADDING; i += (long) sizeof(buf))
+	fwrite(buf, 1, sizeof(buf), out);
+    fclose(out);
+    fclose(in);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	p = PDF_new();
+	PDF_open_file(p, BENCH_PDF);
+	PDF_open_JPEG(p, BENCH_JPEG);
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_end_page(p);
+	bench_close(p);
+    }
+    report("JPEG to file (per 16 MB)", count, start);
+
+    start = clock();
+    for (i = 0; i < count; i++) {
+	p = bench_open();
+	PDF_open_JPEG(p, BENCH_JPEG);
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_end_page(p);
+	bench_close(p);
+    }
+    report("JPEG to writeproc (per 16 MB)", count, start);
+
+    remove(BENCH_PDF);
+    remove(BENCH_JPEG);
+}
+
+/* ------------------------------------------------------------- */
+/* Open JPEG files which carry as much metadata as those from digital
+ * cameras and image editors: an EXIF block with thumbnail, an ICC
+ * profile split into several segments, and Photoshop resources.
+ */
+#define CAMERA_JPEGS	8
+
+static void
+write_segment(FILE *fp, int marker, long length)
+{
+    long i;
+
+    putc(0xFF, fp);
+    putc(marker, fp);
+    putc((int) (length >> 8), fp);
+    putc((int) (length & 0xFF), fp);
+    for (i = 2; i < length; i++)
+	putc((int) ((i * 7919) & 0xFF), fp);
+}
+
+static void
+camera_jpegs(void)
+{
+    clock_t	start;
+    long	i, size, count = iterations / 10000 + 1;
+    char	*jpeg, filename[32];
+    FILE	*fp;
+    int		f, s;
+    PDF		*p;
+
+    if ((fp = fopen("nesrin.jpg", "rb")) == NULL) {
+	fprintf(stderr, "nesrin.jpg not found, skipping JPEG marker test\n");
+	return;
+    }
+    fseek(fp, 0L, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0L, SEEK_SET);
+    jpeg = (char *) malloc((size_t) size);
+    size = (long) fread(jpeg, 1, (size_t) size, fp);
+    fclose(fp);
+
+    for (f = 0; f < CAMERA_JPEGS; f++) {
+	sprintf(filename, "pdfbench%d.jpg", f);
+	fp = fopen(filename, "wb");
+	fwrite(jpeg, 1, 2, fp);				/* SOI */
+	write_segment(fp, 0xE1, 60000L + 500L * f);	/* EXIF */
+	for (s = 0; s < 4; s++)
+	    write_segment(fp, 0xE2, 65533L);		/* ICC */
+	write_segment(fp, 0xED, 20000L);		/* Photoshop */
+	fwrite(jpeg + 2, 1, (size_t) size - 2, fp);
+	fclose(fp);
+    }
+    free(jpeg);
+
+    p = bench_open();
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_end_page(p);
+    start = clock();
+    for (i = 0; i < count; i++) {
+	sprintf(filename, "pdfbench%d.jpg", (int) (i % CAMERA_JPEGS));
+	PDF_close_image(p, PDF_open_JPEG(p, filename));
+    }
+    report("PDF_open_JPEG (camera JPEG)", count, start);
+    bench_close(p);
+
+    for (f = 0; f < CAMERA_JPEGS; f++) {
+	sprintf(filename, "pdfbench%d.jpg", f);
+	remove(filename);
+    }
+}
+
+#ifdef HAVE_LIBTIFF
+/* ------------------------------------------------------------- */
+/* Embed a G4 compressed 600 dpi A4 scan, and report the most memory
+ * PDFlib allocated at any one time. A scan in one strip is copied without
+ * decompression, one in many strips is decompressed.
+ */
+#define SCAN_TIFF	"pdfbench.tif"
+#define SCAN_WIDTH	4960
+#define SCAN_HEIGHT	7016
+
+static long mem_current, mem_peak;
+
+static void *
+bench_malloc(PDF *p, size_t size, const char *caller)
+{
+    size_t *mem = (size_t *) malloc(size + 2 * sizeof(size_t));
+
+    (void) p;
+    (void) caller;
+    mem[0] = size;
+    mem_current += (long) size;
+    if (mem_current > mem_peak)
+	mem_peak = mem_current;
+    return mem + 2;
+}
+
+static void *
+bench_realloc(PDF *p, void *ptr, size_t size, const char *caller)
+{
+    size_t *mem = (size_t *) ptr - 2;
+
+    (void) p;
+    (void) caller;
+    mem_current -= (long) mem[0];
+    mem = (size_t *) realloc(mem, size + 2 * sizeof(size_t));
+    mem[0] = size;
+    mem_current += (long) size;
+    if (mem_current > mem_peak)
+	mem_peak = mem_current;
+    return mem + 2;
+}
+
+static void
+bench_free(PDF *p, void *ptr)
+{
+    size_t *mem = (size_t *) ptr - 2;
+
+    (void) p;
+    if (ptr == NULL)
+	return;
+    mem_current -= (long) mem[0];
+    free(mem);
+}
+
+static void
+tiff_scan_strips(int rowsperstrip, const char *name)
+{
+    static unsigned char line[SCAN_WIDTH / 8];
+    clock_t	start;
+    long	i, count = iterations / 200000L + 1;
+    int		x, y;
+    TIFF	*tif;
+    PDF		*p;
+
+    if ((tif = TIFFOpen(SCAN_TIFF, "w")) == NULL)
+	return;
+    TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, SCAN_WIDTH);
+    TIFFSetField(tif, TIFFTAG_IMAGELENGTH, SCAN_HEIGHT);
+    TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, 1);
+    TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, 1);
+    TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISWHITE);
+    TIFFSetField(tif, TIFFTAG_COMPRESSION, COMPRESSION_CCITTFAX4);
+    TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, rowsperstrip);
+
+    /* lines of "text" with a large margin */
+    for (y = 0; y < SCAN_HEIGHT; y++) {
+	memset(line, 0, sizeof(line));
+	if (y > 600 && y < SCAN_HEIGHT - 600 && y % 100 < 60)
+	    for (x = 75; x < SCAN_WIDTH / 8 - 75; x++)
+		line[x] = (unsigned char) (((x * 7919 + y / 4 * 31) >> 3) &
+				((x / 8) % 7 ? 0xFF : 0));
+	TIFFWriteScanline(tif, line, (uint32) y, 0);
+    }
+    TIFFClose(tif);
+
+    mem_peak = 0;
+    start = clock();
+    for (i = 0; i < count; i++) {
+	p = PDF_new2(NULL, bench_malloc, bench_realloc, bench_free, NULL);
+	PDF_open_mem(p, discard);
+	PDF_set_parameter(p, "compress", "0");
+	PDF_open_TIFF(p, SCAN_TIFF);
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_end_page(p);
+	bench_close(p);
+    }
+    report(name, count, start);
+    printf("%-32s %10ld bytes PDFlib memory peak\n", "TIFF scan", mem_peak);
+
+    remove(SCAN_TIFF);
+}
+
+static void
+tiff_scan(void)
+{
+    tiff_scan_strips(SCAN_HEIGHT, "PDF_open_TIFF (A4 scan, 1 strip)");
+    tiff_scan_strips(64, "PDF_open_TIFF (A4 scan, strips)");
+}
+
+/* ------------------------------------------------------------- */
+/* Convert all pages of multi-page fax files. The time per page should
+ * not depend on the number of pages.
+ */
+#define FAX_WIDTH	1728
+#define FAX_HEIGHT	64
+
+static void
+tiff_fax_pages(int pages, const char *name)
+{
+    static unsigned char line[FAX_WIDTH / 8];
+    clock_t	start;
+    int		i, x, y;
+    TIFF	*tif;
+    PDF		*p;
+
+    if ((tif = TIFFOpen(SCAN_TIFF, "w")) == NULL)
+	return;
+    for (i = 0; i < pages; i++) {
+	TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, FAX_WIDTH);
+	TIFFSetField(tif, TIFFTAG_IMAGELENGTH, FAX_HEIGHT);
+	TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, 1);
+	TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, 1);
+	TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISWHITE);
+	TIFFSetField(tif, TIFFTAG_COMPRESSION, COMPRESSION_CCITTFAX4);
+	TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, FAX_HEIGHT);
+	for (y = 0; y < FAX_HEIGHT; y++) {
+	    for (x = 0; x < FAX_WIDTH / 8; x++)
+		line[x] = (unsigned char) ((x * 7919 + y * 31 + i) >> 3);
+	    TIFFWriteScanline(tif, line, (uint32) y, 0);
+	}
+	TIFFWriteDirectory(tif);
+    }
+    TIFFClose(tif);
+
+    p = PDF_new();
+    PDF_open_mem(p, discard);
+    start = clock();
+    for (i = 1; PDF_open_TIFF_page(p, SCAN_TIFF, i) != -1; i++)
+	;
+    report(name, (long) i - 1, start);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_end_page(p);
+    bench_close(p);
+
+    remove(SCAN_TIFF);
+}
+
+static void
+tiff_pages(void)
+{
+    tiff_fax_pages(100, "PDF_open_TIFF_page (100 pages)");
+    tiff_fax_pages(2000, "PDF_open_TIFF_page (2000 pages)");
+}
+#endif
+
+int
+main(int argc, char *argv[])
+{
+    if (argc > 1)
+	iterations = atol(argv[1]);
+
+    PDF_boot();
+
+    number_formatting();
+    page_resources();
+    font_lookup();
+    afm_documents();
+    afm_parsing();
+    fontpack_documents();
+    upr_documents();
+    kerning_lookup();
+    batch_widths();
+    boxed_text();
+    string_quoting();
+    table_cells();
+    batched_paths();
+    plot_decimation();
+    jpeg_passthrough();
+    camera_jpegs();
+#ifdef HAVE_LIBTIFF
+    tiff_scan();
+    tiff_pages();
+#endif
+
+    PDF_shutdown();
+
+    return 0;
+}
@@ -37,9 +37,14 @@
 #include <string.h>
 #include <stdlib.h>
 #include <math.h>
+#include <float.h>
 
 #include "pdflib.h"
 
+#ifdef HAVE_LIBTIFF
+#include <tiffio.h>
+#endif
+
 #if __POWERPC__ || __CFM68K__ || __MC68K__
 #define MAC
 #endif
@@ -359,6 +364,11 @@ grid(PDF *p)
 
     MESSAGE("Grid test...");
 
+#ifdef HAVE_LIBZ
+    /* the repetitive grid operators compress very well */
+    PDF_set_parameter(p, "compress", "9");
+#endif
+
     PDF_begin_page(p, width, height);
     (void) PDF_add_bookmark(p, "Grid", 0, 1);
 
@@ -425,6 +435,10 @@ grid(PDF *p)
 
     PDF_end_page(p);
 
+#ifdef HAVE_LIBZ
+    PDF_set_parameter(p, "compress", "6");
+#endif
+
     MESSAGE("done\n");
 
 #undef STEP
@@ -896,6 +910,1594 @@ many_pages(PDF *p)
     MESSAGE("done\n");
 }
 
+/* ------------------------------------------------------------- */
+/* Generate a small document in memory, once via the internal buffer
+ * and once via a write procedure, and report the results on a page.
+ */
+static size_t
+count_bytes(PDF *p, void *data, size_t size)
+{
+    long *count = (long *) PDF_get_opaque(p);
+
+    (void) data;
+    *count += (long) size;
+    return size;
+}
+
+static void
+memory_document(PDF *q)
+{
+    int font;
+
+    font = PDF_findfont(q, "Helvetica", "default", 0);
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_setfont(q, font, 24);
+    PDF_show_xy(q, "This document never touched the disk", 50, 700);
+    PDF_end_page(q);
+    PDF_close(q);
+}
+
+static void
+memory_output(PDF *p)
+{
+    PDF *q;
+    const char *buf;
+    long size, total = 0, count = 0;
+    char text[128];
+    int font, ok;
+
+    MESSAGE("Memory output test...");
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+
+    /* fetch the header separately to exercise partial fetching */
+    buf = PDF_get_buffer(q, &size);
+    ok = (size > 5 && !strncmp(buf, "%PDF-", 5));
+    total += size;
+
+    memory_document(q);
+    buf = PDF_get_buffer(q, &size);
+    ok = ok && (size > 6 && !strncmp(buf + size - 6, "%%EOF\n", 6));
+    total += size;
+    PDF_delete(q);
+
+    q = PDF_new2(NULL, NULL, NULL, NULL, (void *) &count);
+    PDF_open_mem(q, count_bytes);
+    memory_document(q);
+    PDF_delete(q);
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 18);
+    sprintf(text, "In-core buffer: %ld bytes, header and trailer %s",
+	total, ok ? "ok" : "BROKEN");
+    PDF_show_xy(p, text, 50, 700);
+    sprintf(text, "Write procedure: %ld bytes", count);
+    PDF_continue_text(p, text);
+    PDF_end_page(p);
+
+    if (!ok || count != total)
+	fprintf(stderr, "\nMemory output mismatch!\n");
+
+    MESSAGE("done\n");
+}
+
+/* Turning compression off in the middle of a page must still end the
+ * compressed content stream with an EOL before endstream
+ */
+static void
+compression_switch(void)
+{
+#ifdef HAVE_LIBZ
+    PDF *q;
+    const char *buf;
+    long size, i;
+    int ok = 1;
+
+    MESSAGE("Compression switch test...");
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "6");
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_moveto(q, 50, 50);
+    PDF_lineto(q, 500, 700);
+    PDF_stroke(q);
+    PDF_set_parameter(q, "compress", "0");
+    PDF_end_page(q);
+    PDF_close(q);
+
+    buf = PDF_get_buffer(q, &size);
+    for (i = 1; i + 9 <= size; i++)
+	if (!memcmp(buf + i, "endstream", 9) && buf[i - 1] != '\n')
+	    ok = 0;
+    PDF_delete(q);
+
+    if (!ok)
+	fprintf(stderr, "\nNo EOL before endstream!\n");
+
+    MESSAGE("done\n");
+#endif
+}
+
+/* ------------------------------------------------------------- */
+/* Draw a table in a style which sets the same state over and over,
+ * once with and once without state tracking, and compare the sizes.
+ */
+static void
+state_table(PDF *q, int font)
+{
+    char text[20];
+    int row, col;
+
+    PDF_begin_page(q, a4_width, a4_height);
+    for (row = 0; row < 40; row++) {
+	for (col = 0; col < 6; col++) {
+	    PDF_setlinewidth(q, (float) 0.5);
+	    PDF_setrgbcolor_stroke(q, (float) 0.5, (float) 0.5, (float) 0.5);
+	    PDF_rect(q, (float) (50 + col * 80), (float) (750 - row * 17),
+		80, 17);
+	    PDF_stroke(q);
+
+	    PDF_save(q);
+	    PDF_setgray_fill(q, (float) (row % 2 ? 0.0 : 0.3));
+	    PDF_setfont(q, font, 10);
+	    sprintf(text, "%d/%d", row, col);
+	    PDF_show_xy(q, text, (float) (55 + col * 80), (float) (755 - row * 17));
+	    PDF_restore(q);
+	}
+    }
+    PDF_end_page(q);
+}
+
+static void
+state_tracking(PDF *p)
+{
+    PDF *q;
+    long size[2];
+    char text[128];
+    int i, font;
+
+    MESSAGE("State tracking test...");
+
+    for (i = 0; i < 2; i++) {
+	q = PDF_new();
+	PDF_set_parameter(q, "compress", "0");
+	PDF_set_parameter(q, "statetracking", i ? "true" : "false");
+	PDF_open_mem(q, NULL);
+	state_table(q, PDF_findfont(q, "Helvetica", "default", 0));
+	PDF_close(q);
+	(void) PDF_get_buffer(q, &size[i]);
+	PDF_delete(q);
+    }
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    PDF_set_parameter(p, "statetracking", "true");
+    state_table(p, font);
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 18);
+    sprintf(text, "Without state tracking: %ld bytes", size[0]);
+    PDF_show_xy(p, text, 50, 700);
+    sprintf(text, "With state tracking: %ld bytes", size[1]);
+    PDF_continue_text(p, text);
+    PDF_end_page(p);
+    PDF_set_parameter(p, "statetracking", "false");
+
+    if (size[1] >= size[0])
+	fprintf(stderr, "\nState tracking didn't save anything!\n");
+
+    MESSAGE("done\n");
+}
+
+/* ------------------------------------------------------------- */
+/* Load the same AFM metrics in several PDF objects, configured via
+ * PDF_set_parameter() and via a resource file. Between PDF_boot() and
+ * PDF_shutdown() the parsed metrics and resource files are shared.
+ */
+#ifdef MAC
+#define AFM_ENCODING	"winansi"	/* macroman metrics are built in */
+#define AFM_BUILTIN	"macroman"
+#else
+#define AFM_ENCODING	"macroman"	/* winansi metrics are built in */
+#define AFM_BUILTIN	"winansi"
+#endif
+
+#define UPRFILE		"pdftest.upr"
+
+static float
+afm_stringwidth(PDF *q, const char *text, int use_upr)
+{
+    int font;
+
+    if (use_upr)
+	PDF_set_parameter(q, "resourcefile", UPRFILE);
+    else
+	PDF_set_parameter(q, "FontAFM",
+	    "Times-Roman=../fonts/Times-Roman.afm");
+    font = PDF_findfont(q, "Times-Roman", AFM_ENCODING, 0);
+    if (font == -1)
+	return (float) -1.0;
+
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_setfont(q, font, 24);
+    PDF_show_xy(q, "AFM metrics", 50, 700);
+    PDF_end_page(q);
+
+    return PDF_stringwidth(q, text, font, 24);
+}
+
+static void
+afm_metrics(PDF *p)
+{
+    PDF *q;
+    FILE *fp;
+    float width[4];
+    char text[128];
+    int i, font;
+
+    MESSAGE("AFM metrics test...");
+
+    /* the directory prefix is relative to the current directory */
+    if ((fp = fopen(UPRFILE, "w")) == NULL) {
+	fprintf(stderr, "\nCouldn't create %s!\n", UPRFILE);
+	return;
+    }
+    fputs("PS-Resources-1.0\nFontAFM\n.\n/../fonts\n", fp);
+    fputs("FontAFM\nTimes-Roman=Times-Roman.afm\n.\n", fp);
+    fclose(fp);
+
+    for (i = 0; i < 4; i++) {
+	q = PDF_new();
+	PDF_open_mem(q, NULL);
+	width[i] = afm_stringwidth(q, "Shared AFM metrics", i >= 2);
+	PDF_close(q);
+	PDF_delete(q);
+    }
+
+    remove(UPRFILE);
+
+    if (width[0] < 0 || width[0] != width[1] ||
+	width[0] != width[2] || width[0] != width[3]) {
+	fprintf(stderr, "\nAFM metrics not found or inconsistent!\n");
+	return;
+    }
+
+    /* widths of ASCII characters must match the built-in metrics */
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    font = PDF_findfont(q, "Times-Roman", AFM_BUILTIN, 0);
+    if (PDF_stringwidth(q, "Shared AFM metrics", font, 24) != width[0])
+	fprintf(stderr, "\nAFM widths differ from built-in metrics!\n");
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_end_page(q);
+    PDF_close(q);
+    PDF_delete(q);
+
+    (void) afm_stringwidth(p, "Shared AFM metrics", 0);
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 18);
+    sprintf(text, "Width of a Times-Roman string (%s): %g",
+	AFM_ENCODING, width[0]);
+    PDF_show_xy(p, text, 50, 700);
+    PDF_end_page(p);
+
+    MESSAGE("done\n");
+}
+
+/* ------------------------------------------------------------- */
+/* Parse a minimal AFM file with DOS line ends and no final newline */
+#define AFMFILE		"pdftest.afm"
+
+static void
+afm_parser(PDF *p)
+{
+    FILE *fp;
+    char text[128];
+    float width;
+    int font;
+
+    MESSAGE("AFM parser test...");
+
+    if ((fp = fopen(AFMFILE, "wb")) == NULL) {
+	fprintf(stderr, "\nCouldn't create %s!\n", AFMFILE);
+	return;
+    }
+    fputs("StartFontMetrics 4.1\r\n", fp);
+    fputs("Comment: tokens may end with a colon\r\n", fp);
+    fputs("FontName PDFtest-Metrics\r\nFullName PDFtest Metrics\r\n", fp);
+    fputs("EncodingScheme FontSpecific\r\nFontBBox 0 -200 1000 800\r\n", fp);
+    fputs("StartCharMetrics 2\r\n", fp);
+    fputs("C 65 ; WX 600 ; N A ; B 0 0 600 700 ;\r\n", fp);
+    fputs("C 66 ; WX 400 ; N B ; B 0 0 400 700 ;\r\n", fp);
+    fputs("EndCharMetrics\r\nEndFontMetrics", fp);
+    fclose(fp);
+
+    PDF_set_parameter(p, "FontAFM", "PDFtest-Metrics=" AFMFILE);
+    font = PDF_findfont(p, "PDFtest-Metrics", "builtin", 0);
+
+    remove(AFMFILE);
+
+    if (font == -1) {
+	fprintf(stderr, "\nCouldn't parse %s!\n", AFMFILE);
+	return;
+    }
+
+    width = PDF_stringwidth(p, "AB", font, 10);
+    if (width != (float) 10.0)
+	fprintf(stderr, "\nWrong AFM widths: %g instead of 10!\n", width);
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 18);
+    sprintf(text, "Width of \"AB\" in 10 point PDFtest-Metrics: %g", width);
+    PDF_show_xy(p, text, 50, 700);
+    PDF_end_page(p);
+
+    MESSAGE("done\n");
+}
+
+/* ------------------------------------------------------------- */
+/* Load a font from a minimal metrics pack, as written by compile_metrics:
+ * big-endian numbers, a sorted directory, one font record, one width
+ * table for the builtin encoding, and the strings.
+ */
+#define PACKFILE	"pdftest.pmp"
+#define FALLBACKFILE	"pdftest2.afm"
+#define PACK_RECORD	27		/* numbers per font record */
+
+static void
+put32(FILE *fp, long val)
+{
+    putc((int) ((val >> 24) & 0xFF), fp);
+    putc((int) ((val >> 16) & 0xFF), fp);
+    putc((int) ((val >> 8) & 0xFF), fp);
+    putc((int) (val & 0xFF), fp);
+}
+
+static void
+font_pack(PDF *p)
+{
+    static const char strings[] = "PDFtest-Pack\0FontSpecific\0";
+    long widths, names;
+    PDF *q;
+    FILE *fp;
+    char text[128];
+    float width;
+    int i, font;
+
+    MESSAGE("Font metrics pack test...");
+
+    if ((fp = fopen(PACKFILE, "wb")) == NULL) {
+	fprintf(stderr, "\nCouldn't create %s!\n", PACKFILE);
+	return;
+    }
+
+    widths = 16 + 8 + 4 * PACK_RECORD;
+    names = widths + 4 * 256;
+
+    fputs("%PMP", fp);			/* header */
+    put32(fp, 1L);
+    put32(fp, 1L);
+    put32(fp, 16L);
+    put32(fp, names);			/* directory */
+    put32(fp, 24L);
+
+    put32(fp, names);			/* FontName */
+    put32(fp, 0L);			/* FullName */
+    put32(fp, names + 13);		/* EncodingScheme */
+    put32(fp, 0L);			/* FamilyName */
+    put32(fp, 0L);			/* Weight */
+    put32(fp, 4L);			/* Flags: symbolic */
+    put32(fp, -12000L);			/* ItalicAngle */
+    for (i = 7; i < 20; i++)		/* remaining global metrics */
+	put32(fp, (long) (i == 16 ? 700 : 0));
+    put32(fp, widths);			/* builtin widths */
+    for (i = 21; i < PACK_RECORD; i++)	/* other encodings, kerning */
+	put32(fp, 0L);
+
+    for (i = 0; i < 256; i++)
+	put32(fp, (long) (i == 'A' ? 600 : i == 'B' ? 400 : 250));
+
+    fwrite(strings, 1, sizeof(strings), fp);
+    fclose(fp);
+
+    PDF_set_parameter(p, "FontPack", "PDFtest-Pack=" PACKFILE);
+    font = PDF_findfont(p, "PDFtest-Pack", "builtin", 0);
+
+    /* a font which the pack doesn't have falls back to its AFM file */
+    if ((fp = fopen(FALLBACKFILE, "wb")) != NULL) {
+	fputs("StartFontMetrics 4.1\nFontName PDFtest-Fallback\n", fp);
+	fputs("EncodingScheme FontSpecific\nStartCharMetrics 1\n", fp);
+	fputs("C 65 ; WX 500 ; N A ;\nEndCharMetrics\nEndFontMetrics\n", fp);
+	fclose(fp);
+    }
+    PDF_set_parameter(p, "FontPack", "PDFtest-Fallback=" PACKFILE);
+    PDF_set_parameter(p, "FontAFM", "PDFtest-Fallback=" FALLBACKFILE);
+    if (PDF_findfont(p, "PDFtest-Fallback", "builtin", 0) == -1)
+	fprintf(stderr, "\nNo AFM fallback for a font missing in the pack!\n");
+
+    /* the resource file has no font file to embed, so the shared AFM
+     * metrics must be released again
+     */
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "resourcefile", "../fonts/pdflib.upr");
+    PDF_set_parameter(q, "FontAFM", "PDFtest-Fallback=" FALLBACKFILE);
+    if (PDF_findfont(q, "PDFtest-Fallback", "builtin", 1) != -1)
+	fprintf(stderr, "\nEmbedded a font without a font file!\n");
+    PDF_close(q);
+    PDF_delete(q);
+
+    remove(FALLBACKFILE);
+    remove(PACKFILE);
+
+    if (font == -1) {
+	fprintf(stderr, "\nCouldn't load font from %s!\n", PACKFILE);
+	return;
+    }
+
+    width = PDF_stringwidth(p, "AB", font, 10);
+    if (width != (float) 10.0)
+	fprintf(stderr, "\nWrong metrics pack widths: %g instead of 10!\n",
+	    width);
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 18);
+    sprintf(text, "Width of \"AB\" in 10 point PDFtest-Pack: %g", width);
+    PDF_show_xy(p, text, 50, 700);
+    PDF_end_page(p);
+
+    MESSAGE("done\n");
+}
+
+/* ------------------------------------------------------------- */
+/* With the "kerning" parameter string widths include the kerning pairs
+ * of the font, and text is shown with TJ. The built-in metrics and the
+ * AFM file must agree.
+ */
+#define KERNED_TJ	"[(A)135(V)135(A)111(T)]TJ"
+
+static void
+kerning(PDF *p)
+{
+    PDF *q;
+    const char *buf;
+    long size, i;
+    float plain, kerned, afm;
+    char text[128];
+    int font, found = 0;
+
+    MESSAGE("Kerning test...");
+
+    q = PDF_new();
+    PDF_set_parameter(q, "compress", "0");
+    PDF_open_mem(q, NULL);
+
+    font = PDF_findfont(q, "Times-Roman", "default", 0);
+    plain = PDF_stringwidth(q, "AVAT", font, 10);
+    PDF_set_parameter(q, "kerning", "true");
+    kerned = PDF_stringwidth(q, "AVAT", font, 10);
+
+    PDF_set_parameter(q, "FontAFM", "Times-Roman=../fonts/Times-Roman.afm");
+    font = PDF_findfont(q, "Times-Roman", AFM_ENCODING, 0);
+    afm = font == -1 ? (float) -1.0 : PDF_stringwidth(q, "AVAT", font, 10);
+
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_setfont(q, font, 24);
+    PDF_show_xy(q, "AVAT", 50, 700);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    buf = PDF_get_buffer(q, &size);
+    for (i = 0; i + (long) strlen(KERNED_TJ) <= size && !found; i++)
+	found = !memcmp(buf + i, KERNED_TJ, strlen(KERNED_TJ));
+    PDF_delete(q);
+
+    /* 2777 units without kerning, 2396 with the pairs AV, VA, and AT */
+    if ((int) (plain * 100 + 0.5) != 2777 ||
+	(int) (kerned * 100 + 0.5) != 2396 || afm != kerned)
+	fprintf(stderr, "\nWrong kerned widths: %g/%g/%g!\n",
+	    plain, kerned, afm);
+
+    if (!found)
+	fprintf(stderr, "\nKerned text not shown with TJ!\n");
+
+    font = PDF_findfont(p, "Times-Roman", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 36);
+    PDF_show_xy(p, "AVATAR WAVE To", 50, 700);
+    PDF_set_parameter(p, "kerning", "true");
+    PDF_continue_text(p, "AVATAR WAVE To");
+    sprintf(text, "Kerned width of \"AVAT\" in 10 point: %g instead of %g",
+	kerned, plain);
+    PDF_continue_text(p, text);
+    PDF_set_parameter(p, "kerning", "false");
+    PDF_end_page(p);
+
+    MESSAGE("done\n");
+}
+
+/* ------------------------------------------------------------- */
+/* The batch string width functions must agree with PDF_stringwidth(),
+ * with and without kerning.
+ */
+#define WIDTH_WORDS	5
+
+static void
+string_widths(PDF *p)
+{
+    static const char *words[WIDTH_WORDS] = {
+	"AVATAR", "", "Width", "of", "words"
+    };
+    static const char buffer[] = "AVATARWidthofwords";
+    static const int offsets[WIDTH_WORDS] = { 0, 6, 6, 11, 13 };
+    static const int lengths[WIDTH_WORDS] = { 6, 0, 5, 2, 5 };
+    float widths[WIDTH_WORDS], widths2[WIDTH_WORDS];
+    char text[128];
+    int i, font, pass, ok = 1;
+
+    MESSAGE("String widths test...");
+
+    font = PDF_findfont(p, "Times-Roman", "default", 0);
+
+    for (pass = 0; pass < 2; pass++) {
+	PDF_set_parameter(p, "kerning", pass ? "true" : "false");
+	PDF_stringwidths(p, font, 12, words, WIDTH_WORDS, widths);
+	PDF_stringwidths2(p, font, 12, buffer, offsets, lengths,
+	    WIDTH_WORDS, widths2);
+
+	for (i = 0; i < WIDTH_WORDS; i++)
+	    if (widths[i] != PDF_stringwidth(p, words[i], font, 12) ||
+		widths2[i] != widths[i])
+		ok = 0;
+    }
+    PDF_set_parameter(p, "kerning", "false");
+
+    if (!ok)
+	fprintf(stderr, "\nBatch string widths differ!\n");
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 12);
+    PDF_set_text_pos(p, 50, 700);
+    for (i = 0; i < WIDTH_WORDS; i++) {
+	sprintf(text, "\"%s\": %g", words[i], widths[i]);
+	PDF_continue_text(p, text);
+    }
+    PDF_end_page(p);
+
+    MESSAGE("done\n");
+}
+
+static void
+text_boxes(PDF *p)
+{
+    static const char *modes[] = {
+	"left", "right", "center", "justify", "fulljustify"
+    };
+    static const char text[] =
+	"PDFlib formats this paragraph into a box, breaking lines between "
+	"words and aligning them as requested. A line which ends a paragraph "
+	"is not stretched when justifying.\nA newline starts a new "
+	"paragraph; Supercalifragilisticexpialidocious is broken between "
+	"characters if it doesn't fit into a line of its own.";
+    const char *rest;
+    int i, font, left, blind, pages, ok = 1;
+
+    MESSAGE("Text box test...");
+
+    font = PDF_findfont(p, "Times-Roman", "default", 0);
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 10);
+
+    for (i = 0; i < 5; i++) {
+	PDF_rect(p, 50, (float) (700 - 130 * i), 200, 110);
+	PDF_stroke(p);
+	if (PDF_show_boxed(p, text, 50, (float) (700 - 130 * i), 200, 110,
+		modes[i], "") != 0)
+	    ok = 0;
+    }
+
+    PDF_show_boxed(p, "right aligned at x = 550", 550, 800, 0, 0,
+	"right", "");
+    PDF_end_page(p);
+
+    /* paginate the text into small boxes, one per page */
+    PDF_setfont(p, font, 12);
+    for (rest = text, pages = 0; *rest && pages < 20; pages++) {
+	blind = PDF_show_boxed(p, rest, 0, 0, 90, 40, "justify", "blind");
+
+	PDF_begin_page(p, 200, 100);
+	PDF_setfont(p, font, 12);
+	left = PDF_show_boxed(p, rest, 50, 30, 90, 40, "justify", "");
+	PDF_end_page(p);
+
+	if (left != blind || left >= (int) strlen(rest))
+	    ok = 0;
+	rest += strlen(rest) - left;
+    }
+
+    if (!ok || *rest)
+	fprintf(stderr, "\nText box layout failed!\n");
+
+    MESSAGE("done\n");
+}
+
+/* Return nonzero if the size bytes at buf contain the len bytes at s */
+static int
+contains(const char *buf, long size, const char *s, size_t len)
+{
+    long i;
+
+    for (i = 0; i + (long) len <= size; i++)
+	if (!memcmp(buf + i, s, len))
+	    return 1;
+    return 0;
+}
+
+static void
+string_quoting(PDF *p)
+{
+    /* 8-bit text with special characters at all word offsets */
+    static const char text[] =
+	"(a)b\\cd\tefgh(ijklmnop)qrstuvwxyz0123456789\\\\))((\t";
+    static const char text_quoted[] =
+	"(\\(a\\)b\\\\cd    efgh\\(ijklmnop\\)qrstuvwxyz0123456789"
+	"\\\\\\\\\\)\\)\\(\\(    )Tj";
+    /* Unicode text with a 00 00 byte pair at an odd offset, a tab,
+     * a parenthesis, and a carriage return
+     */
+    static const char utext[] =
+	"\376\377\000A\001\000\000B\001\011\000(\001\015\000C\000\000";
+    static const char utext_quoted[] =
+	"(\376\377\000A\001\000\000B\001\011\000\\(\001\\r\000C)";
+    PDF *q;
+    const char *buf;
+    long size;
+    char line[128];
+    int font, ok;
+
+    MESSAGE("String quoting test...");
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    font = PDF_findfont(q, "Helvetica", "default", 0);
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_setfont(q, font, 12);
+    PDF_show(q, text);
+    PDF_add_bookmark(q, utext, 0, 0);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    buf = PDF_get_buffer(q, &size);
+    ok = contains(buf, size, text_quoted, sizeof(text_quoted) - 1) &&
+	 contains(buf, size, utext_quoted, sizeof(utext_quoted) - 1);
+    PDF_delete(q);
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 12);
+    PDF_show_xy(p, text, 50, 700);
+    sprintf(line, "Quoted strings %s", ok ? "ok" : "BROKEN");
+    PDF_continue_text(p, line);
+    PDF_end_page(p);
+
+    if (!ok)
+	fprintf(stderr, "\nString quoting failed!\n");
+
+    MESSAGE("done\n");
+}
+
+/* Count the occurrences of the text operator op in a content stream */
+static int
+count_ops(const char *buf, long size, const char *op)
+{
+    size_t len = strlen(op);
+    long i;
+    int count = 0;
+
+    for (i = 0; i + (long) len <= size; i++)
+	if (!memcmp(buf + i, op, len) && (i == 0 || buf[i - 1] == ' ' ||
+	    buf[i - 1] == '\n' || buf[i - 1] == ')') && buf[i + len] == '\n')
+	    count++;
+    return count;
+}
+
+#define TABLE_ROWS	20
+#define TABLE_COLS	5
+
+static void
+text_table(PDF *p)
+{
+    const char *texts[TABLE_ROWS * TABLE_COLS];
+    float x[TABLE_ROWS * TABLE_COLS], y[TABLE_ROWS * TABLE_COLS];
+    int fonts[TABLE_ROWS * TABLE_COLS];
+    char cells[TABLE_ROWS * TABLE_COLS][16];
+    PDF *q;
+    const char *buf;
+    long size;
+    int i, n, font, bold, ok;
+
+    MESSAGE("Text table test...");
+
+    for (i = 0; i < TABLE_ROWS * TABLE_COLS; i++) {
+	sprintf(cells[i], i % TABLE_COLS ? "%d.%02d" : "Row %d",
+	    i / TABLE_COLS, i % 100);
+	texts[i] = cells[i];
+	x[i] = (float) (50 + 100 * (i % TABLE_COLS));
+	y[i] = (float) (750 - 20 * (i / TABLE_COLS));
+    }
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    font = PDF_findfont(q, "Helvetica", "default", 0);
+    bold = PDF_findfont(q, "Helvetica-Bold", "default", 0);
+    for (i = 0; i < TABLE_ROWS * TABLE_COLS; i++)
+	fonts[i] = i % TABLE_COLS ? font : bold;
+
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_setfont(q, font, 10);
+    PDF_show_many(q, texts, x, y, fonts, TABLE_ROWS * TABLE_COLS);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    /* one text block, a Td and a Tj per cell, two font changes per row
+     * after the initial PDF_setfont()
+     */
+    buf = PDF_get_buffer(q, &size);
+    n = TABLE_ROWS * TABLE_COLS;
+    ok = count_ops(buf, size, "BT") == 1 && count_ops(buf, size, "Tm") == 0 &&
+	 count_ops(buf, size, "Td") == n && count_ops(buf, size, "Tj") == n &&
+	 count_ops(buf, size, "Tf") == 2 * TABLE_ROWS + 1;
+    PDF_delete(q);
+
+    font = PDF_findfont(p, "Helvetica", "default", 0);
+    bold = PDF_findfont(p, "Helvetica-Bold", "default", 0);
+    for (i = 0; i < TABLE_ROWS * TABLE_COLS; i++)
+	fonts[i] = i % TABLE_COLS ? font : bold;
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, font, 10);
+    PDF_show_many(p, texts, x, y, fonts, TABLE_ROWS * TABLE_COLS);
+    PDF_show_many(p, texts, x, y, NULL, 0);
+    PDF_end_page(p);
+
+    if (!ok)
+	fprintf(stderr, "\nText table output unexpected!\n");
+
+    MESSAGE("done\n");
+}
+
+/* Show strings twice at the same position. Each one must start at that
+ * position again, not after the string shown before.
+ */
+static void
+same_position(PDF *p)
+{
+    static const char *texts[] = { "third", "fourth" };
+    static const float x[] = { 200, 200 }, y[] = { 300, 300 };
+    static const char second[] = "0 0 Td\n(second)Tj";
+    static const char fourth[] = "0 0 Td\n(fourth)Tj";
+    PDF *q;
+    const char *buf;
+    long size;
+    int ok;
+
+    MESSAGE("Same position test...");
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    PDF_set_parameter(q, "statetracking", "true");
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_setfont(q, PDF_findfont(q, "Helvetica", "default", 0), 10);
+    PDF_show_xy(q, "first", 100, 100);
+    PDF_show_xy(q, "second", 100, 100);
+    PDF_show_many(q, texts, x, y, NULL, 2);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    buf = PDF_get_buffer(q, &size);
+    ok = contains(buf, size, second, sizeof(second) - 1) &&
+	 contains(buf, size, fourth, sizeof(fourth) - 1);
+    PDF_delete(q);
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_setfont(p, PDF_findfont(p, "Helvetica", "default", 0), 24);
+    PDF_set_parameter(p, "statetracking", "true");
+    PDF_show_xy(p, "Overprinted", 50, 700);
+    PDF_show_xy(p, "Overprinted", 50, 700);
+    PDF_set_parameter(p, "statetracking", "false");
+    PDF_end_page(p);
+
+    if (!ok)
+	fprintf(stderr, "\nText at the same position misplaced!\n");
+
+    MESSAGE("done\n");
+}
+
+#define PATH_POINTS	1000
+#define PATH_RECTS	300
+
+/* Return the data of the first stream in an uncompressed PDF buffer */
+static const char *
+first_stream(const char *buf, long size, long *len)
+{
+    long i, start = -1;
+
+    for (i = 0; i + 9 <= size; i++) {
+	if (start < 0 && !memcmp(buf + i, "stream\n", 7)) {
+	    start = i + 7;
+	} else if (start >= 0 && !memcmp(buf + i, "endstream", 9)) {
+	    *len = i - start;
+	    return buf + start;
+	}
+    }
+    *len = 0;
+    return buf;
+}
+
+/* Draw the test paths with PDF_polyline(), PDF_polygon() and PDF_rects()
+ * or, if batched is false, with the equivalent single path segments
+ */
+static void
+draw_paths(PDF *p, const float *xy, const float *xywh, int batched)
+{
+    int i;
+
+    if (batched) {
+	PDF_polyline(p, xy, PATH_POINTS);
+	PDF_stroke(p);
+	PDF_polygon(p, xy, 5);
+	PDF_fill(p);
+	PDF_rects(p, xywh, PATH_RECTS);
+	PDF_stroke(p);
+	PDF_polyline(p, xy, 0);
+	return;
+    }
+
+    PDF_moveto(p, xy[0], xy[1]);
+    for (i = 1; i < PATH_POINTS; i++)
+	PDF_lineto(p, xy[2 * i], xy[2 * i + 1]);
+    PDF_stroke(p);
+    PDF_moveto(p, xy[0], xy[1]);
+    for (i = 1; i < 5; i++)
+	PDF_lineto(p, xy[2 * i], xy[2 * i + 1]);
+    PDF_closepath(p);
+    PDF_fill(p);
+    for (i = 0; i < PATH_RECTS; i++)
+	PDF_rect(p, xywh[4*i], xywh[4*i + 1], xywh[4*i + 2], xywh[4*i + 3]);
+    PDF_stroke(p);
+}
+
+static void
+batched_paths(PDF *p)
+{
+    static float xy[2 * PATH_POINTS], xywh[4 * PATH_RECTS];
+    PDF *q[2];
+    const char *buf[2];
+    long size[2];
+    int i, ok;
+
+    MESSAGE("Batched path test...");
+
+    for (i = 0; i < PATH_POINTS; i++) {
+	xy[2 * i] = (float) (50 + i * 0.495);
+	xy[2 * i + 1] = (float) (400 + 200 * sin(i / 20.0));
+    }
+    for (i = 0; i < PATH_RECTS; i++) {
+	xywh[4 * i] = (float) (50 + (i % 30) * 16.5);
+	xywh[4 * i + 1] = (float) (50 + (i / 30) * 25);
+	xywh[4 * i + 2] = (float) (12 - (i % 7) * 0.25);
+	xywh[4 * i + 3] = (float) (i % 2 ? -20 : 20);
+    }
+
+    /* the batched paths must produce exactly the same content */
+    for (i = 0; i < 2; i++) {
+	q[i] = PDF_new();
+	PDF_open_mem(q[i], NULL);
+	PDF_set_parameter(q[i], "compress", "0");
+	PDF_begin_page(q[i], a4_width, a4_height);
+	draw_paths(q[i], xy, xywh, i);
+	PDF_end_page(q[i]);
+	PDF_close(q[i]);
+	buf[i] = PDF_get_buffer(q[i], &size[i]);
+	buf[i] = first_stream(buf[i], size[i], &size[i]);
+    }
+    ok = size[0] > 0 && size[0] == size[1] &&
+	 !memcmp(buf[0], buf[1], (size_t) size[0]);
+    PDF_delete(q[0]);
+    PDF_delete(q[1]);
+
+    PDF_begin_page(p, a4_width, a4_height);
+    draw_paths(p, xy, xywh, 1);
+    PDF_end_page(p);
+
+    if (!ok)
+	fprintf(stderr, "\nBatched path output differs!\n");
+
+    MESSAGE("done\n");
+}
+
+#define PLOT_POINTS	100000
+#define PLOT_WIDTH	500
+
+/* A dense time series, decimated for 72 dpi and for 300 dpi in a scaled
+ * coordinate system, an excursion outside of the page, and rectangles
+ * outside of the page
+ */
+static void
+path_decimation(PDF *p)
+{
+    static float xy[2 * PLOT_POINTS];
+    static float outside[] = {
+	100, 100, -50, 200, -60, 300, -200, 300, -70, 200, 100, 300
+    };
+    static float rects[] = {
+	100, 100, 10, 10, -50, 100, 10, 10, 100, 900, 10, 10, -5, 100, 10, 10
+    };
+    static float dash[] = { 3, 1 };
+    PDF *q;
+    const char *buf;
+    long size;
+    int i, ok;
+
+    MESSAGE("Path decimation test...");
+
+    for (i = 0; i < PLOT_POINTS; i++) {
+	xy[2 * i] = (float) (50 + (double) PLOT_WIDTH * i / PLOT_POINTS);
+	xy[2 * i + 1] = (float) (400 + 200 * sin(i / 5000.0) +
+					20 * ((i * 7919) % 101 - 50) / 50.0);
+    }
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    PDF_set_parameter(q, "pathresolution", "72");
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_polyline(q, xy, PLOT_POINTS);
+    PDF_stroke(q);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    /* at most four points per pixel column */
+    buf = PDF_get_buffer(q, &size);
+    buf = first_stream(buf, size, &size);
+    i = count_ops(buf, size, "l");
+    ok = count_ops(buf, size, "m") == 1 && i >= PLOT_WIDTH &&
+	 i < 4 * (PLOT_WIDTH + 1);
+    PDF_delete(q);
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    PDF_set_parameter(q, "pathresolution", "300");
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_scale(q, 0.5, 0.5);
+    PDF_polyline(q, xy, PLOT_POINTS);
+    PDF_stroke(q);
+    PDF_polygon(q, outside, 6);
+    PDF_fill(q);
+    PDF_rects(q, rects, 4);
+    PDF_fill(q);
+    PDF_setpolydash(q, dash, 2);
+    PDF_polyline(q, xy, 1000);
+    PDF_stroke(q);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    /* 300 dpi at half size gives about twice as many columns; the
+     * excursion left of the page is reduced to its first and last point,
+     * one rectangle is culled, and the dashed line is written unchanged
+     */
+    buf = PDF_get_buffer(q, &size);
+    buf = first_stream(buf, size, &size);
+    i = count_ops(buf, size, "l") - 3 - 999;
+    ok = ok && count_ops(buf, size, "m") == 3 &&
+	 count_ops(buf, size, "re") == 3 &&
+	 contains(buf, size, "-50 200 l\n-70 200 l\n100 300 l\n", 30) &&
+	 i >= 2 * PLOT_WIDTH && i < 4 * (PLOT_WIDTH * 300 / 144 + 2);
+    PDF_delete(q);
+
+    PDF_set_parameter(p, "pathresolution", "600");
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_polyline(p, xy, PLOT_POINTS);
+    PDF_stroke(p);
+    PDF_end_page(p);
+    PDF_set_parameter(p, "pathresolution", "0");
+
+    if (!ok)
+	fprintf(stderr, "\nPath decimation output unexpected!\n");
+
+    MESSAGE("done\n");
+}
+
+#define HUGE_RE	"-2147483647 -2147483647 2147483647 2147483647 re\n"
+
+/* Numbers beyond PDF's limits are clamped to the largest integer, also
+ * at every position in the batched path buffer; NaN and infinity are
+ * written as 0
+ */
+static void
+huge_numbers(PDF *p)
+{
+    static float small[4 * 40], huge[4 * 4];
+    double inf = HUGE_VAL;
+    PDF *q;
+    const char *buf;
+    long size;
+    int i, ok;
+
+    MESSAGE("Huge numbers test...");
+
+    for (i = 0; i < 40; i++) {
+	small[4 * i] = small[4 * i + 1] = (float) (50 + i);
+	small[4 * i + 2] = small[4 * i + 3] = 10;
+    }
+    for (i = 0; i < 4; i++) {
+	huge[4 * i] = huge[4 * i + 1] = -FLT_MAX;
+	huge[4 * i + 2] = huge[4 * i + 3] = FLT_MAX;
+    }
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    PDF_begin_page(q, a4_width, a4_height);
+    for (i = 0; i <= 40; i++) {
+	PDF_rects(q, small, i);
+	PDF_rects(q, huge, 4);
+    }
+    PDF_stroke(q);
+    PDF_moveto(q, -FLT_MAX, FLT_MAX);
+    PDF_lineto(q, FLT_MAX, -FLT_MAX);
+    PDF_lineto(q, (float) (inf - inf), (float) -inf);
+    PDF_stroke(q);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    buf = PDF_get_buffer(q, &size);
+    buf = first_stream(buf, size, &size);
+    ok = count_ops(buf, size, "re") == 41 * 4 + 40 * 41 / 2 &&
+	 contains(buf, size, HUGE_RE, strlen(HUGE_RE)) &&
+	 contains(buf, size, "-2147483647 2147483647 m\n", 25) &&
+	 contains(buf, size, "2147483647 -2147483647 l\n0 0 l\n", 31);
+    PDF_delete(q);
+
+    PDF_begin_page(p, a4_width, a4_height);
+    PDF_rects(p, huge, 4);
+    PDF_stroke(p);
+    PDF_end_page(p);
+
+    if (!ok)
+	fprintf(stderr, "\nHuge numbers not clamped!\n");
+
+    MESSAGE("done\n");
+}
+
+/* Read a whole file into a malloc()ed buffer */
+static char *
+read_file(FILE *fp, long *size)
+{
+    char *buf;
+
+    fseek(fp, 0L, SEEK_END);
+    *size = ftell(fp);
+    fseek(fp, 0L, SEEK_SET);
+    buf = (char *) malloc((size_t) *size + 1);
+    if (buf != NULL && fread(buf, 1, (size_t) *size, fp) != (size_t) *size) {
+	free(buf);
+	buf = NULL;
+    }
+    return buf;
+}
+
+static char *
+load_file(const char *filename, long *size)
+{
+    FILE *fp;
+    char *buf;
+
+    if ((fp = fopen(filename, "rb")) == NULL)
+	return NULL;
+    buf = read_file(fp, size);
+    fclose(fp);
+    return buf;
+}
+
+typedef struct {
+    char	*buf;
+    long	size;
+} collected;
+
+static size_t
+collect_bytes(PDF *p, void *data, size_t size)
+{
+    collected *c = (collected *) PDF_get_opaque(p);
+
+    c->buf = (char *) realloc(c->buf, (size_t) c->size + size);
+    memcpy(c->buf + c->size, data, size);
+    c->size += (long) size;
+    return size;
+}
+
+static void
+passthrough_document(PDF *q)
+{
+    PDF_set_parameter(q, "compress", "0");
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_place_image(q, PDF_open_JPEG(q, "nesrin.jpg"), 0, 0, 1);
+    PDF_place_image(q, PDF_open_CCITT(q, "tm.g3", 591, 236, 0, 0, 0),
+	0, 0, 1);
+    PDF_end_page(q);
+    PDF_close(q);
+}
+
+/* JPEG and CCITT data is copied from the image file to the output without
+ * going through a data source. Check that it arrives unchanged in a disk
+ * file, in the in-core buffer, and at a write procedure.
+ */
+static void
+image_passthrough(PDF *p)
+{
+    PDF *q;
+    FILE *fp;
+    const char *buf;
+    char *jpeg, *g3, *out;
+    long jpeg_size, g3_size, size;
+    collected c;
+    int ok;
+
+    MESSAGE("Image passthrough test...");
+
+    jpeg = load_file("nesrin.jpg", &jpeg_size);
+    g3 = load_file("tm.g3", &g3_size);
+    if (jpeg == NULL || g3 == NULL) {
+	fprintf(stderr, "Error: Couldn't read test images.\n");
+	return;
+    }
+
+    /* a temporary file, since all threads run this test */
+    fp = tmpfile();
+    q = PDF_new();
+    PDF_open_fp(q, fp);
+    passthrough_document(q);
+    PDF_delete(q);
+
+    out = fp != NULL ? read_file(fp, &size) : NULL;
+    ok = out != NULL && contains(out, size, jpeg, (size_t) jpeg_size) &&
+	 contains(out, size, g3, (size_t) g3_size);
+    free(out);
+    if (fp != NULL)
+	fclose(fp);
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    passthrough_document(q);
+    buf = PDF_get_buffer(q, &size);
+    ok = ok && contains(buf, size, jpeg, (size_t) jpeg_size) &&
+	 contains(buf, size, g3, (size_t) g3_size);
+    PDF_delete(q);
+
+    c.buf = NULL;
+    c.size = 0;
+    q = PDF_new2(NULL, NULL, NULL, NULL, (void *) &c);
+    PDF_open_mem(q, collect_bytes);
+    passthrough_document(q);
+    PDF_delete(q);
+    ok = ok && contains(c.buf, c.size, jpeg, (size_t) jpeg_size) &&
+	 contains(c.buf, c.size, g3, (size_t) g3_size);
+    free(c.buf);
+
+    free(jpeg);
+    free(g3);
+
+    if (!ok)
+	fprintf(stderr, "\nImage passthrough output corrupted!\n");
+
+    MESSAGE("done\n");
+}
+
+/* Write a marker segment of the given length filled with junk which
+ * looks like markers, as found in EXIF data and ICC profiles. Only the
+ * first count bytes of the segment are actually written.
+ */
+static void
+write_segment(FILE *fp, int marker, long length, long count)
+{
+    long i;
+
+    putc(0xFF, fp);
+    putc(marker, fp);
+    putc((int) (length >> 8), fp);
+    putc((int) (length & 0xFF), fp);
+    for (i = 2; i < count; i++)
+	putc((i & 1) ? 0xFF : (int) (0xC0 + i % 32), fp);
+}
+
+/* Open JPEG files with large metadata segments in front of the frame
+ * header, and broken ones which must be rejected
+ */
+static void
+jpeg_markers(PDF *p, long n)
+{
+    char filename[50];
+    char *jpeg;
+    long size, jfif;
+    FILE *fp;
+    int image, ok, i;
+
+    MESSAGE("JPEG marker test...");
+
+    if ((jpeg = load_file("nesrin.jpg", &size)) == NULL) {
+	fprintf(stderr, "Error: Couldn't read nesrin.jpg.\n");
+	return;
+    }
+    sprintf(filename, "pdftest%03ld.jpg", n);
+
+    /* SOI and JFIF marker, followed by EXIF, ICC, and comment segments */
+    jfif = 2 + 2 + ((jpeg[4] & 0xFF) << 8) + (jpeg[5] & 0xFF);
+    fp = fopen(filename, "wb");
+    fwrite(jpeg, 1, (size_t) jfif, fp);
+    write_segment(fp, 0xE1, 65535L, 65535L);
+    for (i = 0; i < 3; i++)
+	write_segment(fp, 0xE2, 65000L, 65000L);
+    write_segment(fp, 0xFE, 3L, 3L);
+    fwrite(jpeg + jfif, 1, (size_t) (size - jfif), fp);
+    fclose(fp);
+
+    image = PDF_open_JPEG(p, filename);
+    ok = image != -1 && PDF_get_image_width(p, image) == 745 &&
+	 PDF_get_image_height(p, image) == 493;
+    if (image != -1) {
+	PDF_begin_page(p, a4_width, a4_height);
+	PDF_place_image(p, image, 0, 0, 0.5);
+	PDF_end_page(p);
+    }
+
+    /* cut off in the middle of a segment, and in a segment length */
+    fp = fopen(filename, "wb");
+    fwrite(jpeg, 1, (size_t) jfif, fp);
+    write_segment(fp, 0xE1, 65535L, 30000L);
+    fclose(fp);
+    ok = ok && PDF_open_JPEG(p, filename) == -1;
+
+    fp = fopen(filename, "wb");
+    fwrite(jpeg, 1, (size_t) jfif + 3, fp);
+    fclose(fp);
+    ok = ok && PDF_open_JPEG(p, filename) == -1;
+
+    /* no JPEG data near the start of the file */
+    fp = fopen(filename, "wb");
+    for (i = 0; i < 4000; i++)
+	putc(i & 0x7F, fp);
+    fwrite(jpeg, 1, (size_t) size, fp);
+    fclose(fp);
+    ok = ok && PDF_open_JPEG(p, filename) == -1;
+
+    remove(filename);
+    free(jpeg);
+
+    if (!ok)
+	fprintf(stderr, "\nJPEG marker handling failed!\n");
+
+    MESSAGE("done\n");
+}
+
+#ifdef HAVE_LIBTIFF
+#define TIFF_WIDTH	37
+#define TIFF_HEIGHT	23
+
+/* Write a test image with the given layout. The samples are taken from
+ * data, which holds the interleaved image lines without padding bytes
+ * if bpc < 8. Separate planes are written for planar images, and
+ * Deflate compressed images use the horizontal predictor.
+ */
+static int
+write_tiff(const char *filename, const unsigned char *data, int bpc, int spp,
+    int photometric, int planar, int rowsperstrip, int tilesize,
+    int compression)
+{
+    static unsigned char buf[4 * 64 * 64 * 2];
+    uint16 map[3 * 16];
+    TIFF *tif;
+    int x, y, s, i, j, line = (TIFF_WIDTH * bpc * spp + 7) / 8;
+    int planes = (planar == PLANARCONFIG_SEPARATE ? spp : 1);
+    int bytes = bpc / 8 * spp / planes;		/* per pixel and plane */
+
+    if ((tif = TIFFOpen(filename, "w")) == NULL)
+	return 0;
+
+    TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, TIFF_WIDTH);
+    TIFFSetField(tif, TIFFTAG_IMAGELENGTH, TIFF_HEIGHT);
+    TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, bpc);
+    TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, spp);
+    TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, photometric);
+    TIFFSetField(tif, TIFFTAG_PLANARCONFIG, planar);
+    TIFFSetField(tif, TIFFTAG_COMPRESSION, compression);
+    if (compression == COMPRESSION_ADOBE_DEFLATE)
+	TIFFSetField(tif, TIFFTAG_PREDICTOR, 2);
+
+    if (photometric == PHOTOMETRIC_PALETTE) {
+	for (i = 0; i < 16; i++) {
+	    map[i] = (uint16) (i * 4369);
+	    map[16 + i] = (uint16) (65535 - i * 4369);
+	    map[32 + i] = (uint16) ((i & 1) * 65535);
+	}
+	TIFFSetField(tif, TIFFTAG_COLORMAP, map, map + 16, map + 32);
+    }
+
+    if (tilesize == 0) {
+	TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, rowsperstrip);
+	for (s = 0; s < planes; s++) {
+	    for (y = 0; y < TIFF_HEIGHT; y++) {
+		if (planar == PLANARCONFIG_SEPARATE) {
+		    for (x = 0; x < TIFF_WIDTH; x++)
+			buf[x] = data[(y * TIFF_WIDTH + x) * spp + s];
+		} else {
+		    memcpy(buf, data + y * line, (size_t) line);
+		}
+		if (TIFFWriteScanline(tif, buf, (uint32) y, (uint16) s) < 0)
+		    return 0;
+	    }
+	}
+    } else {
+	/* 8 bit samples */
+	TIFFSetField(tif, TIFFTAG_TILEWIDTH, tilesize);
+	TIFFSetField(tif, TIFFTAG_TILELENGTH, tilesize);
+	for (s = 0; s < planes; s++)
+	    for (y = 0; y < TIFF_HEIGHT; y += tilesize)
+		for (x = 0; x < TIFF_WIDTH; x += tilesize) {
+		    memset(buf, 0, sizeof(buf));
+		    for (i = 0; i < tilesize && y + i < TIFF_HEIGHT; i++)
+			for (j = 0; j < tilesize && x + j < TIFF_WIDTH; j++)
+			    memcpy(buf + (i * tilesize + j) * bytes,
+				data + ((y + i) * TIFF_WIDTH + x + j) * spp + s,
+				(size_t) bytes);
+		    if (TIFFWriteTile(tif, buf, (uint32) x, (uint32) y, 0,
+			    (uint16) s) < 0)
+			return 0;
+		}
+    }
+
+    TIFFClose(tif);
+    return 1;
+}
+
+/* Embed a TIFF image in an uncompressed memory document and compare the
+ * image data with the expected samples. Palette images start with a
+ * colormap stream, which is skipped.
+ */
+static int
+check_tiff(const char *filename, const char *dict, int skip,
+    const unsigned char *expected, long size)
+{
+    PDF *q;
+    const char *buf, *data;
+    long len, total;
+    int ok;
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+    ok = PDF_open_TIFF(q, filename) != -1;
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    buf = PDF_get_buffer(q, &total);
+    data = first_stream(buf, total, &len);
+    if (skip) {
+	total -= (long) (data - buf) + len + 9;
+	buf = data + len + 9;		/* skip "endstream" */
+	data = first_stream(buf, total, &len);
+    }
+
+    ok = ok && contains(buf, data - buf, dict, strlen(dict)) &&
+	 len >= size && !memcmp(data, expected, (size_t) size);
+    PDF_delete(q);
+    return ok;
+}
+
+/* Check that a single strip image goes into the PDF still compressed */
+static int
+check_tiff_strip(const char *filename, const char *dict)
+{
+    static unsigned char strip[TIFF_WIDTH * TIFF_HEIGHT * 3 * 2];
+    TIFF *tif;
+    tsize_t size;
+
+    if ((tif = TIFFOpen(filename, "r")) == NULL)
+	return 0;
+    size = TIFFReadRawStrip(tif, 0, strip, (tsize_t) sizeof(strip));
+    TIFFClose(tif);
+
+    return size > 0 && check_tiff(filename, dict, 0, strip, (long) size);
+}
+
+/* Read TIFF images which are passed on unchanged, with 1 to 8 bits per
+ * sample in strips and tiles, and images which are converted to 8 bit
+ * RGB or gray samples: planar RGB in strips and tiles, and 16 bit gray.
+ * Single strip images with G4, LZW or Flate compression aren't even
+ * decompressed.
+ */
+static void
+tiff_formats(PDF *p, long n)
+{
+    static unsigned char data[TIFF_WIDTH * TIFF_HEIGHT * 3 * 2];
+    static unsigned char expected[TIFF_WIDTH * TIFF_HEIGHT * 3];
+    char filename[50];
+    int i, ok, line;
+
+    MESSAGE("TIFF formats test...");
+
+    sprintf(filename, "pdftest%03ld.tif", n);
+    for (i = 0; i < (int) sizeof(data); i++)
+	data[i] = (unsigned char) ((i * 7919) >> 3);
+
+    /* bilevel, 5 lines per strip */
+    line = (TIFF_WIDTH + 7) / 8;
+    for (i = 0; i < TIFF_HEIGHT * line; i++)
+	data[i] &= (unsigned char) (i % line == line - 1 ? 0xF8 : 0xFF);
+    ok = write_tiff(filename, data, 1, 1, PHOTOMETRIC_MINISBLACK,
+	    PLANARCONFIG_CONTIG, 5, 0, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 1\n/ColorSpace /DeviceGray",
+	    0, data, TIFF_HEIGHT * line);
+
+    /* inverted for min-is-white */
+    for (i = 0; i < TIFF_HEIGHT * line; i++)
+	expected[i] = (unsigned char) ~data[i];
+    ok = ok && write_tiff(filename, data, 1, 1, PHOTOMETRIC_MINISWHITE,
+	    PLANARCONFIG_CONTIG, 5, 0, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 1\n", 0,
+	    expected, TIFF_HEIGHT * line);
+
+    /* 4 bit palette */
+    line = (TIFF_WIDTH * 4 + 7) / 8;
+    for (i = 0; i < TIFF_HEIGHT * line; i++)
+	data[i] = (unsigned char) ((i * 7919) >> 3) &
+		(unsigned char) (i % line == line - 1 ? 0xF0 : 0xFF);
+    ok = ok && write_tiff(filename, data, 4, 1, PHOTOMETRIC_PALETTE,
+	    PLANARCONFIG_CONTIG, 3, 0, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 4\n/ColorSpace [/Indexed "
+	    "/DeviceRGB 15", 1, data, TIFF_HEIGHT * line);
+
+    /* 8 bit RGB in 16x16 tiles */
+    for (i = 0; i < (int) sizeof(data); i++)
+	data[i] = (unsigned char) ((i * 7919) >> 3);
+    ok = ok && write_tiff(filename, data, 8, 3, PHOTOMETRIC_RGB,
+	    PLANARCONFIG_CONTIG, 0, 16, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 8\n/ColorSpace /DeviceRGB",
+	    0, data, TIFF_WIDTH * TIFF_HEIGHT * 3);
+
+    /* planar RGB in strips and tiles, converted by libtiff */
+    ok = ok && write_tiff(filename, data, 8, 3, PHOTOMETRIC_RGB,
+	    PLANARCONFIG_SEPARATE, 4, 0, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 8\n/ColorSpace /DeviceRGB",
+	    0, data, TIFF_WIDTH * TIFF_HEIGHT * 3);
+    ok = ok && write_tiff(filename, data, 8, 3, PHOTOMETRIC_RGB,
+	    PLANARCONFIG_SEPARATE, 0, 16, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 8\n/ColorSpace /DeviceRGB",
+	    0, data, TIFF_WIDTH * TIFF_HEIGHT * 3);
+
+    /* 16 bit gray, converted to 8 bit */
+    for (i = 0; i < TIFF_WIDTH * TIFF_HEIGHT; i++) {
+	expected[i] = data[2 * i];
+	((uint16 *) data)[TIFF_WIDTH * TIFF_HEIGHT + i] =
+	    (uint16) (expected[i] * 257);
+    }
+    memmove(data, data + 2 * TIFF_WIDTH * TIFF_HEIGHT,
+	2 * TIFF_WIDTH * TIFF_HEIGHT);
+    ok = ok && write_tiff(filename, data, 16, 1, PHOTOMETRIC_MINISBLACK,
+	    PLANARCONFIG_CONTIG, 7, 0, COMPRESSION_LZW) &&
+	 check_tiff(filename, "/BitsPerComponent 8\n/ColorSpace /DeviceGray",
+	    0, expected, TIFF_WIDTH * TIFF_HEIGHT);
+
+    /* single strips: G4, Flate with predictor, LZW */
+    ok = ok && write_tiff(filename, data, 1, 1, PHOTOMETRIC_MINISWHITE,
+	    PLANARCONFIG_CONTIG, TIFF_HEIGHT, 0, COMPRESSION_CCITTFAX4) &&
+	 check_tiff_strip(filename, "/Filter [/CCITTFaxDecode]\n"
+	    "/DecodeParms [ <</Columns 37 /Rows 23 /K -1 >>]");
+    ok = ok && write_tiff(filename, data, 1, 1, PHOTOMETRIC_MINISBLACK,
+	    PLANARCONFIG_CONTIG, TIFF_HEIGHT, 0, COMPRESSION_CCITTFAX4) &&
+	 check_tiff_strip(filename, "/K -1 /BlackIs1 true >>]");
+    ok = ok && write_tiff(filename, data, 8, 3, PHOTOMETRIC_RGB,
+	    PLANARCONFIG_CONTIG, TIFF_HEIGHT, 0, COMPRESSION_ADOBE_DEFLATE) &&
+	 check_tiff_strip(filename, "/Filter [/FlateDecode]\n/DecodeParms "
+	    "[ <</Predictor 2 /Colors 3 /Columns 37 >>]");
+    ok = ok && write_tiff(filename, data, 8, 1, PHOTOMETRIC_MINISBLACK,
+	    PLANARCONFIG_CONTIG, TIFF_HEIGHT, 0, COMPRESSION_LZW) &&
+	 check_tiff_strip(filename, "/Filter [/LZWDecode]\n"
+	    "/DecodeParms [ <</EarlyChange 1 >>]");
+
+    remove(filename);
+
+    if (!ok)
+	fprintf(stderr, "\nTIFF image data unexpected!\n");
+
+    (void) p;
+    MESSAGE("done\n");
+}
+
+#define TIFF_PAGES	5
+
+/* Open the pages of a multi-page TIFF file in random order. Every page is
+ * filled with a different gray level.
+ */
+static void
+tiff_pages(PDF *p, long n)
+{
+    static const int order[] = { 2, 1, 5, 3, 4, 4, 1 };
+    static unsigned char line[TIFF_WIDTH];
+    char filename[50];
+    const char *buf, *data;
+    long len, total;
+    int i, y, ok;
+    TIFF *tif;
+    PDF *q;
+
+    MESSAGE("TIFF pages test...");
+
+    sprintf(filename, "pdftest%03ld.tif", n);
+    if ((tif = TIFFOpen(filename, "w")) == NULL)
+	return;
+    for (i = 1; i <= TIFF_PAGES; i++) {
+	TIFFSetField(tif, TIFFTAG_IMAGEWIDTH, TIFF_WIDTH);
+	TIFFSetField(tif, TIFFTAG_IMAGELENGTH, TIFF_HEIGHT);
+	TIFFSetField(tif, TIFFTAG_BITSPERSAMPLE, 8);
+	TIFFSetField(tif, TIFFTAG_SAMPLESPERPIXEL, 1);
+	TIFFSetField(tif, TIFFTAG_PHOTOMETRIC, PHOTOMETRIC_MINISBLACK);
+	TIFFSetField(tif, TIFFTAG_ROWSPERSTRIP, 4);
+	memset(line, i * 40, sizeof(line));
+	for (y = 0; y < TIFF_HEIGHT; y++)
+	    TIFFWriteScanline(tif, line, (uint32) y, 0);
+	TIFFWriteDirectory(tif);
+    }
+    TIFFClose(tif);
+
+    q = PDF_new();
+    PDF_open_mem(q, NULL);
+    PDF_set_parameter(q, "compress", "0");
+
+    ok = 1;
+    for (i = 0; i < (int) (sizeof(order) / sizeof(order[0])); i++)
+	ok = ok && PDF_open_TIFF_page(q, filename, order[i]) != -1;
+    ok = ok && PDF_open_TIFF_page(q, filename, TIFF_PAGES + 1) == -1 &&
+	 PDF_open_TIFF_page(q, filename, 0) == -1 &&
+	 PDF_open_TIFF_page(q, filename, 3) != -1;
+
+    PDF_begin_page(q, a4_width, a4_height);
+    PDF_end_page(q);
+    PDF_close(q);
+
+    /* the image streams come in the order the pages were opened */
+    buf = PDF_get_buffer(q, &total);
+    for (i = 0; i < (int) (sizeof(order) / sizeof(order[0])); i++) {
+	data = first_stream(buf, total, &len);
+	ok = ok && len >= TIFF_WIDTH * TIFF_HEIGHT &&
+	     (unsigned char) data[0] == order[i] * 40 &&
+	     (unsigned char) data[TIFF_WIDTH * TIFF_HEIGHT - 1] == order[i] * 40;
+	total -= (long) (data - buf) + len + 9;
+	buf = data + len + 9;
+    }
+    PDF_delete(q);
+
+    remove(filename);
+
+    if (!ok)
+	fprintf(stderr, "\nTIFF pages unexpected!\n");
+
+    (void) p;
+    MESSAGE("done\n");
+}
+#endif
+
 static unsigned
 #ifdef WIN32
 __stdcall		/* needed for threads */
@@ -939,6 +2541,27 @@ Do_PDFlib_tests(void *arg)
     radial_structure(p);
     random_data_graph(p);
     many_pages(p);
+    memory_output(p);
+    compression_switch();
+    state_tracking(p);
+    afm_metrics(p);
+    afm_parser(p);
+    font_pack(p);
+    kerning(p);
+    string_widths(p);
+    text_boxes(p);
+    string_quoting(p);
+    text_table(p);
+    same_position(p);
+    batched_paths(p);
+    path_decimation(p);
+    huge_numbers(p);
+    image_passthrough(p);
+    jpeg_markers(p, (long) arg);
+#ifdef HAVE_LIBTIFF
+    tiff_formats(p, (long) arg);
+    tiff_pages(p, (long) arg);
+#endif
 
     PDF_close(p);
     PDF_delete(p);
@@ -959,7 +2582,11 @@ main(int argc, char *argv[])
     unsigned t, w, thread_id;
 
     HANDLE hThread[PDF_MAXTHREADS];
+#endif
 
+    PDF_boot();
+
+#ifdef WIN32
     /* do a multi-threaded test */
     for (t=0; t < PDF_MAXTHREADS; t++) {
 	hThread[t] =(HANDLE) _beginthreadex(NULL, 0, &Do_PDFlib_tests,
@@ -981,6 +2608,8 @@ main(int argc, char *argv[])
 
 #endif
 
+    PDF_shutdown();
+
     exit(0);
 
     return 0;	/* shut up compiler warnings */